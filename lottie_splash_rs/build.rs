@@ -139,6 +139,7 @@ fn main() -> Result<()> {
     println!("cargo:rustc-link-lib=dylib=gdi32");
     println!("cargo:rustc-link-lib=dylib=opengl32");
     println!("cargo:rustc-link-lib=dylib=dwmapi");
+    println!("cargo:rustc-link-lib=dylib=wtsapi32");
     println!("cargo:rustc-link-lib=dylib=Shcore");
 
     Ok(())
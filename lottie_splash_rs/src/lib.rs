@@ -4,8 +4,10 @@
 
 use num_derive::{FromPrimitive, ToPrimitive};
 use num_traits::FromPrimitive;
-use std::ffi::{c_char, c_float, c_void, CString};
+use std::ffi::{c_char, c_float, c_void, CStr, CString};
+use std::marker::PhantomData;
 use std::ptr::NonNull;
+use std::time::Duration;
 use thiserror::Error;
 
 #[repr(C)]
@@ -23,6 +25,9 @@ pub enum lottie_splash_error {
     LOTTIE_SPLASH_ERROR_FONT_LOAD_FAILED,
     LOTTIE_SPLASH_ERROR_DISPLAY_INIT_FAILED,
     LOTTIE_SPLASH_ERROR_RENDER_FAILED,
+    LOTTIE_SPLASH_ERROR_ALREADY_INITIALIZED,
+    LOTTIE_SPLASH_ERROR_NOT_SUPPORTED,
+    LOTTIE_SPLASH_ERROR_FILE_WRITE_FAILED,
 }
 
 #[derive(Debug, Copy, Clone, FromPrimitive, ToPrimitive)]
@@ -40,6 +45,9 @@ enum FfiError {
     FontLoadFailed,
     DisplayInitFailed,
     RenderFailed,
+    AlreadyInitialized,
+    NotSupported,
+    FileWriteFailed,
 }
 
 #[derive(Error, Debug)]
@@ -66,6 +74,12 @@ pub enum Error {
     DisplayInitFailed,
     #[error("Render failed")]
     RenderFailed,
+    #[error("Library already initialized")]
+    AlreadyInitialized,
+    #[error("Not supported by this build of the library")]
+    NotSupported,
+    #[error("File write failed")]
+    FileWriteFailed,
     #[error("IO error: {0}")]
     Io(#[from] std::io::Error),
     #[error("UTF-8 conversion error: {0}")]
@@ -76,9 +90,101 @@ pub enum Error {
     NulError(#[from] std::ffi::NulError),
 }
 
+/// Quality level picked by the adaptive quality governor, see [`Stats::quality_level`].
+#[repr(i32)]
+#[derive(Debug, Default, Copy, Clone, PartialEq, Eq, FromPrimitive, ToPrimitive)]
+pub enum QualityLevel {
+    #[default]
+    Full = 0,
+    ReducedFrameRate,
+    ReducedResolution,
+    Frozen,
+}
+
+/// Subsystem the library's heap memory is accounted to, see [`memory_usage`].
+#[repr(i32)]
+#[derive(Debug, Copy, Clone, PartialEq, Eq, FromPrimitive, ToPrimitive)]
+pub enum MemorySubsystem {
+    Other = 0,
+    Parser,
+    Model,
+    Rasterizer,
+    FrameCache,
+}
+
+#[repr(C)]
+#[derive(Debug, Default, Copy, Clone, PartialEq, Eq)]
+pub struct MemoryUsage {
+    pub current_bytes: u64,
+    pub peak_bytes: u64,
+}
+
+/// Allocation function for [`set_allocator`]. Must return blocks aligned like `malloc` does.
+pub type MallocFn = unsafe extern "C" fn(size: usize, user: *mut c_void) -> *mut c_void;
+/// Resizes a block like `realloc`. Never called with a null pointer or a size of 0.
+pub type ReallocFn =
+    unsafe extern "C" fn(pointer: *mut c_void, size: usize, user: *mut c_void) -> *mut c_void;
+pub type FreeFn = unsafe extern "C" fn(pointer: *mut c_void, user: *mut c_void);
+
 #[repr(C)]
 pub struct lottie_splash_context(c_void);
 
+#[repr(C)]
+pub struct lottie_splash_task(c_void);
+
+/// Number of counters available to registered message placeholders.
+pub const MAX_COUNTERS: u32 = 16;
+
+#[repr(C)]
+struct lottie_splash_create_options {
+    poster_pixels: *const u32,
+    poster_width: u32,
+    poster_height: u32,
+    utf8_poster_cache_path: *const c_char,
+    font_data: *const c_char,
+    font_data_size: usize,
+    utf8_font_search_paths: *const c_char,
+    virtual_clock: i32,
+    quantize_frames: i32,
+}
+
+#[repr(C)]
+#[derive(Default)]
+struct lottie_splash_stats {
+    time_to_first_pixel_ms: f64,
+    time_to_first_frame_ms: f64,
+    frames_rendered: u64,
+    progress_bar_updates: u64,
+    dropped_frames: u64,
+    max_frame_lateness_ms: f64,
+    repeated_source_frames: u64,
+    skipped_source_frames: u64,
+    quality_level: i32,
+    quality_level_changes: u64,
+    cpu_usage_percent: f64,
+    times_hidden: u64,
+    hidden_time_ms: f64,
+    steady_frame_heap_allocations: u64,
+    engine_frame_heap_allocations: u64,
+    uses_expressions: i32,
+    animation_load_ms: f64,
+    expression_heap_bytes: u64,
+    overdraw_pixel_writes: u64,
+    overdraw_canvas_pixels: u64,
+    cached_static_layers: u64,
+    overlay_redraws: u64,
+    progress_target: f32,
+    displayed_progress: f32,
+}
+
+#[repr(C)]
+struct lottie_splash_layer_profile {
+    utf8_name: *const c_char,
+    samples: u64,
+    update_ms: f64,
+    draw_ms: f64,
+}
+
 extern "C" {
     fn lottie_splash_create(
         lottie_animation_buf: *const c_char,
@@ -89,6 +195,16 @@ extern "C" {
         out_error: *mut lottie_splash_error,
     ) -> *mut lottie_splash_context;
 
+    fn lottie_splash_create_ex(
+        lottie_animation_buf: *const c_char,
+        buf_size: usize,
+        utf8_window_title: *const c_char,
+        window_width: u32,
+        window_height: u32,
+        options: *const lottie_splash_create_options,
+        out_error: *mut lottie_splash_error,
+    ) -> *mut lottie_splash_context;
+
     fn lottie_splash_destroy(ctx: *mut lottie_splash_context) -> lottie_splash_error;
 
     fn lottie_splash_run_window(ctx: *mut lottie_splash_context) -> lottie_splash_error;
@@ -100,10 +216,111 @@ extern "C" {
         utf8_string: *const c_char,
     ) -> lottie_splash_error;
 
+    fn lottie_splash_register_message(
+        ctx: *mut lottie_splash_context,
+        utf8_string: *const c_char,
+        out_message_id: *mut u32,
+    ) -> lottie_splash_error;
+
+    fn lottie_splash_set_status_message_id(
+        ctx: *mut lottie_splash_context,
+        message_id: u32,
+    ) -> lottie_splash_error;
+
+    fn lottie_splash_set_counter(
+        ctx: *mut lottie_splash_context,
+        slot: u32,
+        value: u64,
+    ) -> lottie_splash_error;
+
     fn lottie_splash_set_progress(
         ctx: *mut lottie_splash_context,
         normalized_progress_value: c_float,
     ) -> lottie_splash_error;
+
+    fn lottie_splash_add_task(
+        ctx: *mut lottie_splash_context,
+        weight: c_float,
+        out_task: *mut *mut lottie_splash_task,
+    ) -> lottie_splash_error;
+
+    fn lottie_splash_task_advance(
+        task: *mut lottie_splash_task,
+        done: u64,
+        total: u64,
+    ) -> lottie_splash_error;
+
+    fn lottie_splash_get_stats(
+        ctx: *const lottie_splash_context,
+        out_stats: *mut lottie_splash_stats,
+    ) -> lottie_splash_error;
+
+    fn lottie_splash_get_layer_profile(
+        ctx: *const lottie_splash_context,
+        out_layers: *mut lottie_splash_layer_profile,
+        capacity: u32,
+        out_count: *mut u32,
+    ) -> lottie_splash_error;
+
+    fn lottie_splash_write_layer_profile(
+        ctx: *const lottie_splash_context,
+        utf8_path: *const c_char,
+    ) -> lottie_splash_error;
+
+    fn lottie_splash_set_overdraw_heat_map(
+        ctx: *mut lottie_splash_context,
+        enabled: i32,
+    ) -> lottie_splash_error;
+
+    fn lottie_splash_set_cpu_budget(
+        ctx: *mut lottie_splash_context,
+        percent_of_one_core: c_float,
+    ) -> lottie_splash_error;
+
+    fn lottie_splash_advance_clock(
+        ctx: *mut lottie_splash_context,
+        nanoseconds: u64,
+    ) -> lottie_splash_error;
+
+    fn lottie_splash_set_allocator(
+        malloc_fn: Option<MallocFn>,
+        realloc_fn: Option<ReallocFn>,
+        free_fn: Option<FreeFn>,
+        user: *mut c_void,
+    ) -> lottie_splash_error;
+
+    fn lottie_splash_get_memory_usage(
+        subsystem: MemorySubsystem,
+        out_usage: *mut MemoryUsage,
+    ) -> lottie_splash_error;
+}
+
+/// Routes the heap allocations of the library and of thorvg, both operator new and its C allocations, to the given
+/// functions, e.g. to track them or cap their memory. The expression engine works in a static block of its own and
+/// never allocates. Either all functions or none must be given, `None` for all of them restores the default
+/// allocator. Fails with [`Error::AlreadyInitialized`] while a [`LottieSplash`] exists, and with
+/// [`Error::NotSupported`] unless the library was built with `--with-custom-allocator`.
+///
+/// # Safety
+/// The functions must be callable from any thread until the process exits, since blocks allocated by them may be
+/// freed at any later point, and `user` must stay valid just as long.
+pub unsafe fn set_allocator(
+    malloc_fn: Option<MallocFn>,
+    realloc_fn: Option<ReallocFn>,
+    free_fn: Option<FreeFn>,
+    user: *mut c_void,
+) -> Result<(), Error> {
+    lottie_splash_set_allocator(malloc_fn, realloc_fn, free_fn, user).into()
+}
+
+/// Heap memory currently held and the most ever held by a subsystem, across all splashes. Fails with
+/// [`Error::NotSupported`] unless the library was built with `--with-custom-allocator`.
+pub fn memory_usage(subsystem: MemorySubsystem) -> Result<MemoryUsage, Error> {
+    let mut usage = MemoryUsage::default();
+    // SAFETY: usage is a valid pointer
+    let result: Result<(), Error> =
+        unsafe { lottie_splash_get_memory_usage(subsystem, &mut usage as *mut _).into() };
+    result.map(|_| usage)
 }
 
 impl From<lottie_splash_error> for Result<(), Error> {
@@ -121,6 +338,9 @@ impl From<lottie_splash_error> for Result<(), Error> {
             FfiError::FontLoadFailed => Err(Error::FontLoadFailed),
             FfiError::DisplayInitFailed => Err(Error::DisplayInitFailed),
             FfiError::RenderFailed => Err(Error::RenderFailed),
+            FfiError::AlreadyInitialized => Err(Error::AlreadyInitialized),
+            FfiError::NotSupported => Err(Error::NotSupported),
+            FfiError::FileWriteFailed => Err(Error::FileWriteFailed),
         }
     }
 }
@@ -140,14 +360,126 @@ impl From<lottie_splash_error> for Error {
             FfiError::FontLoadFailed => Error::FontLoadFailed,
             FfiError::DisplayInitFailed => Error::DisplayInitFailed,
             FfiError::RenderFailed => Error::RenderFailed,
+            FfiError::AlreadyInitialized => Error::AlreadyInitialized,
+            FfiError::NotSupported => Error::NotSupported,
+            FfiError::FileWriteFailed => Error::FileWriteFailed,
         }
     }
 }
 
+/// What one layer of the animation costs to render, see [`LottieSplash::layer_profile`].
+#[derive(Debug, Clone, PartialEq)]
+pub struct LayerProfile {
+    pub name: String,
+    /// Number of frames the layer was measured in.
+    pub samples: u64,
+    /// Average time per frame the layer adds to preparing paths and to rasterizing them, in milliseconds. Noise can
+    /// make layers which cost next to nothing slightly negative.
+    pub update_ms: f64,
+    pub draw_ms: f64,
+}
+
+/// Premultiplied ARGB8888 image shown before the animation is parsed.
+#[derive(Debug, Copy, Clone)]
+pub struct Poster<'a> {
+    pub pixels: &'a [u32],
+    pub width: u32,
+    pub height: u32,
+}
+
+#[derive(Debug, Default, Copy, Clone)]
+pub struct CreateOptions<'a> {
+    pub poster: Option<Poster<'a>>,
+    /// The poster is loaded from this file when `poster` is not set, and the first live frame is saved there otherwise.
+    pub poster_cache_path: Option<&'a str>,
+    /// TrueType font used for the status text instead of the system fonts.
+    pub font_data: Option<&'a [u8]>,
+    /// Font files tried in order before falling back to the embedded font. Replaces the platform defaults when set.
+    pub font_search_paths: &'a [&'a str],
+    /// Animation time only moves through [`LottieSplash::advance_clock`]. Requires a library built with
+    /// `--with-virtual-clock`, creation fails with [`Error::InvalidArgument`] otherwise.
+    pub virtual_clock: bool,
+    /// Only show whole animation frames, for animations rewritten by `lottie_baker` or `lottie_optimizer`, which are
+    /// only verified at whole frames.
+    pub quantize_frames: bool,
+}
+
+#[derive(Debug, Default, Copy, Clone)]
+pub struct Stats {
+    pub time_to_first_pixel: Duration,
+    pub time_to_first_frame: Duration,
+    pub frames_rendered: u64,
+    /// Frames in which the progress bar moved, stops growing once the bar has settled.
+    pub progress_bar_updates: u64,
+    /// Frame deadlines skipped because rendering fell behind.
+    pub dropped_frames: u64,
+    /// The longest delay between a frame deadline and the start of that frame.
+    pub max_frame_lateness: Duration,
+    /// Animation frames presented again in the following window frame.
+    pub repeated_source_frames: u64,
+    /// Animation frames which were never presented because rendering fell behind.
+    pub skipped_source_frames: u64,
+    /// Current quality level, lowered when rendering takes too much CPU time.
+    pub quality_level: QualityLevel,
+    pub quality_level_changes: u64,
+    /// CPU time used for rendering over the last half second, in percent of one core.
+    pub cpu_usage_percent: f64,
+    /// How often and for how long rendering was suspended because the window couldn't be seen.
+    pub times_hidden: u64,
+    pub hidden_time: Duration,
+    /// Heap allocations by the library in frames that didn't change the scene, and by the renderer in the last frame.
+    /// Only counted when the library was built with `--with-allocation-counter`.
+    pub steady_frame_heap_allocations: u64,
+    pub engine_frame_heap_allocations: u64,
+    /// Whether the animation contains expressions.
+    pub uses_expressions: bool,
+    /// Time spent loading the animation, including starting the expression engine when it's built in.
+    pub animation_load_time: Duration,
+    /// Heap reserved by the expression engine, 0 when built with `--without-expressions`.
+    pub expression_heap_bytes: u64,
+    /// Pixel writes summed over the last frame drawn as an overdraw heat map, and the canvas area they're spread over.
+    /// Both stay 0 until [`LottieSplash::set_overdraw_heat_map`] shows it.
+    pub overdraw_pixel_writes: u64,
+    pub overdraw_canvas_pixels: u64,
+    /// Top level layers which never change, drawn from bitmaps rendered once instead of being rasterized in the last
+    /// frame.
+    pub cached_static_layers: u64,
+    /// Frames which rasterized the progress bar and the messages. The software renderer only draws them again when they
+    /// changed, the OpenGL renderer draws them with every frame.
+    pub overlay_redraws: u64,
+    /// Progress the bar was moving towards in the last frame, set directly or the weighted mean of the tasks.
+    pub progress_target: f32,
+    /// Progress the bar was drawn at in the last frame, which only reaches the target once the bar settled.
+    pub displayed_progress: f32,
+}
+
+/// Id of a status message registered with [`LottieSplash::register_message`].
+#[derive(Debug, Copy, Clone, PartialEq, Eq, Hash)]
+pub struct MessageId(u32);
+
 pub struct LottieSplash {
     ctx: NonNull<lottie_splash_context>,
 }
 
+/// Weighted part of the overall progress, see [`LottieSplash::add_task`].
+pub struct Task<'a> {
+    task: NonNull<lottie_splash_task>,
+    _splash: PhantomData<&'a LottieSplash>,
+}
+
+// SAFETY: Task progress is a single atomic value on the C++ side
+unsafe impl Send for Task<'_> {}
+// SAFETY: Task progress is a single atomic value on the C++ side
+unsafe impl Sync for Task<'_> {}
+
+impl Task<'_> {
+    /// Reports `done` out of `total` units of work. A zero `total` marks the task as complete.
+    pub fn advance(&self, done: u64, total: u64) -> Result<(), Error> {
+        // SAFETY: task is non-null and outlives self, since it's owned by the splash we borrow
+        unsafe { lottie_splash_task_advance(self.task.as_ptr(), done, total).into() }
+    }
+}
+
 // SAFETY: The underlying C++ implementation is thread-safe
 unsafe impl Send for LottieSplash {}
 // SAFETY: All methods take &self and the C++ side handles synchronization
@@ -159,19 +491,69 @@ impl LottieSplash {
         window_title: &str,
         windows_width: u32,
         windows_height: u32,
+    ) -> Result<Self, Error> {
+        Self::with_options(
+            animation_data,
+            window_title,
+            windows_width,
+            windows_height,
+            &CreateOptions::default(),
+        )
+    }
+
+    pub fn with_options(
+        animation_data: &[u8],
+        window_title: &str,
+        windows_width: u32,
+        windows_height: u32,
+        options: &CreateOptions,
     ) -> Result<Self, Error> {
         let mut error = lottie_splash_error::LOTTIE_SPLASH_SUCCESS;
 
         let window_title = CString::new(window_title)?;
+        let poster_cache_path = options.poster_cache_path.map(CString::new).transpose()?;
+        let font_search_paths = if options.font_search_paths.is_empty() {
+            None
+        } else {
+            Some(CString::new(options.font_search_paths.join(";"))?)
+        };
+
+        let mut ffi_options = lottie_splash_create_options {
+            poster_pixels: std::ptr::null(),
+            poster_width: 0,
+            poster_height: 0,
+            utf8_poster_cache_path: poster_cache_path
+                .as_ref()
+                .map_or(std::ptr::null(), |path| path.as_ptr()),
+            font_data: options
+                .font_data
+                .map_or(std::ptr::null(), |data| data.as_ptr() as *const c_char),
+            font_data_size: options.font_data.map_or(0, |data| data.len()),
+            utf8_font_search_paths: font_search_paths
+                .as_ref()
+                .map_or(std::ptr::null(), |paths| paths.as_ptr()),
+            virtual_clock: options.virtual_clock as i32,
+            quantize_frames: options.quantize_frames as i32,
+        };
+
+        if let Some(poster) = options.poster {
+            if (poster.pixels.len() as u64) < poster.width as u64 * poster.height as u64 {
+                return Err(Error::InvalidArgument);
+            }
+            ffi_options.poster_pixels = poster.pixels.as_ptr();
+            ffi_options.poster_width = poster.width;
+            ffi_options.poster_height = poster.height;
+        }
 
         // SAFETY: We ensure the pointers are valid and the data outlives the call
         let ctx = unsafe {
-            lottie_splash_create(
+            lottie_splash_create_ex(
                 animation_data.as_ptr() as *const c_char,
                 animation_data.len(),
                 window_title.as_ptr(),
                 windows_width,
                 windows_height,
+                &ffi_options as *const _,
                 &mut error as *mut _,
             )
         };
@@ -194,6 +576,48 @@ impl LottieSplash {
         unsafe { lottie_splash_set_status_message(self.ctx.as_ptr(), message.as_ptr()).into() }
     }
 
+    /// Registers an immutable status message. Switching to it later is cheaper than setting a string.
+    /// `{N}` placeholders are replaced with the value of counter N whenever a frame is drawn.
+    pub fn register_message(&self, message: &str) -> Result<MessageId, Error> {
+        let message = CString::new(message)?;
+        let mut id = 0u32;
+
+        // SAFETY: ctx is guaranteed to be non-null by NonNull, and message is valid null-terminated UTF-8
+        let result: Result<(), Error> = unsafe {
+            lottie_splash_register_message(self.ctx.as_ptr(), message.as_ptr(), &mut id as *mut _)
+                .into()
+        };
+        result.map(|_| MessageId(id))
+    }
+
+    pub fn set_status_message_id(&self, id: MessageId) -> Result<(), Error> {
+        // SAFETY: ctx is guaranteed to be non-null by NonNull
+        unsafe { lottie_splash_set_status_message_id(self.ctx.as_ptr(), id.0).into() }
+    }
+
+    /// Sets a counter referenced by registered message placeholders. This is a single atomic store.
+    pub fn set_counter(&self, slot: u32, value: u64) -> Result<(), Error> {
+        // SAFETY: ctx is guaranteed to be non-null by NonNull
+        unsafe { lottie_splash_set_counter(self.ctx.as_ptr(), slot, value).into() }
+    }
+
+    /// Adds a weighted task. Once any task exists, the progress bar follows the weighted task progress.
+    pub fn add_task(&self, weight: f32) -> Result<Task<'_>, Error> {
+        let mut task = std::ptr::null_mut();
+
+        // SAFETY: ctx is guaranteed to be non-null by NonNull, and task is a valid pointer
+        let result: Result<(), Error> =
+            unsafe { lottie_splash_add_task(self.ctx.as_ptr(), weight, &mut task as *mut _).into() };
+        result?;
+
+        NonNull::new(task)
+            .map(|task| Task {
+                task,
+                _splash: PhantomData,
+            })
+            .ok_or(Error::InvalidArgument)
+    }
+
     pub fn set_progress(&self, progress: f32) -> Result<(), Error> {
         // SAFETY: ctx is guaranteed to be non-null by NonNull
         unsafe { lottie_splash_set_progress(self.ctx.as_ptr(), progress).into() }
@@ -203,6 +627,103 @@ impl LottieSplash {
         // SAFETY: ctx is guaranteed to be non-null by NonNull
         unsafe { lottie_splash_close_window(self.ctx.as_ptr()).into() }
     }
+
+    pub fn stats(&self) -> Result<Stats, Error> {
+        let mut stats = lottie_splash_stats::default();
+
+        // SAFETY: ctx is guaranteed to be non-null by NonNull, and stats is a valid pointer
+        let result: Result<(), Error> =
+            unsafe { lottie_splash_get_stats(self.ctx.as_ptr(), &mut stats as *mut _).into() };
+        result?;
+
+        Ok(Stats {
+            time_to_first_pixel: Duration::from_secs_f64(stats.time_to_first_pixel_ms / 1000.0),
+            time_to_first_frame: Duration::from_secs_f64(stats.time_to_first_frame_ms / 1000.0),
+            frames_rendered: stats.frames_rendered,
+            progress_bar_updates: stats.progress_bar_updates,
+            dropped_frames: stats.dropped_frames,
+            max_frame_lateness: Duration::from_secs_f64(stats.max_frame_lateness_ms / 1000.0),
+            repeated_source_frames: stats.repeated_source_frames,
+            skipped_source_frames: stats.skipped_source_frames,
+            quality_level: QualityLevel::from_i32(stats.quality_level).unwrap_or_default(),
+            quality_level_changes: stats.quality_level_changes,
+            cpu_usage_percent: stats.cpu_usage_percent,
+            times_hidden: stats.times_hidden,
+            hidden_time: Duration::from_secs_f64(stats.hidden_time_ms / 1000.0),
+            steady_frame_heap_allocations: stats.steady_frame_heap_allocations,
+            engine_frame_heap_allocations: stats.engine_frame_heap_allocations,
+            uses_expressions: stats.uses_expressions != 0,
+            animation_load_time: Duration::from_secs_f64(stats.animation_load_ms / 1000.0),
+            expression_heap_bytes: stats.expression_heap_bytes,
+            overdraw_pixel_writes: stats.overdraw_pixel_writes,
+            overdraw_canvas_pixels: stats.overdraw_canvas_pixels,
+            cached_static_layers: stats.cached_static_layers,
+            overlay_redraws: stats.overlay_redraws,
+            progress_target: stats.progress_target,
+            displayed_progress: stats.displayed_progress,
+        })
+    }
+
+    /// Replaces the splash with a heat map of how often each pixel is written per frame, a debug mode for finding
+    /// overdraw. Fails with [`Error::NotSupported`] when the library was built with `--with-opengl`.
+    pub fn set_overdraw_heat_map(&self, enabled: bool) -> Result<(), Error> {
+        // SAFETY: ctx is guaranteed to be non-null by NonNull
+        unsafe { lottie_splash_set_overdraw_heat_map(self.ctx.as_ptr(), i32::from(enabled)).into() }
+    }
+
+    /// Limits rendering to `percent_of_one_core` percent of one CPU core. The frame rate and then the quality are
+    /// lowered until rendering fits. thorvg's worker threads are counted too, unless the host started a thread right
+    /// when the first splash initialized thorvg, which makes them impossible to tell apart from it.
+    pub fn set_cpu_budget(&self, percent_of_one_core: f32) -> Result<(), Error> {
+        // SAFETY: ctx is guaranteed to be non-null by NonNull
+        unsafe { lottie_splash_set_cpu_budget(self.ctx.as_ptr(), percent_of_one_core).into() }
+    }
+
+    /// Per-layer render cost, most expensive first. Fails with [`Error::NotSupported`] unless the library was built
+    /// with `--with-profiling`.
+    pub fn layer_profile(&self) -> Result<Vec<LayerProfile>, Error> {
+        let mut count = 0u32;
+        // SAFETY: ctx is guaranteed to be non-null by NonNull, no entries are written with a capacity of 0
+        let result: Result<(), Error> = unsafe {
+            lottie_splash_get_layer_profile(self.ctx.as_ptr(), std::ptr::null_mut(), 0, &mut count).into()
+        };
+        result?;
+
+        let capacity = count;
+        let mut layers = Vec::with_capacity(capacity as usize);
+        // SAFETY: layers has room for capacity entries, the call writes at most that many
+        let result: Result<(), Error> = unsafe {
+            lottie_splash_get_layer_profile(self.ctx.as_ptr(), layers.as_mut_ptr(), capacity, &mut count).into()
+        };
+        result?;
+        // SAFETY: the first min(count, capacity) entries were initialized
+        unsafe { layers.set_len(capacity.min(count) as usize) };
+
+        Ok(layers
+            .iter()
+            .map(|layer: &lottie_splash_layer_profile| LayerProfile {
+                // SAFETY: names are null-terminated and live as long as the context
+                name: unsafe { CStr::from_ptr(layer.utf8_name) }.to_string_lossy().into_owned(),
+                samples: layer.samples,
+                update_ms: layer.update_ms,
+                draw_ms: layer.draw_ms,
+            })
+            .collect())
+    }
+
+    /// Writes [`LottieSplash::layer_profile`] as JSON to `path`.
+    pub fn write_layer_profile(&self, path: &str) -> Result<(), Error> {
+        let path = CString::new(path)?;
+        // SAFETY: ctx is guaranteed to be non-null by NonNull, and path is a valid C string
+        unsafe { lottie_splash_write_layer_profile(self.ctx.as_ptr(), path.as_ptr()).into() }
+    }
+
+    /// Advances the animation time of a splash created with [`CreateOptions::virtual_clock`].
+    pub fn advance_clock(&self, delta: Duration) -> Result<(), Error> {
+        let nanoseconds = u64::try_from(delta.as_nanos()).map_err(|_| Error::InvalidArgument)?;
+        // SAFETY: ctx is guaranteed to be non-null by NonNull
+        unsafe { lottie_splash_advance_clock(self.ctx.as_ptr(), nanoseconds).into() }
+    }
 }
 
 impl Drop for LottieSplash {
@@ -1,8 +1,9 @@
 #[cfg(test)]
 mod tests {
     use lottie_splash_rs::*;
+    use std::ffi::c_void;
     use std::thread::{self, ScopedJoinHandle};
-    use std::time::Duration;
+    use std::time::{Duration, Instant};
 
     fn get_test_animation() -> Vec<u8> {
         let bytes =
@@ -10,6 +11,32 @@ mod tests {
         bytes.to_vec()
     }
 
+    // One frame at 60 fps.
+    const FRAME: Duration = Duration::from_micros(16_667);
+
+    fn virtual_clock_splash(title: &str) -> Result<LottieSplash, Error> {
+        let options = CreateOptions {
+            virtual_clock: true,
+            ..Default::default()
+        };
+        LottieSplash::with_options(&get_test_animation(), title, 0, 0, &options)
+    }
+
+    // Stats of a frame that started after everything the caller did before. The next frame may have read the clock
+    // earlier, so this waits for the one after it.
+    fn stats_after_next_frame(splash: &LottieSplash) -> Result<Stats, Error> {
+        let start = splash.stats()?.frames_rendered;
+        let deadline = Instant::now() + Duration::from_secs(5);
+        loop {
+            let stats = splash.stats()?;
+            if stats.frames_rendered >= start + 2 {
+                return Ok(stats);
+            }
+            assert!(Instant::now() < deadline, "no frames were rendered");
+            thread::sleep(Duration::from_millis(1));
+        }
+    }
+
     #[test]
     fn test_basic_creation() -> Result<(), Error> {
         let animation_data = get_test_animation();
@@ -67,6 +94,499 @@ mod tests {
         Ok(())
     }
 
+    #[test]
+    fn test_registered_messages() -> Result<(), Error> {
+        let splash = LottieSplash::new(&get_test_animation(), "Registered Messages Test", 0, 0)?;
+
+        let ids = ["Copying files...", "Registering components...", "Cleaning up..."]
+            .iter()
+            .map(|msg| splash.register_message(msg))
+            .collect::<Result<Vec<_>, _>>()?;
+
+        thread::scope(|scope| {
+            let handle = scope.spawn(|| {
+                for &id in ids.iter().cycle().take(9) {
+                    splash.set_status_message_id(id)?;
+                    thread::sleep(Duration::from_millis(100));
+                }
+                splash.set_status_message("Back to plain strings")?;
+                thread::sleep(Duration::from_millis(100));
+                splash.close_window()
+            });
+
+            splash.run_window()?;
+            handle.join().unwrap()
+        })?;
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_counter_templates() -> Result<(), Error> {
+        let splash = LottieSplash::new(&get_test_animation(), "Counter Test", 0, 0)?;
+
+        let id = splash.register_message("Copying file {0} of {1} ({2} MB/s)")?;
+        splash.set_status_message_id(id)?;
+        splash.set_counter(1, 5000)?;
+        assert!(matches!(
+            splash.set_counter(MAX_COUNTERS, 0),
+            Err(Error::InvalidArgument)
+        ));
+
+        thread::scope(|scope| {
+            let handle = scope.spawn(|| {
+                for file in 0..=5000u64 {
+                    splash.set_counter(0, file)?;
+                    splash.set_counter(2, 400 + file % 20)?;
+                    if file % 100 == 0 {
+                        thread::sleep(Duration::from_millis(10));
+                    }
+                }
+                splash.close_window()
+            });
+
+            splash.run_window()?;
+            handle.join().unwrap()
+        })?;
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_weighted_tasks() -> Result<(), Error> {
+        let splash = LottieSplash::new(&get_test_animation(), "Tasks Test", 0, 0)?;
+
+        for weight in [0.0, -1.0, f32::INFINITY, f32::NAN] {
+            assert!(matches!(
+                splash.add_task(weight),
+                Err(Error::InvalidArgument)
+            ));
+        }
+        // Each task stops at its own amount of work, (1 * 1.0 + 2 * 0.5 + 5 * 0.0) / 8.
+        let tasks = [
+            (splash.add_task(1.0)?, 100),
+            (splash.add_task(2.0)?, 50),
+            (splash.add_task(5.0)?, 0),
+        ];
+
+        thread::scope(|scope| {
+            let producers: Vec<_> = tasks
+                .iter()
+                .map(|(task, finished)| {
+                    scope.spawn(move || -> Result<(), Error> {
+                        for done in 0..=*finished {
+                            task.advance(done, 100)?;
+                            thread::sleep(Duration::from_millis(5));
+                        }
+                        Ok(())
+                    })
+                })
+                .collect();
+
+            let closer = scope.spawn(|| {
+                thread::sleep(Duration::from_millis(800));
+                splash.close_window()
+            });
+
+            splash.run_window()?;
+            for producer in producers {
+                producer.join().unwrap()?;
+            }
+            closer.join().unwrap()
+        })?;
+
+        let stats = splash.stats()?;
+        assert!(stats.progress_target.is_finite());
+        assert!((stats.progress_target - 0.25).abs() < 1e-6);
+        Ok(())
+    }
+
+    #[test]
+    #[cfg_attr(
+        not(feature = "virtual-clock"),
+        ignore = "needs a library built with --with-virtual-clock"
+    )]
+    fn test_progress_settles() -> Result<(), Error> {
+        let splash = virtual_clock_splash("Settle Test")?;
+
+        thread::scope(|scope| {
+            let driver = scope.spawn(|| -> Result<(), Error> {
+                splash.set_progress(0.5)?;
+                let mut previous = stats_after_next_frame(&splash)?;
+
+                // Every frame step moves the bar exactly once, until it lands exactly on its target.
+                let mut steps = 0;
+                while previous.displayed_progress != previous.progress_target {
+                    splash.advance_clock(FRAME)?;
+                    let stats = stats_after_next_frame(&splash)?;
+                    assert!(stats.displayed_progress > previous.displayed_progress);
+                    assert_eq!(
+                        stats.progress_bar_updates,
+                        previous.progress_bar_updates + 1
+                    );
+                    previous = stats;
+                    steps += 1;
+                    assert!(steps < 120, "the bar didn't settle within two seconds");
+                }
+
+                // After that it isn't drawn again, while the frames keep coming.
+                for _ in 0..10 {
+                    splash.advance_clock(FRAME)?;
+                    let stats = stats_after_next_frame(&splash)?;
+                    assert_eq!(stats.progress_bar_updates, previous.progress_bar_updates);
+                    assert_eq!(stats.displayed_progress, 0.5);
+                }
+                splash.close_window()
+            });
+
+            splash.run_window()?;
+            driver.join().unwrap()
+        })?;
+
+        Ok(())
+    }
+
+    #[test]
+    #[cfg_attr(
+        not(feature = "virtual-clock"),
+        ignore = "needs a library built with --with-virtual-clock"
+    )]
+    fn test_progress_retargeted_every_frame() -> Result<(), Error> {
+        let splash = virtual_clock_splash("Retarget Test")?;
+
+        thread::scope(|scope| {
+            let driver = scope.spawn(|| -> Result<(), Error> {
+                let mut previous = stats_after_next_frame(&splash)?;
+
+                // A target that creeps up with every frame, like many small tasks finishing. Retargeting keeps the
+                // bar's velocity, so it never stalls or jumps back.
+                for i in 1..=40 {
+                    splash.set_progress(i as f32 * 0.02)?;
+                    splash.advance_clock(FRAME)?;
+                    let stats = stats_after_next_frame(&splash)?;
+                    assert!(stats.displayed_progress > previous.displayed_progress);
+                    assert!(stats.displayed_progress < stats.progress_target);
+                    previous = stats;
+                }
+
+                splash.advance_clock(Duration::from_secs(2))?;
+                let settled = stats_after_next_frame(&splash)?;
+                assert!((settled.progress_target - 0.8).abs() < 1e-6);
+                assert_eq!(settled.displayed_progress, settled.progress_target);
+                splash.close_window()
+            });
+
+            splash.run_window()?;
+            driver.join().unwrap()
+        })?;
+
+        Ok(())
+    }
+
+    #[test]
+    #[cfg_attr(
+        any(not(feature = "virtual-clock"), feature = "opengl"),
+        ignore = "needs a library built with --with-virtual-clock and without --with-opengl"
+    )]
+    fn test_overlay_redrawn_only_on_change() -> Result<(), Error> {
+        let splash = virtual_clock_splash("Overlay Test")?;
+
+        thread::scope(|scope| {
+            let driver = scope.spawn(|| -> Result<(), Error> {
+                splash.set_status_message("Overlay")?;
+                splash.set_progress(0.5)?;
+                let mut previous = stats_after_next_frame(&splash)?;
+                assert!(previous.overlay_redraws > 0);
+
+                // The moving bar redraws the overlay until it settles.
+                let mut steps = 0;
+                while previous.displayed_progress != previous.progress_target {
+                    splash.advance_clock(FRAME)?;
+                    previous = stats_after_next_frame(&splash)?;
+                    steps += 1;
+                    assert!(steps < 120, "the bar didn't settle within two seconds");
+                }
+
+                // While the logo keeps moving underneath, the overlay is only blended.
+                for _ in 0..10 {
+                    splash.advance_clock(FRAME)?;
+                    let stats = stats_after_next_frame(&splash)?;
+                    assert_eq!(stats.overlay_redraws, previous.overlay_redraws);
+                }
+
+                // A new message is rasterized into it once.
+                splash.set_status_message("Overlay changed")?;
+                let changed = stats_after_next_frame(&splash)?;
+                assert_eq!(changed.overlay_redraws, previous.overlay_redraws + 1);
+                for _ in 0..10 {
+                    splash.advance_clock(FRAME)?;
+                    let stats = stats_after_next_frame(&splash)?;
+                    assert_eq!(stats.overlay_redraws, changed.overlay_redraws);
+                }
+                splash.close_window()
+            });
+
+            splash.run_window()?;
+            driver.join().unwrap()
+        })?;
+
+        Ok(())
+    }
+
+    #[test]
+    #[cfg_attr(
+        not(feature = "allocation-counter"),
+        ignore = "needs a library built with --with-allocation-counter"
+    )]
+    fn test_steady_frames_dont_allocate() -> Result<(), Error> {
+        let splash = LottieSplash::new(&get_test_animation(), "Allocation Test", 0, 0)?;
+
+        thread::scope(|scope| {
+            let driver = scope.spawn(|| -> Result<(), Error> {
+                splash.set_status_message("Loading {0} of 3")?;
+                let id = splash.register_message("Step {0}")?;
+                splash.set_status_message_id(id)?;
+                for step in 0..3 {
+                    splash.set_counter(0, step)?;
+                    splash.set_progress(step as f32 / 3.0)?;
+                    thread::sleep(Duration::from_millis(300));
+                }
+                let stats = splash.stats()?;
+
+                assert!(stats.frames_rendered > 0);
+                assert_eq!(stats.steady_frame_heap_allocations, 0);
+                splash.close_window()
+            });
+
+            splash.run_window()?;
+            driver.join().unwrap()
+        })?;
+
+        Ok(())
+    }
+
+    unsafe extern "C" fn unused_malloc(_size: usize, _user: *mut c_void) -> *mut c_void {
+        std::ptr::null_mut()
+    }
+
+    #[test]
+    #[cfg_attr(
+        not(feature = "custom-allocator"),
+        ignore = "needs a library built with --with-custom-allocator"
+    )]
+    fn test_memory_accounting() -> Result<(), Error> {
+        let _splash = LottieSplash::new(&get_test_animation(), "Memory Test", 0, 0)?;
+
+        let parser = memory_usage(MemorySubsystem::Parser)?;
+        assert!(parser.peak_bytes > 0);
+        assert!(parser.current_bytes <= parser.peak_bytes);
+        assert!(memory_usage(MemorySubsystem::Rasterizer)?.peak_bytes > 0);
+
+        // SAFETY: both calls are rejected before anything is installed.
+        unsafe {
+            let result = set_allocator(Some(unused_malloc), None, None, std::ptr::null_mut());
+            assert!(matches!(result, Err(Error::InvalidArgument)));
+            let result = set_allocator(None, None, None, std::ptr::null_mut());
+            assert!(matches!(result, Err(Error::AlreadyInitialized)));
+        }
+        Ok(())
+    }
+
+    #[test]
+    fn test_expression_detection() -> Result<(), Error> {
+        let splash = LottieSplash::new(&get_test_animation(), "Expressions Test", 0, 0)?;
+        let stats = splash.stats()?;
+        assert!(!stats.uses_expressions);
+        assert!(stats.animation_load_time > Duration::ZERO);
+
+        // A single rectangle whose position wiggles through an expression.
+        let expressions = br#"{"v":"5.7.4","fr":30,"ip":0,"op":60,"w":100,"h":100,"layers":[{"ty":4,"ind":1,"ip":0,
+            "op":60,"st":0,"ks":{"p":{"a":0,"k":[50,50],"x":"var $bm_rt = wiggle(2, 10);"}},"shapes":[{"ty":"rc",
+            "p":{"a":0,"k":[0,0]},"s":{"a":0,"k":[40,40]},"r":{"a":0,"k":0}},{"ty":"fl","c":{"a":0,"k":[1,0,0]},
+            "o":{"a":0,"k":100}}]}]}"#;
+        drop(splash);
+        let splash = LottieSplash::new(expressions, "Expressions Test", 0, 0)?;
+        assert!(splash.stats()?.uses_expressions);
+        Ok(())
+    }
+
+    #[test]
+    fn test_overdraw_heat_map() -> Result<(), Error> {
+        let splash = LottieSplash::new(&get_test_animation(), "Overdraw Test", 0, 0)?;
+        assert_eq!(splash.stats()?.overdraw_canvas_pixels, 0);
+        match splash.set_overdraw_heat_map(true) {
+            Err(Error::NotSupported) => return Ok(()),
+            result => result?,
+        }
+
+        thread::scope(|scope| {
+            let driver = scope.spawn(|| -> Result<(), Error> {
+                splash.set_status_message("Overdraw")?;
+                splash.set_progress(0.5)?;
+                thread::sleep(Duration::from_secs(2));
+                splash.close_window()
+            });
+
+            splash.run_window()?;
+            driver.join().unwrap()
+        })?;
+
+        // The background alone writes every pixel once, the logo and the overlay add to that.
+        let stats = splash.stats()?;
+        assert!(stats.overdraw_canvas_pixels > 0);
+        assert!(stats.overdraw_pixel_writes > stats.overdraw_canvas_pixels);
+        Ok(())
+    }
+
+    #[test]
+    fn test_static_layer_cache() -> Result<(), Error> {
+        // A square moving over a static badge, which can be drawn once and reused, under a static glow that's screened
+        // over both. The glow's blend mode needs what's drawn below it, so it can't be cached.
+        let animation = br#"{"v":"5.7.4","fr":30,"ip":0,"op":60,"w":100,"h":100,"layers":[{"ty":4,"nm":"glow",
+            "ind":3,"ip":0,"op":60,"st":0,"bm":3,"ks":{"p":{"a":0,"k":[50,50]}},"shapes":[{"ty":"el",
+            "p":{"a":0,"k":[0,0]},"s":{"a":0,"k":[60,60]}},{"ty":"fl","c":{"a":0,"k":[1,1,0]},"o":{"a":0,"k":50}}]},
+            {"ty":4,"nm":"square","ind":1,"ip":0,"op":60,"st":0,
+            "ks":{"p":{"a":1,"k":[{"t":0,"s":[20,50]},{"t":59,"s":[80,50]}]}},"shapes":[{"ty":"rc",
+            "p":{"a":0,"k":[0,0]},"s":{"a":0,"k":[20,20]},"r":{"a":0,"k":0}},{"ty":"fl",
+            "c":{"a":0,"k":[1,0,0]},"o":{"a":0,"k":100}}]},{"ty":4,"nm":"badge","ind":2,"ip":0,"op":60,"st":0,
+            "ks":{"p":{"a":0,"k":[50,50]}},"shapes":[{"ty":"el","p":{"a":0,"k":[0,0]},"s":{"a":0,"k":[80,80]}},
+            {"ty":"fl","c":{"a":0,"k":[0,0,1]},"o":{"a":0,"k":100}}]}]}"#;
+        let splash = LottieSplash::new(animation, "Static Layer Test", 0, 0)?;
+
+        thread::scope(|scope| {
+            let driver = scope.spawn(|| -> Result<(), Error> {
+                thread::sleep(Duration::from_secs(1));
+                splash.close_window()
+            });
+
+            splash.run_window()?;
+            driver.join().unwrap()
+        })?;
+
+        let stats = splash.stats()?;
+        assert!(stats.frames_rendered > 0);
+        assert_eq!(stats.cached_static_layers, 1);
+        Ok(())
+    }
+
+    #[test]
+    fn test_layer_profile() -> Result<(), Error> {
+        let splash = LottieSplash::new(&get_test_animation(), "Profile Test", 0, 0)?;
+        let path = std::env::temp_dir().join("lottie_splash_layer_profile.json");
+        let path = path.to_str().unwrap();
+
+        // Profiling is a build option, without it both calls have to say so instead of returning an empty profile.
+        match splash.layer_profile() {
+            Err(Error::NotSupported) => {
+                assert!(matches!(splash.write_layer_profile(path), Err(Error::NotSupported)));
+                return Ok(());
+            }
+            result => assert!(result?.iter().all(|layer| layer.samples == 0)),
+        }
+
+        thread::scope(|scope| {
+            let driver = scope.spawn(|| -> Result<(), Error> {
+                thread::sleep(Duration::from_secs(2));
+                splash.close_window()
+            });
+
+            splash.run_window()?;
+            driver.join().unwrap()
+        })?;
+
+        let layers = splash.layer_profile()?;
+        assert!(!layers.is_empty());
+        assert!(layers.iter().any(|layer| layer.samples > 0));
+        assert!(layers
+            .windows(2)
+            .all(|pair| pair[0].update_ms + pair[0].draw_ms >= pair[1].update_ms + pair[1].draw_ms));
+
+        splash.write_layer_profile(path)?;
+        let json = std::fs::read_to_string(path)?;
+        assert!(json.starts_with(r#"{"layers":["#));
+        assert!(json.contains(&format!(r#""name":"{}""#, layers[0].name)));
+        std::fs::remove_file(path)?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_cpu_budget() -> Result<(), Error> {
+        let splash = LottieSplash::new(&get_test_animation(), "Budget Test", 0, 0)?;
+
+        assert!(matches!(splash.set_cpu_budget(0.0), Err(Error::InvalidArgument)));
+        assert!(matches!(splash.set_cpu_budget(f32::NAN), Err(Error::InvalidArgument)));
+        splash.set_cpu_budget(1.0)?;
+
+        thread::scope(|scope| {
+            let driver = scope.spawn(|| -> Result<(), Error> {
+                splash.set_status_message("Throttled")?;
+                thread::sleep(Duration::from_secs(4));
+                let stats = splash.stats()?;
+
+                // A 1% budget is below what even a full quality frame costs, so the governor has to back off.
+                assert!(stats.quality_level_changes > 0);
+                assert_ne!(stats.quality_level, QualityLevel::Full);
+                assert!(stats.cpu_usage_percent < 25.0);
+                splash.close_window()
+            });
+
+            splash.run_window()?;
+            driver.join().unwrap()
+        })?;
+
+        Ok(())
+    }
+
+    #[test]
+    #[cfg_attr(
+        not(feature = "virtual-clock"),
+        ignore = "needs a library built with --with-virtual-clock"
+    )]
+    fn test_virtual_clock() -> Result<(), Error> {
+        let splash = virtual_clock_splash("Clock Test")?;
+
+        thread::scope(|scope| {
+            let driver = scope.spawn(|| -> Result<(), Error> {
+                splash.set_progress(0.5)?;
+                thread::sleep(Duration::from_millis(300));
+                let frozen = splash.stats()?;
+                thread::sleep(Duration::from_millis(300));
+                let still_frozen = splash.stats()?;
+
+                // Nothing moves while the clock stands still, no matter how many frames are drawn.
+                assert_eq!(frozen.time_to_first_frame, Duration::ZERO);
+                assert!(still_frozen.frames_rendered > frozen.frames_rendered);
+                assert_eq!(frozen.progress_bar_updates, still_frozen.progress_bar_updates);
+                assert!(still_frozen.repeated_source_frames > frozen.repeated_source_frames);
+                assert_eq!(still_frozen.skipped_source_frames, 0);
+
+                // Jumping past the settle time moves the bar exactly once, straight to its target.
+                splash.advance_clock(Duration::from_secs(2))?;
+                thread::sleep(Duration::from_millis(300));
+                let settled = splash.stats()?;
+                assert_eq!(settled.progress_bar_updates, still_frozen.progress_bar_updates + 1);
+                assert!(settled.skipped_source_frames > 0);
+
+                splash.close_window()
+            });
+
+            splash.run_window()?;
+            driver.join().unwrap()
+        })?;
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_wall_clock_cant_be_advanced() -> Result<(), Error> {
+        let splash = LottieSplash::new(&get_test_animation(), "Clock Test", 0, 0)?;
+        assert!(matches!(
+            splash.advance_clock(Duration::from_millis(1)),
+            Err(Error::InvalidArgument)
+        ));
+        Ok(())
+    }
+
     #[test]
     fn test_window_lifecycle() -> Result<(), Error> {
         let animation_data = get_test_animation();
@@ -157,6 +677,63 @@ mod tests {
         handle2.join().unwrap().unwrap();
     }
 
+    #[test]
+    fn test_poster_and_stats() -> Result<(), Error> {
+        let pixels = vec![0xFF202020u32; 64 * 64];
+        let options = CreateOptions {
+            poster: Some(Poster {
+                pixels: &pixels,
+                width: 64,
+                height: 64,
+            }),
+            ..Default::default()
+        };
+        let splash = LottieSplash::with_options(&get_test_animation(), "Poster Test", 0, 0, &options)?;
+
+        thread::scope(|scope| {
+            let handle = scope.spawn(|| {
+                thread::sleep(Duration::from_millis(500));
+                splash.close_window()
+            });
+
+            splash.run_window()?;
+            handle.join().unwrap()
+        })?;
+
+        let stats = splash.stats()?;
+        assert!(stats.frames_rendered > 0);
+        assert!(stats.time_to_first_pixel > Duration::ZERO);
+        assert!(stats.time_to_first_pixel <= stats.time_to_first_frame);
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_poster_too_small() {
+        let pixels = vec![0u32; 16];
+        let options = CreateOptions {
+            poster: Some(Poster {
+                pixels: &pixels,
+                width: 64,
+                height: 64,
+            }),
+            ..Default::default()
+        };
+        let result = LottieSplash::with_options(&get_test_animation(), "Poster Test", 0, 0, &options);
+        assert!(matches!(result, Err(Error::InvalidArgument)));
+    }
+
+    #[test]
+    fn test_font_fallback() -> Result<(), Error> {
+        // None of the paths exist, so the embedded font has to be used.
+        let options = CreateOptions {
+            font_search_paths: &["Z:\\does\\not\\exist.ttf"],
+            ..Default::default()
+        };
+        let _splash = LottieSplash::with_options(&get_test_animation(), "Font Test", 0, 0, &options)?;
+        Ok(())
+    }
+
     #[test]
     fn test_resource_cleanup() {
         use std::mem::drop;
@@ -6,6 +6,31 @@ newoption {
   description = "Use thorvg openGL backend instead of software"
 }
 
+newoption {
+  trigger = "with-virtual-clock",
+  description = "Allow driving the animation time through the C API, for tests and benchmarks"
+}
+
+newoption {
+  trigger = "with-custom-allocator",
+  description = "Let hosts route the heap allocations of the library and thorvg to their own allocator, and account heap memory per subsystem"
+}
+
+newoption {
+  trigger = "with-allocation-counter",
+  description = "Count heap allocations per frame, for tests. Implies --with-custom-allocator"
+}
+
+newoption {
+  trigger = "with-profiling",
+  description = "Measure what each animation layer costs to render, at one extra render per frame"
+}
+
+newoption {
+  trigger = "without-expressions",
+  description = "Leave out the JavaScript engine for lottie expressions, animations using them render without"
+}
+
 defines {
   "NOMINMAX",
   "WIN32_LEAN_AND_MEAN",
@@ -25,6 +50,41 @@ else
   }
 end
 
+if _OPTIONS["with-virtual-clock"] then
+  defines {
+    "LOTTIE_SPLASH_VIRTUAL_CLOCK"
+  }
+end
+
+if _OPTIONS["with-custom-allocator"] or _OPTIONS["with-allocation-counter"] then
+  defines {
+    "LOTTIE_SPLASH_CUSTOM_ALLOCATOR"
+  }
+end
+
+if _OPTIONS["with-allocation-counter"] then
+  defines {
+    "LOTTIE_SPLASH_COUNT_ALLOCATIONS"
+  }
+end
+
+if _OPTIONS["with-profiling"] then
+  defines {
+    "LOTTIE_SPLASH_PROFILING"
+  }
+end
+
+if _OPTIONS["without-expressions"] then
+  defines {
+    "LOTTIE_SPLASH_WITHOUT_EXPRESSIONS"
+  }
+else
+  defines {
+    -- Size of JerryScript's static heap in KiB, reported in the stats.
+    "JERRY_GLOBAL_HEAP_SIZE=512"
+  }
+end
+
 startproject "demo"
 
 filter "configurations:Release"
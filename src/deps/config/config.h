@@ -1,6 +1,8 @@
 #pragma once
 
+#ifndef LOTTIE_SPLASH_WITHOUT_EXPRESSIONS
 #define THORVG_LOTTIE_EXPRESSIONS_SUPPORT 1
+#endif
 
 #define THORVG_LOTTIE_LOADER_SUPPORT 1
 
@@ -12,6 +14,61 @@
 
 #define WIN32_LEAN_AND_MEAN 1
 
+#ifdef LOTTIE_SPLASH_CUSTOM_ALLOCATOR
+// thorvg's C allocations are renamed to go through the hooks, which lottie_splash points at the host's allocator. The C
+// runtime's headers come first, so their own declarations and inline functions keep the real names.
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "engine_heap.h"
+
+static inline void * lottie_splash_engine_malloc(size_t size) { return lottie_splash_engine_heap.malloc_fn(size); }
+
+static inline void * lottie_splash_engine_calloc(size_t count, size_t size) {
+    if(size && count > SIZE_MAX / size)
+        return NULL;
+    void * pointer = lottie_splash_engine_heap.malloc_fn(count * size);
+    if(pointer)
+        memset(pointer, 0, count * size);
+    return pointer;
+}
+
+static inline void * lottie_splash_engine_realloc(void * pointer, size_t size) {
+    return lottie_splash_engine_heap.realloc_fn(pointer, size);
+}
+
+static inline void lottie_splash_engine_free(void * pointer) { lottie_splash_engine_heap.free_fn(pointer); }
+
+static inline char * lottie_splash_engine_strdup(const char * string) {
+    const size_t size   = strlen(string) + 1;
+    char *       result = (char *)lottie_splash_engine_heap.malloc_fn(size);
+    if(result)
+        memcpy(result, string, size);
+    return result;
+}
+
+#ifdef __cplusplus
+#include <cstdlib>
+#include <cstring>
+
+// For the std:: qualified calls.
+namespace std {
+using ::lottie_splash_engine_calloc;
+using ::lottie_splash_engine_free;
+using ::lottie_splash_engine_malloc;
+using ::lottie_splash_engine_realloc;
+}
+#endif
+
+#define malloc  lottie_splash_engine_malloc
+#define calloc  lottie_splash_engine_calloc
+#define realloc lottie_splash_engine_realloc
+#define free    lottie_splash_engine_free
+#define strdup  lottie_splash_engine_strdup
+#define _strdup lottie_splash_engine_strdup
+#endif
+
 #ifdef THORVG_GL_RASTER_SUPPORT
 #include <glad/glad.h>
 #endif
@@ -0,0 +1,5 @@
+#include "engine_heap.h"
+
+#include <cstdlib>
+
+lottie_splash_engine_heap_hooks lottie_splash_engine_heap = {std::malloc, std::realloc, std::free};
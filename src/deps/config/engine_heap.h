@@ -0,0 +1,19 @@
+#pragma once
+
+// Hooks thorvg's C allocations go through in builds with --with-custom-allocator, see config.h. They start out as the C
+// runtime's functions, so tools linking thorvg without lottie_splash keep working, and lottie_splash replaces them.
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+typedef struct lottie_splash_engine_heap_hooks {
+    void * (*malloc_fn)(size_t size);
+    void * (*realloc_fn)(void * pointer, size_t size);
+    void (*free_fn)(void * pointer);
+} lottie_splash_engine_heap_hooks;
+
+extern lottie_splash_engine_heap_hooks lottie_splash_engine_heap;
+#ifdef __cplusplus
+}
+#endif
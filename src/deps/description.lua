@@ -44,11 +44,16 @@ removefiles {
 }
 
 files {
+  "src/deps/config/engine_heap.cpp",
   "src/deps/thorvg/src/loaders/lottie/**",
   "src/deps/thorvg/src/loaders/raw/**",
   "src/deps/thorvg/src/loaders/ttf/**",
 }
 
+if _OPTIONS["without-expressions"] then
+  removefiles {"src/deps/thorvg/src/loaders/lottie/jerryscript/**"}
+end
+
 if _OPTIONS["with-opengl"] then
   externalincludedirs {"src/deps/thorvg/src/renderer/gl_engine"}
   removefiles {"src/deps/thorvg/src/renderer/sw_engine/**"}
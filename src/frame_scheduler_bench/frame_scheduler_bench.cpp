@@ -0,0 +1,132 @@
+// Headless frame pacing benchmark. Runs a simulated render loop against the wall clock and reports how regular the
+// resulting frame intervals are, comparing the FrameScheduler with the old "sleep for the rest of the frame measured by
+// a tick counter" loop. Doesn't depend on any window system, so it runs anywhere:
+//   frame_scheduler_bench [frames] [fps]
+
+#include <utils/frame_scheduler.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+using namespace std::chrono;
+
+// GetTickCount advances in steps of the system timer period.
+constexpr nanoseconds TICK_COUNT_PERIOD{15'625'000};
+
+nanoseconds now() { return steady_clock::now().time_since_epoch(); }
+
+struct Result {
+    std::vector<nanoseconds> frame_starts;
+    uint64_t                 dropped_frames = 0;
+};
+
+// Render work is mostly short with occasional spikes, like a lottie frame with a heavy layer popping in.
+class Workload {
+  public:
+    explicit Workload(const nanoseconds interval) : _interval(interval) {}
+
+    void run() {
+        const double fraction = _spike(_rng) ? 1.6 : _work(_rng);
+        const auto   until    = now() + duration_cast<nanoseconds>(_interval * fraction);
+        while(now() < until)
+            ;
+    }
+
+  private:
+    nanoseconds                            _interval;
+    std::mt19937                           _rng{42};
+    std::uniform_real_distribution<double> _work{0.1, 0.5};
+    std::bernoulli_distribution            _spike{0.02};
+};
+
+Result run_tick_count_loop(const int frames, const nanoseconds interval) {
+    const auto tick_count = [] { return duration_cast<milliseconds>(now() / TICK_COUNT_PERIOD * TICK_COUNT_PERIOD); };
+    const auto frame_ms   = duration_cast<milliseconds>(interval);
+
+    Workload workload{interval};
+    Result   result;
+    for(int i = 0; i < frames; ++i) {
+        const auto start = tick_count();
+        result.frame_starts.push_back(now());
+        workload.run();
+
+        const auto elapsed = tick_count() - start;
+        if(elapsed < frame_ms)
+            std::this_thread::sleep_for(frame_ms - elapsed);
+    }
+    return result;
+}
+
+Result run_scheduler_loop(const int frames, const nanoseconds interval) {
+    utils::FrameScheduler scheduler{interval};
+    Workload              workload{interval};
+    Result                result;
+
+    scheduler.reset(now());
+    for(int i = 0; i < frames; ++i) {
+        scheduler.begin_frame(now());
+        result.frame_starts.push_back(now());
+        workload.run();
+
+        const auto deadline = scheduler.end_frame(now());
+        // Sleep coarsely, then spin for the last bit, as a high resolution waitable timer would.
+        constexpr nanoseconds SPIN_MARGIN{200'000};
+        if(const auto remaining = deadline - now(); remaining > SPIN_MARGIN)
+            std::this_thread::sleep_for(remaining - SPIN_MARGIN);
+        while(now() < deadline)
+            ;
+    }
+    result.dropped_frames = scheduler.stats().dropped_frames;
+    return result;
+}
+
+void report(const char * name, const Result & result, const nanoseconds interval) {
+    std::vector<double> errors_ms;
+    for(size_t i = 1; i < result.frame_starts.size(); ++i) {
+        const nanoseconds frame_time = result.frame_starts[i] - result.frame_starts[i - 1];
+        // Frames following a spike are expected to land on a later grid slot.
+        const auto slots = std::max<int64_t>(1, (frame_time + interval / 2) / interval);
+        errors_ms.push_back(std::abs(duration<double, std::milli>(frame_time - interval * slots).count()));
+    }
+    std::sort(errors_ms.begin(), errors_ms.end());
+
+    const auto   total   = result.frame_starts.back() - result.frame_starts.front();
+    const double fps     = (result.frame_starts.size() - 1) / duration<double>(total).count();
+    const auto   ideal   = interval * static_cast<int64_t>(result.frame_starts.size() - 1 + result.dropped_frames);
+    const double drift   = duration<double, std::milli>(total - ideal).count();
+    double       mean_ms = 0.0;
+    for(const double error : errors_ms)
+        mean_ms += error / errors_ms.size();
+
+    std::printf("%-12s fps %7.2f | jitter mean %6.3f ms p99 %6.3f ms max %6.3f ms | dropped %4llu | drift %8.3f ms\n",
+                name,
+                fps,
+                mean_ms,
+                errors_ms[errors_ms.size() * 99 / 100],
+                errors_ms.back(),
+                static_cast<unsigned long long>(result.dropped_frames),
+                drift);
+}
+}
+
+int main(int argc, char ** argv) {
+    const int frames = argc > 1 ? std::max(2, std::atoi(argv[1])) : 600;
+    const int fps    = argc > 2 ? std::max(1, std::atoi(argv[2])) : 120;
+
+    const nanoseconds interval{1'000'000'000 / fps};
+    std::printf("%d frames at %d fps target (%.3f ms interval)\n",
+                frames,
+                fps,
+                duration<double, std::milli>(interval).count());
+
+    report("tick count", run_tick_count_loop(frames, interval), interval);
+    report("scheduler", run_scheduler_loop(frames, interval), interval);
+    return 0;
+}
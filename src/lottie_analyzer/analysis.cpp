@@ -0,0 +1,351 @@
+#include "analysis.hpp"
+
+#include <lottie_tools/headless.hpp>
+#include <lottie_tools/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <unordered_map>
+
+namespace lottie_analyzer {
+namespace {
+using lottie_tools::number_member;
+using lottie_tools::string_member;
+
+using Clock     = std::chrono::steady_clock;
+using Value     = rapidjson::Value;
+using Allocator = rapidjson::Document::AllocatorType;
+
+constexpr int PRECOMP_LAYER = 0;
+constexpr int SOLID_LAYER   = 1;
+constexpr int GAUSSIAN_BLUR = 29;
+
+// Thresholds for the warnings.
+constexpr double   FULL_CANVAS_COVERAGE     = 0.9;
+constexpr double   EXPENSIVE_LAYER_SHARE    = 0.3;
+constexpr uint32_t DEEP_PRECOMP_NESTING     = 3;
+constexpr uint32_t COMPLEX_PATH_VERTICES    = 500;
+constexpr uint32_t MANY_ANIMATED_PROPERTIES = 500;
+
+uint32_t array_size(const Value & object, const char * name) {
+    if(!object.IsObject())
+        return 0;
+    const auto member = object.FindMember(name);
+    return member != object.MemberEnd() && member->value.IsArray() ? member->value.Size() : 0;
+}
+
+uint32_t path_vertices(const Value & path) {
+    const auto ks = path.FindMember("ks");
+    if(ks == path.MemberEnd() || !ks->value.IsObject())
+        return 0;
+
+    const auto k = ks->value.FindMember("k");
+    if(k == ks->value.MemberEnd())
+        return 0;
+    if(k->value.IsObject())
+        return array_size(k->value, "v");
+
+    uint32_t most = 0;
+    if(k->value.IsArray()) {
+        for(const auto & keyframe : k->value.GetArray()) {
+            if(!keyframe.IsObject())
+                continue;
+            const auto s = keyframe.FindMember("s");
+            if(s != keyframe.MemberEnd() && s->value.IsArray() && s->value.Size())
+                most = std::max(most, array_size(s->value[0], "v"));
+        }
+    }
+    return most;
+}
+
+void count_shapes(const Value & shapes, Analysis & analysis) {
+    if(!shapes.IsArray())
+        return;
+
+    for(const auto & shape : shapes.GetArray()) {
+        const std::string_view type = string_member(shape, "ty");
+        if(type.empty())
+            continue;
+
+        ++analysis.shapes;
+        if(type == "sh") {
+            ++analysis.paths;
+            analysis.max_path_vertices = std::max(analysis.max_path_vertices, path_vertices(shape));
+        } else if(const auto items = shape.FindMember("it"); type == "gr" && items != shape.MemberEnd()) {
+            count_shapes(items->value, analysis);
+        }
+    }
+}
+
+class Counter {
+  public:
+    Counter(const Value & document, Analysis & analysis) : _analysis(analysis) {
+        const auto assets = document.FindMember("assets");
+        if(assets == document.MemberEnd() || !assets->value.IsArray())
+            return;
+
+        for(const auto & asset : assets->value.GetArray()) {
+            if(!asset.IsObject())
+                continue;
+            if(const auto layers = asset.FindMember("layers"); layers != asset.MemberEnd()) {
+                _precomps.emplace(string_member(asset, "id"), &layers->value);
+                continue;
+            }
+
+            const std::string_view path = string_member(asset, "p");
+            if(path.starts_with("data:") || number_member(asset, "e", 0.0) != 0.0) {
+                ++analysis.embedded_assets;
+                analysis.embedded_asset_bytes += path.size();
+            } else if(!path.empty()) {
+                ++analysis.external_assets;
+            }
+        }
+    }
+
+    void count_layers(const Value & layers, const uint32_t depth) {
+        if(!layers.IsArray())
+            return;
+
+        _analysis.precomp_depth = std::max(_analysis.precomp_depth, depth);
+        for(const auto & layer : layers.GetArray()) {
+            if(!layer.IsObject())
+                continue;
+
+            ++_analysis.layers;
+            _analysis.mattes += number_member(layer, "tt", 0.0) != 0.0;
+            _analysis.masks += array_size(layer, "masksProperties");
+            if(const auto effects = layer.FindMember("ef"); effects != layer.MemberEnd() && effects->value.IsArray()) {
+                for(const auto & effect : effects->value.GetArray()) {
+                    ++_analysis.effects;
+                    if(number_member(effect, "ty", 0.0) == GAUSSIAN_BLUR)
+                        warn("layer \"" + std::string{string_member(layer, "nm")} +
+                             "\" has a gaussian blur, which is expensive to rasterize in software");
+                }
+            }
+            if(const auto shapes = layer.FindMember("shapes"); shapes != layer.MemberEnd())
+                count_shapes(shapes->value, _analysis);
+
+            if(number_member(layer, "ty", -1.0) != PRECOMP_LAYER)
+                continue;
+
+            ++_analysis.precomp_layers;
+            const std::string_view id      = string_member(layer, "refId");
+            const auto             precomp = _precomps.find(id);
+            if(precomp == _precomps.end())
+                continue;
+            if(std::find(_stack.begin(), _stack.end(), id) != _stack.end()) {
+                warn("precomp \"" + std::string{id} + "\" contains itself");
+                continue;
+            }
+            _stack.push_back(id);
+            count_layers(*precomp->second, depth + 1);
+            _stack.pop_back();
+        }
+    }
+
+  private:
+    void warn(std::string warning) {
+        if(std::find(_analysis.warnings.begin(), _analysis.warnings.end(), warning) == _analysis.warnings.end())
+            _analysis.warnings.push_back(std::move(warning));
+    }
+
+    Analysis &                                          _analysis;
+    std::unordered_map<std::string_view, const Value *> _precomps;
+    std::vector<std::string_view>                       _stack;
+};
+
+// A copy of the animation which only shows the top-level layer at `index`. Its parents are kept hidden for their
+// transforms, and its matte source is kept since the two are rasterized together.
+std::string isolate_layer(const rapidjson::Document & document, const size_t index) {
+    rapidjson::Document isolated;
+    auto &              allocator = isolated.GetAllocator();
+    isolated.CopyFrom(document, allocator);
+
+    const auto & layers = document["layers"];
+    Value        kept{rapidjson::kArrayType};
+    const auto   keep = [&](const Value & layer, const bool hidden) {
+        Value copy{layer, allocator};
+        if(hidden) {
+            copy.RemoveMember("hd");
+            copy.AddMember("hd", true, allocator);
+        }
+        kept.PushBack(copy, allocator);
+    };
+
+    const auto find_layer = [&](const double ind) -> const Value * {
+        for(const auto & candidate : layers.GetArray())
+            if(number_member(candidate, "ind", -1.0) == ind)
+                return &candidate;
+        return nullptr;
+    };
+
+    const Value & layer = layers[static_cast<rapidjson::SizeType>(index)];
+    if(number_member(layer, "tt", 0.0) != 0.0) {
+        // Newer exports name the matte source with "tp", older ones always put it right before the matted layer.
+        const double  source = number_member(layer, "tp", -1.0);
+        const Value * matte  = source >= 0.0 ? find_layer(source)
+                               : index > 0   ? &layers[static_cast<rapidjson::SizeType>(index - 1)]
+                                             : nullptr;
+        if(matte)
+            keep(*matte, false);
+    }
+    keep(layer, false);
+
+    std::vector<double> visited;
+    for(double parent = number_member(layer, "parent", -1.0); parent >= 0.0;) {
+        if(std::find(visited.begin(), visited.end(), parent) != visited.end())
+            break;
+        visited.push_back(parent);
+
+        const Value * found = find_layer(parent);
+        if(!found)
+            break;
+        keep(*found, true);
+        parent = number_member(*found, "parent", -1.0);
+    }
+
+    isolated["layers"] = kept;
+    return lottie_tools::to_json(isolated);
+}
+
+bool has_alpha(const uint32_t pixel) { return (pixel >> 24) != 0; }
+
+struct Measurement {
+    double frame_ms = 0.0;
+    double coverage = 0.0;
+};
+
+bool measure(const std::string_view json, const std::vector<float> & frames, Measurement & measurement) {
+    lottie_tools::HeadlessAnimation animation;
+    if(!animation.load(json))
+        return false;
+
+    Clock::duration total{};
+    for(const float frame : frames) {
+        const auto start = Clock::now();
+        if(!animation.render(frame))
+            return false;
+        total += Clock::now() - start;
+
+        const auto pixels    = animation.pixels();
+        const auto covered   = std::count_if(pixels.begin(), pixels.end(), has_alpha);
+        measurement.coverage = std::max(measurement.coverage, static_cast<double>(covered) / pixels.size());
+    }
+    measurement.frame_ms = std::chrono::duration<double, std::milli>(total).count() / frames.size();
+    return true;
+}
+}
+
+Result analyze(const std::string_view input, const uint32_t max_sampled_frames, Analysis & analysis) {
+    analysis = {};
+
+    rapidjson::Document document;
+    document.Parse(input.data(), input.size());
+    if(document.HasParseError() || !document.IsObject() || !document.HasMember("layers") ||
+       !document["layers"].IsArray())
+        return Result::InvalidInput;
+
+    analysis.width      = static_cast<float>(number_member(document, "w", 0.0));
+    analysis.height     = static_cast<float>(number_member(document, "h", 0.0));
+    analysis.frame_rate = static_cast<float>(number_member(document, "fr", 0.0));
+    analysis.frames     = number_member(document, "op", 0.0) - number_member(document, "ip", 0.0);
+
+    Counter counter{document, analysis};
+    counter.count_layers(document["layers"], 0);
+    lottie_tools::for_each_member(document, [&](Value & value, Value & parent, const std::string_view key) {
+        if(key == "x" && value.IsString() && value.GetStringLength())
+            ++analysis.expressions;
+        else if(key == "k" && value.IsArray() && number_member(parent, "a", 0.0) != 0.0) {
+            ++analysis.animated_properties;
+            analysis.keyframes += value.Size();
+        }
+    });
+
+    lottie_tools::Engine            engine;
+    lottie_tools::HeadlessAnimation animation;
+    if(!engine.initialized() || !animation.load(input))
+        return Result::RenderFailed;
+
+    // Spread evenly over the timeline, so long animations don't take forever to analyze.
+    const float        total_frames = animation.total_frames();
+    const uint32_t     samples = std::clamp<uint32_t>(static_cast<uint32_t>(total_frames), 1, max_sampled_frames);
+    std::vector<float> frames;
+    for(uint32_t i = 0; i < samples; ++i)
+        frames.push_back(std::floor(total_frames * i / samples));
+    analysis.sampled_frames = samples;
+
+    Measurement whole;
+    if(!measure(input, frames, whole))
+        return Result::RenderFailed;
+    analysis.frame_ms = whole.frame_ms;
+
+    {
+        rapidjson::Document empty;
+        empty.CopyFrom(document, empty.GetAllocator());
+        empty["layers"].Clear();
+        Measurement measurement;
+        if(!measure(lottie_tools::to_json(empty), frames, measurement))
+            return Result::RenderFailed;
+        analysis.empty_frame_ms = measurement.frame_ms;
+    }
+
+    const auto & layers = document["layers"].GetArray();
+    for(size_t i = 0; i < layers.Size(); ++i) {
+        const Value & layer = layers[static_cast<rapidjson::SizeType>(i)];
+        if(!layer.IsObject())
+            continue;
+        // Matte sources are measured together with the layer they matte, hidden layers don't render.
+        const auto hidden = layer.FindMember("hd");
+        if(number_member(layer, "td", 0.0) != 0.0 || (hidden != layer.MemberEnd() && hidden->value.IsTrue()))
+            continue;
+
+        LayerCost cost;
+        cost.name   = string_member(layer, "nm");
+        cost.type   = static_cast<int>(number_member(layer, "ty", -1.0));
+        cost.matted = number_member(layer, "tt", 0.0) != 0.0;
+        cost.masks  = array_size(layer, "masksProperties");
+
+        Measurement measurement;
+        if(!measure(isolate_layer(document, i), frames, measurement))
+            return Result::RenderFailed;
+        cost.frame_ms = measurement.frame_ms;
+        cost.coverage = measurement.coverage;
+        analysis.top_level_layers.push_back(std::move(cost));
+    }
+
+    auto &     warnings = analysis.warnings;
+    const auto quoted   = [](const std::string & name) { return "\"" + name + "\""; };
+    for(const LayerCost & cost : analysis.top_level_layers) {
+        const bool full_canvas = cost.coverage >= FULL_CANVAS_COVERAGE || cost.type == SOLID_LAYER;
+        if(cost.matted && full_canvas)
+            warnings.push_back("track matte on full-canvas layer " + quoted(cost.name));
+        if(cost.masks && full_canvas)
+            warnings.push_back("mask on full-canvas layer " + quoted(cost.name));
+
+        const double own_ms   = cost.frame_ms - analysis.empty_frame_ms;
+        const double total_ms = analysis.frame_ms - analysis.empty_frame_ms;
+        if(analysis.top_level_layers.size() > 1 && total_ms > 0.0 && own_ms > total_ms * EXPENSIVE_LAYER_SHARE)
+            warnings.push_back("layer " + quoted(cost.name) + " takes " +
+                               std::to_string(static_cast<int>(std::lround(own_ms * 100.0 / total_ms))) +
+                               "% of the frame");
+    }
+    if(analysis.expressions)
+        warnings.push_back(std::to_string(analysis.expressions) +
+                           " expressions need the JavaScript engine, try baking them with lottie_baker");
+    if(analysis.precomp_depth > DEEP_PRECOMP_NESTING)
+        warnings.push_back("precomps are nested " + std::to_string(analysis.precomp_depth) + " levels deep");
+    if(analysis.max_path_vertices > COMPLEX_PATH_VERTICES)
+        warnings.push_back("a path has " + std::to_string(analysis.max_path_vertices) + " vertices");
+    if(analysis.animated_properties > MANY_ANIMATED_PROPERTIES)
+        warnings.push_back(std::to_string(analysis.animated_properties) +
+                           " animated properties are interpolated on every frame");
+    if(analysis.embedded_assets)
+        warnings.push_back(std::to_string(analysis.embedded_assets) +
+                           " embedded images are decoded while the animation loads");
+    if(analysis.external_assets)
+        warnings.push_back(std::to_string(analysis.external_assets) +
+                           " images are loaded from files next to the animation");
+    return Result::Analyzed;
+}
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace lottie_analyzer {
+struct LayerCost {
+    std::string name;
+    int         type = -1;
+    // Rendering only this layer, with its parents and matte source, averaged over the sampled frames. Includes
+    // clearing the canvas, see Analysis::empty_frame_ms.
+    double frame_ms = 0.0;
+    // Largest fraction of the canvas the layer covered in any sampled frame.
+    double   coverage = 0.0;
+    bool     matted   = false;
+    uint32_t masks    = 0;
+};
+
+struct Analysis {
+    float  width      = 0.f;
+    float  height     = 0.f;
+    float  frame_rate = 0.f;
+    double frames     = 0.0;
+
+    // Counted over the whole document, including precomps.
+    uint32_t layers               = 0;
+    uint32_t precomp_layers       = 0;
+    uint32_t shapes               = 0;
+    uint32_t paths                = 0;
+    uint32_t animated_properties  = 0;
+    uint32_t keyframes            = 0;
+    uint32_t masks                = 0;
+    uint32_t mattes               = 0;
+    uint32_t expressions          = 0;
+    uint32_t effects              = 0;
+    uint32_t precomp_depth        = 0;
+    uint32_t max_path_vertices    = 0;
+    uint32_t embedded_assets      = 0;
+    uint64_t embedded_asset_bytes = 0;
+    uint32_t external_assets      = 0;
+
+    // Rendering the whole animation and an empty canvas of the same size, averaged over the sampled frames.
+    uint32_t sampled_frames = 0;
+    double   frame_ms       = 0.0;
+    double   empty_frame_ms = 0.0;
+
+    std::vector<LayerCost>   top_level_layers;
+    std::vector<std::string> warnings;
+};
+
+enum class Result {
+    Analyzed,
+    InvalidInput,
+    RenderFailed,
+};
+
+// Counts what the animation is made of, then renders the whole animation and each top-level layer on its own
+// headlessly, loading it the same way the splash window does, and derives warnings about what makes it slow.
+Result analyze(std::string_view input, uint32_t max_sampled_frames, Analysis & analysis);
+}
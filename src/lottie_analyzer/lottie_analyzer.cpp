@@ -0,0 +1,162 @@
+// Reports what a lottie animation is made of and what it costs to render with the software rasterizer, loading it the
+// same way the splash window does, plus warnings about the usual causes of slow animations. With --json the report is
+// printed as JSON for asset pipelines, and --strict fails when there are warnings:
+//   lottie_analyzer <animation.json> [--json] [--strict] [--frames <max sampled frames>]
+
+#include "analysis.hpp"
+
+#include <lottie_tools/json.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+
+namespace {
+constexpr uint32_t DEFAULT_SAMPLED_FRAMES = 120;
+
+const char * layer_type_name(const int type) {
+    constexpr const char * NAMES[] = {"precomp", "solid", "image", "null", "shape", "text"};
+    return type >= 0 && type < static_cast<int>(std::size(NAMES)) ? NAMES[type] : "other";
+}
+
+void print_text(const lottie_analyzer::Analysis & analysis) {
+    std::printf("%gx%g, %g frames at %g fps\n", analysis.width, analysis.height, analysis.frames, analysis.frame_rate);
+    std::printf("layers %u (precomps %u, nested %u deep), shapes %u, paths %u (most vertices %u)\n",
+                analysis.layers,
+                analysis.precomp_layers,
+                analysis.precomp_depth,
+                analysis.shapes,
+                analysis.paths,
+                analysis.max_path_vertices);
+    std::printf("animated properties %u, keyframes %u, expressions %u\n",
+                analysis.animated_properties,
+                analysis.keyframes,
+                analysis.expressions);
+    std::printf("masks %u, mattes %u, effects %u\n", analysis.masks, analysis.mattes, analysis.effects);
+    std::printf("embedded assets %u (%llu bytes), external assets %u\n",
+                analysis.embedded_assets,
+                static_cast<unsigned long long>(analysis.embedded_asset_bytes),
+                analysis.external_assets);
+    std::printf("\nframe %.3f ms, empty canvas %.3f ms, over %u sampled frames\n",
+                analysis.frame_ms,
+                analysis.empty_frame_ms,
+                analysis.sampled_frames);
+    std::printf("%-32s %-8s %10s %9s %s\n", "top-level layer", "type", "frame ms", "coverage", "");
+    for(const auto & layer : analysis.top_level_layers)
+        std::printf("%-32.32s %-8s %10.3f %8.1f%% %s%s\n",
+                    layer.name.c_str(),
+                    layer_type_name(layer.type),
+                    layer.frame_ms,
+                    layer.coverage * 100.0,
+                    layer.matted ? "matted " : "",
+                    layer.masks ? "masked" : "");
+
+    if(!analysis.warnings.empty())
+        std::printf("\n");
+    for(const auto & warning : analysis.warnings)
+        std::printf("warning: %s\n", warning.c_str());
+}
+
+void print_json(const lottie_analyzer::Analysis & analysis) {
+    rapidjson::Document document;
+    document.SetObject();
+    auto &     allocator = document.GetAllocator();
+    const auto string    = [&](const std::string & value) {
+        return rapidjson::Value{value.c_str(), static_cast<rapidjson::SizeType>(value.size()), allocator};
+    };
+
+    document.AddMember("width", analysis.width, allocator);
+    document.AddMember("height", analysis.height, allocator);
+    document.AddMember("frame_rate", analysis.frame_rate, allocator);
+    document.AddMember("frames", analysis.frames, allocator);
+    document.AddMember("layers", analysis.layers, allocator);
+    document.AddMember("precomp_layers", analysis.precomp_layers, allocator);
+    document.AddMember("precomp_depth", analysis.precomp_depth, allocator);
+    document.AddMember("shapes", analysis.shapes, allocator);
+    document.AddMember("paths", analysis.paths, allocator);
+    document.AddMember("max_path_vertices", analysis.max_path_vertices, allocator);
+    document.AddMember("animated_properties", analysis.animated_properties, allocator);
+    document.AddMember("keyframes", analysis.keyframes, allocator);
+    document.AddMember("expressions", analysis.expressions, allocator);
+    document.AddMember("masks", analysis.masks, allocator);
+    document.AddMember("mattes", analysis.mattes, allocator);
+    document.AddMember("effects", analysis.effects, allocator);
+    document.AddMember("embedded_assets", analysis.embedded_assets, allocator);
+    document.AddMember("embedded_asset_bytes", analysis.embedded_asset_bytes, allocator);
+    document.AddMember("external_assets", analysis.external_assets, allocator);
+    document.AddMember("sampled_frames", analysis.sampled_frames, allocator);
+    document.AddMember("frame_ms", analysis.frame_ms, allocator);
+    document.AddMember("empty_frame_ms", analysis.empty_frame_ms, allocator);
+
+    rapidjson::Value layers{rapidjson::kArrayType};
+    for(const auto & cost : analysis.top_level_layers) {
+        rapidjson::Value layer{rapidjson::kObjectType};
+        layer.AddMember("name", string(cost.name), allocator);
+        layer.AddMember("type", rapidjson::StringRef(layer_type_name(cost.type)), allocator);
+        layer.AddMember("frame_ms", cost.frame_ms, allocator);
+        layer.AddMember("coverage", cost.coverage, allocator);
+        layer.AddMember("matted", cost.matted, allocator);
+        layer.AddMember("masks", cost.masks, allocator);
+        layers.PushBack(layer, allocator);
+    }
+    document.AddMember("top_level_layers", layers, allocator);
+
+    rapidjson::Value warnings{rapidjson::kArrayType};
+    for(const auto & warning : analysis.warnings)
+        warnings.PushBack(string(warning), allocator);
+    document.AddMember("warnings", warnings, allocator);
+
+    std::printf("%s\n", lottie_tools::to_json(document).c_str());
+}
+}
+
+int main(int argc, char ** argv) {
+    const char * path        = nullptr;
+    bool         json        = false;
+    bool         strict      = false;
+    bool         usage_error = false;
+    uint32_t     frames      = DEFAULT_SAMPLED_FRAMES;
+    for(int i = 1; i < argc; ++i) {
+        if(std::strcmp(argv[i], "--json") == 0)
+            json = true;
+        else if(std::strcmp(argv[i], "--strict") == 0)
+            strict = true;
+        else if(std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+            frames = std::max<uint32_t>(1, static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10)));
+        else if(!path)
+            path = argv[i];
+        else
+            usage_error = true;
+    }
+    if(!path || usage_error) {
+        std::fprintf(stderr, "usage: lottie_analyzer <animation.json> [--json] [--strict] [--frames <count>]\n");
+        return EXIT_FAILURE;
+    }
+
+    std::string input;
+    if(!lottie_tools::read_file(std::filesystem::path{path}, input)) {
+        std::fprintf(stderr, "can't read %s\n", path);
+        return EXIT_FAILURE;
+    }
+
+    lottie_analyzer::Analysis analysis;
+    switch(lottie_analyzer::analyze(input, frames, analysis)) {
+    case lottie_analyzer::Result::InvalidInput:
+        std::fprintf(stderr, "%s isn't a lottie animation\n", path);
+        return EXIT_FAILURE;
+    case lottie_analyzer::Result::RenderFailed:
+        std::fprintf(stderr, "rendering %s headlessly failed\n", path);
+        return EXIT_FAILURE;
+    case lottie_analyzer::Result::Analyzed:
+        break;
+    }
+
+    if(json)
+        print_json(analysis);
+    else
+        print_text(analysis);
+    return strict && !analysis.warnings.empty() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+namespace lottie_baker {
+// 2D affine transform, laid out like the top two rows of tvg::Matrix: x' = e11 x + e12 y + e13.
+struct Affine {
+    float e11 = 1.f, e12 = 0.f, e13 = 0.f;
+    float e21 = 0.f, e22 = 1.f, e23 = 0.f;
+};
+
+inline Affine multiply(const Affine & a, const Affine & b) noexcept {
+    return {a.e11 * b.e11 + a.e12 * b.e21,
+            a.e11 * b.e12 + a.e12 * b.e22,
+            a.e11 * b.e13 + a.e12 * b.e23 + a.e13,
+            a.e21 * b.e11 + a.e22 * b.e21,
+            a.e21 * b.e12 + a.e22 * b.e22,
+            a.e21 * b.e13 + a.e22 * b.e23 + a.e23};
+}
+
+inline std::optional<Affine> invert(const Affine & m) noexcept {
+    const double determinant = static_cast<double>(m.e11) * m.e22 - static_cast<double>(m.e12) * m.e21;
+    if(std::abs(determinant) < 1e-12)
+        return std::nullopt;
+
+    const double inverse = 1.0 / determinant;
+    const auto   e11     = static_cast<float>(m.e22 * inverse);
+    const auto   e12     = static_cast<float>(-m.e12 * inverse);
+    const auto   e21     = static_cast<float>(-m.e21 * inverse);
+    const auto   e22     = static_cast<float>(m.e11 * inverse);
+    return Affine{e11, e12, -(e11 * m.e13 + e12 * m.e23), e21, e22, -(e21 * m.e13 + e22 * m.e23)};
+}
+
+// Lottie's transform without anchor and skew: translate * rotate * scale, rotation in degrees and scale in percent.
+struct LayerTransform {
+    float x        = 0.f;
+    float y        = 0.f;
+    float rotation = 0.f;
+    float scale_x  = 100.f;
+    float scale_y  = 100.f;
+};
+
+// Fails when the transform is skewed, which needs lottie's skew properties that aren't reproduced exactly.
+inline std::optional<LayerTransform> decompose(const Affine & m) noexcept {
+    constexpr double PI = 3.14159265358979323846;
+
+    const double angle     = std::atan2(static_cast<double>(m.e21), static_cast<double>(m.e11));
+    const double cos_angle = std::cos(angle);
+    const double sin_angle = std::sin(angle);
+    const double scale_x   = std::hypot(static_cast<double>(m.e11), static_cast<double>(m.e21));
+    const double shear     = cos_angle * m.e12 + sin_angle * m.e22;
+    const double scale_y   = -sin_angle * m.e12 + cos_angle * m.e22;
+    if(std::abs(shear) > 1e-4 * std::max(std::abs(scale_y), 1.0))
+        return std::nullopt;
+
+    return LayerTransform{m.e13,
+                          m.e23,
+                          static_cast<float>(angle * 180.0 / PI),
+                          static_cast<float>(scale_x * 100.0),
+                          static_cast<float>(scale_y * 100.0)};
+}
+}
@@ -0,0 +1,345 @@
+#include "baker.hpp"
+#include "affine.hpp"
+
+#include <lottie_tools/headless.hpp>
+#include <lottie_tools/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <span>
+#include <unordered_map>
+
+namespace lottie_baker {
+namespace {
+using lottie_tools::number_member;
+using lottie_tools::string_member;
+
+using Value     = rapidjson::Value;
+using Allocator = rapidjson::Document::AllocatorType;
+
+// Transform properties which are replaced by a single baked matrix. Opacity is baked on its own.
+constexpr std::array<const char *, 7> MATRIX_PROPERTIES = {"p", "a", "s", "r", "sk", "sa", "rz"};
+
+bool is_expression(const Value & value) { return value.IsString() && value.GetStringLength() > 0; }
+
+uint32_t count_expressions(const Value & property) {
+    if(!property.IsObject())
+        return 0;
+
+    uint32_t count = 0;
+    if(const auto x = property.FindMember("x"); x != property.MemberEnd()) {
+        if(is_expression(x->value))
+            ++count;
+        else // A position split into separate x and y properties, each of which can have its own expression.
+            count += count_expressions(x->value);
+    }
+    if(const auto y = property.FindMember("y"); y != property.MemberEnd())
+        count += count_expressions(y->value);
+    return count;
+}
+
+void set_member(Value & object, const char * name, Value && value, Allocator & allocator) {
+    if(const auto member = object.FindMember(name); member != object.MemberEnd())
+        member->value = value;
+    else
+        object.AddMember(rapidjson::StringRef(name), value, allocator);
+}
+
+Value number_array(const std::span<const float> values, Allocator & allocator) {
+    Value array{rapidjson::kArrayType};
+    for(const float value : values)
+        array.PushBack(static_cast<double>(value), allocator);
+    return array;
+}
+
+// A property holding `components` floats per sample. Samples equal to their predecessor are dropped, and a property
+// that never changes becomes static.
+Value sampled_property(const std::span<const float> times,
+                       const std::span<const float> samples,
+                       const size_t                 components,
+                       Allocator &                  allocator) {
+    const auto sample = [&](const size_t i) { return samples.subspan(i * components, components); };
+
+    Value keyframes{rapidjson::kArrayType};
+    for(size_t i = 0; i < times.size(); ++i) {
+        if(i && std::ranges::equal(sample(i), sample(i - 1)))
+            continue;
+
+        Value keyframe{rapidjson::kObjectType};
+        keyframe.AddMember("t", static_cast<double>(times[i]), allocator);
+        keyframe.AddMember("s", number_array(sample(i), allocator), allocator);
+        keyframe.AddMember("h", 1, allocator);
+        keyframes.PushBack(keyframe, allocator);
+    }
+
+    Value property{rapidjson::kObjectType};
+    if(keyframes.Size() > 1) {
+        property.AddMember("a", 1, allocator);
+        property.AddMember("k", keyframes, allocator);
+    } else {
+        property.AddMember("a", 0, allocator);
+        if(components == 1)
+            property.AddMember("k", static_cast<double>(sample(0)[0]), allocator);
+        else
+            property.AddMember("k", number_array(sample(0), allocator), allocator);
+    }
+    return property;
+}
+
+struct Layer {
+    Value *     json = nullptr;
+    std::string name;
+    int64_t     index                 = -1;
+    int64_t     parent                = -1;
+    bool        three_d               = false;
+    uint32_t    transform_expressions = 0;
+    uint32_t    opacity_expressions   = 0;
+    bool        bake_transform        = false;
+    bool        bake_opacity          = false;
+
+    const tvg::Paint *   paint = nullptr;
+    std::vector<Affine>  world;
+    std::vector<uint8_t> opacity;
+};
+
+std::unordered_map<std::string, uint32_t> count_layer_names(Value & document) {
+    std::unordered_map<std::string, uint32_t> names;
+    lottie_tools::for_each_member(document, [&](Value & value, Value &, const std::string_view key) {
+        if(key != "layers" || !value.IsArray())
+            return;
+        for(const auto & layer : value.GetArray())
+            if(layer.IsObject())
+                ++names[std::string{string_member(layer, "nm")}];
+    });
+    return names;
+}
+
+// Transforms of parented layers depend on each other, so a layer's matrix is only baked together with all layers it's
+// connected to by parenting. Returns the family as indices into `layers`, or an empty vector with `reason` set.
+std::vector<size_t> transform_family(const std::vector<Layer> &                        layers,
+                                     const size_t                                      start,
+                                     const std::unordered_map<int64_t, size_t> &       by_index,
+                                     const std::unordered_map<std::string, uint32_t> & names,
+                                     std::string &                                     reason) {
+    std::vector<size_t> family{start};
+    for(size_t i = 0; i < family.size(); ++i) {
+        const Layer & layer = layers[family[i]];
+        if(layer.name.empty() || names.at(layer.name) != 1) {
+            reason = "layer name \"" + layer.name + "\" isn't unique, so its paint can't be found";
+            return {};
+        }
+        if(layer.three_d) {
+            reason = "layer \"" + layer.name + "\" is 3D";
+            return {};
+        }
+
+        const auto add = [&](const size_t candidate) {
+            if(std::find(family.begin(), family.end(), candidate) == family.end())
+                family.push_back(candidate);
+        };
+        if(layer.parent >= 0) {
+            const auto parent = by_index.find(layer.parent);
+            if(parent == by_index.end()) {
+                reason = "the parent of layer \"" + layer.name + "\" doesn't exist";
+                return {};
+            }
+            add(parent->second);
+        }
+        for(size_t candidate = 0; candidate < layers.size(); ++candidate)
+            if(layer.index >= 0 && layers[candidate].parent == layer.index)
+                add(candidate);
+    }
+    return family;
+}
+}
+
+Result bake(const std::string_view input, const Options & options, std::string & output, Report & report) {
+    report = {};
+
+    rapidjson::Document document;
+    document.Parse(input.data(), input.size());
+    if(document.HasParseError() || !document.IsObject() || !document.HasMember("layers") ||
+       !document["layers"].IsArray())
+        return Result::InvalidInput;
+
+    lottie_tools::for_each_member(document, [&](Value & value, Value &, const std::string_view key) {
+        if(key == "x" && is_expression(value))
+            ++report.expressions;
+    });
+    if(!report.expressions)
+        return Result::NothingToBake;
+
+    const double first_frame = number_member(document, "ip", 0.0);
+    const double last_frame  = number_member(document, "op", 0.0);
+    const auto   names       = count_layer_names(document);
+
+    std::vector<Layer>                  layers;
+    std::unordered_map<int64_t, size_t> by_index;
+    for(auto & json : document["layers"].GetArray()) {
+        if(!json.IsObject())
+            continue;
+
+        Layer layer;
+        layer.json    = &json;
+        layer.name    = string_member(json, "nm");
+        layer.index   = static_cast<int64_t>(number_member(json, "ind", -1.0));
+        layer.parent  = static_cast<int64_t>(number_member(json, "parent", -1.0));
+        layer.three_d = number_member(json, "ddd", 0.0) != 0.0;
+        if(const auto ks = json.FindMember("ks"); ks != json.MemberEnd() && ks->value.IsObject()) {
+            for(const char * property : MATRIX_PROPERTIES)
+                if(const auto member = ks->value.FindMember(property); member != ks->value.MemberEnd())
+                    layer.transform_expressions += count_expressions(member->value);
+            if(const auto member = ks->value.FindMember("o"); member != ks->value.MemberEnd())
+                layer.opacity_expressions = count_expressions(member->value);
+        }
+        if(layer.index >= 0)
+            by_index.emplace(layer.index, layers.size());
+        layers.push_back(std::move(layer));
+    }
+
+    for(size_t i = 0; i < layers.size(); ++i) {
+        Layer & layer = layers[i];
+        if(layer.transform_expressions && !layer.bake_transform) {
+            std::string reason;
+            const auto  family = transform_family(layers, i, by_index, names, reason);
+            if(family.empty())
+                report.skipped.push_back("transform of \"" + layer.name + "\": " + reason);
+            for(const size_t member : family)
+                layers[member].bake_transform = true;
+        }
+        if(layer.opacity_expressions) {
+            if(!layer.name.empty() && names.at(layer.name) == 1)
+                layer.bake_opacity = true;
+            else
+                report.skipped.push_back("opacity of \"" + layer.name + "\": layer name isn't unique");
+        }
+    }
+
+    lottie_tools::Engine            engine;
+    lottie_tools::HeadlessAnimation original;
+    if(!engine.initialized() || !original.load(input))
+        return Result::RenderFailed;
+
+    auto * picture = original.animation()->picture();
+    for(Layer & layer : layers) {
+        if(!layer.bake_transform && !layer.bake_opacity)
+            continue;
+        layer.paint = picture->paint(tvg::Accessor::id(layer.name.c_str()));
+        if(!layer.paint) {
+            report.skipped.push_back("layer \"" + layer.name + "\" isn't part of the rendered scene");
+            layer.bake_transform = layer.bake_opacity = false;
+        }
+    }
+
+    // Whole frames only, splash windows showing the result are expected to set quantize_frames.
+    std::vector<float> frames;
+    for(double frame = std::ceil(first_frame); frame < last_frame; ++frame)
+        frames.push_back(static_cast<float>(frame));
+    report.frames = static_cast<uint32_t>(frames.size());
+
+    for(const float frame : frames) {
+        if(!original.update(frame - static_cast<float>(first_frame)))
+            return Result::RenderFailed;
+
+        for(Layer & layer : layers) {
+            if(!layer.paint)
+                continue;
+            // thorvg only hands out const paints, reading the matrix doesn't change anything.
+            const tvg::Matrix & m = const_cast<tvg::Paint *>(layer.paint)->transform();
+            layer.world.push_back({m.e11, m.e12, m.e13, m.e21, m.e22, m.e23});
+            layer.opacity.push_back(layer.paint->opacity());
+        }
+    }
+
+    auto & allocator = document.GetAllocator();
+    for(Layer & layer : layers) {
+        if(!layer.bake_transform && !layer.bake_opacity)
+            continue;
+
+        // Keyframe times are in the layer's own time.
+        const double       start   = number_member(*layer.json, "st", 0.0);
+        const double       stretch = number_member(*layer.json, "sr", 1.0);
+        std::vector<float> times;
+        for(const float frame : frames)
+            times.push_back(static_cast<float>((frame - start) / (stretch != 0.0 ? stretch : 1.0)));
+
+        if(!layer.json->HasMember("ks"))
+            layer.json->AddMember("ks", Value{rapidjson::kObjectType}, allocator);
+        auto & ks    = (*layer.json)["ks"];
+        bool   baked = false;
+        if(layer.bake_transform) {
+            std::vector<float> positions;
+            std::vector<float> rotations;
+            std::vector<float> scales;
+            const Layer *      parent = layer.parent >= 0 ? &layers[by_index.at(layer.parent)] : nullptr;
+            for(size_t i = 0; i < frames.size(); ++i) {
+                Affine local = layer.world[i];
+                if(parent) {
+                    const auto inverse = invert(parent->world[i]);
+                    local              = inverse ? multiply(*inverse, local) : Affine{0.f, 0.f, 0.f, 0.f, 0.f, 0.f};
+                }
+                const auto transform = decompose(local);
+                if(!transform) {
+                    // Leaves the expressions of this layer in place, the validation reports what that does to its
+                    // children.
+                    report.skipped.push_back("transform of \"" + layer.name + "\": skewed at frame " +
+                                             std::to_string(static_cast<int64_t>(frames[i])));
+                    positions.clear();
+                    break;
+                }
+                positions.insert(positions.end(), {transform->x, transform->y});
+                rotations.push_back(transform->rotation);
+                scales.insert(scales.end(), {transform->scale_x, transform->scale_y});
+            }
+
+            if(!positions.empty()) {
+                for(const char * property : MATRIX_PROPERTIES)
+                    ks.RemoveMember(property);
+                set_member(ks, "p", sampled_property(times, positions, 2, allocator), allocator);
+                set_member(ks, "r", sampled_property(times, rotations, 1, allocator), allocator);
+                set_member(ks, "s", sampled_property(times, scales, 2, allocator), allocator);
+                // The sampled rotation already includes auto-orientation.
+                set_member(*layer.json, "ao", Value{0}, allocator);
+                report.baked_expressions += layer.transform_expressions;
+                baked = true;
+            }
+        }
+
+        if(layer.bake_opacity) {
+            // thorvg turns percent into 0-255 by multiplying with 2.55, the quarter keeps the same value whether it
+            // truncates or rounds.
+            std::vector<float> opacities;
+            for(const uint8_t opacity : layer.opacity)
+                opacities.push_back((opacity + 0.25f) / 2.55f);
+            set_member(ks, "o", sampled_property(times, opacities, 1, allocator), allocator);
+            report.baked_expressions += layer.opacity_expressions;
+            baked = true;
+        }
+        report.baked_layers += baked;
+    }
+
+    if(!report.baked_expressions)
+        return Result::NothingToBake;
+
+    output = lottie_tools::to_json(document);
+
+    lottie_tools::HeadlessAnimation baked;
+    if(!baked.load(output) || baked.width() != original.width() || baked.height() != original.height())
+        return Result::RenderFailed;
+
+    for(const float frame : frames) {
+        const float position = frame - static_cast<float>(first_frame);
+        if(!original.render(position) || !baked.render(position))
+            return Result::RenderFailed;
+
+        const auto difference = lottie_tools::compare(original.pixels(), baked.pixels());
+        auto &     worst      = report.worst;
+        report.differing_frames += difference.differing_pixels > 0;
+        worst.differing_pixels       = std::max(worst.differing_pixels, difference.differing_pixels);
+        worst.max_channel_difference = std::max(worst.max_channel_difference, difference.max_channel_difference);
+        worst.psnr                   = std::min(worst.psnr, difference.psnr);
+    }
+    return report.worst.max_channel_difference <= options.tolerance ? Result::Baked : Result::ValidationFailed;
+}
+}
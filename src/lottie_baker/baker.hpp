@@ -0,0 +1,41 @@
+#pragma once
+
+#include <lottie_tools/compare.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace lottie_baker {
+struct Options {
+    // Largest difference of any color channel between the original and the baked animation that still counts as
+    // identical.
+    uint32_t tolerance = 0;
+};
+
+struct Report {
+    uint32_t expressions       = 0;
+    uint32_t baked_expressions = 0;
+    uint32_t baked_layers      = 0;
+    uint32_t frames            = 0;
+    // Why expressions were left in place, one line per layer or family of parented layers.
+    std::vector<std::string> skipped;
+    // Worst value of each measure over all frames of the headless comparison.
+    lottie_tools::Difference worst;
+    uint32_t                 differing_frames = 0;
+};
+
+enum class Result {
+    Baked,
+    NothingToBake,
+    InvalidInput,
+    RenderFailed,
+    ValidationFailed,
+};
+
+// Replaces expressions on the transform and opacity of top-level layers with hold keyframes sampled on every frame,
+// then renders the original and the baked animation headlessly and compares them frame by frame. Expressions anywhere
+// else, e.g. on shapes or inside precomps, are kept and listed in the report.
+Result bake(std::string_view input, const Options & options, std::string & output, Report & report);
+}
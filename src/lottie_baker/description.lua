@@ -0,0 +1,11 @@
+kind "ConsoleApp"
+links {"lottie_tools", "deps"}
+dependson {"lottie_tools"}
+runtime "Release"
+
+externalincludedirs {
+  "src",
+  "src/deps/thorvg/inc",
+  "src/deps/config/",
+  "src/deps/thorvg/src/loaders/lottie",
+}
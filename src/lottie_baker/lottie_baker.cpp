@@ -0,0 +1,81 @@
+// Offline expression baker. Evaluates the expressions on the transforms and opacities of an animation's top-level
+// layers at every frame and writes a copy in which they are replaced by hold keyframes, so the splash never has to run
+// the expression engine for it. The copy is only written when it renders identically to the original:
+//   lottie_baker <input.json> <output.json> [--tolerance <max channel difference>]
+
+#include "baker.hpp"
+
+#include <lottie_tools/json.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+
+namespace {
+void print_report(const lottie_baker::Report & report) {
+    std::printf("%u expressions, %u baked on %u layers over %u frames\n",
+                report.expressions,
+                report.baked_expressions,
+                report.baked_layers,
+                report.frames);
+    for(const auto & reason : report.skipped)
+        std::printf("  kept %s\n", reason.c_str());
+    if(report.baked_expressions)
+        std::printf("validation: %u of %u frames differ, max channel difference %u, worst PSNR %.2f dB\n",
+                    report.differing_frames,
+                    report.frames,
+                    report.worst.max_channel_difference,
+                    report.worst.psnr);
+}
+}
+
+int main(int argc, char ** argv) {
+    if(argc != 3 && !(argc == 5 && std::strcmp(argv[3], "--tolerance") == 0)) {
+        std::fprintf(stderr, "usage: lottie_baker <input.json> <output.json> [--tolerance <max channel difference>]\n");
+        return EXIT_FAILURE;
+    }
+
+    lottie_baker::Options options;
+    if(argc == 5)
+        options.tolerance = static_cast<uint32_t>(std::strtoul(argv[4], nullptr, 10));
+
+    const std::filesystem::path input_path{argv[1]};
+    const std::filesystem::path output_path{argv[2]};
+    std::string                 input;
+    if(!lottie_tools::read_file(input_path, input)) {
+        std::fprintf(stderr, "can't read %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    std::string          output;
+    lottie_baker::Report report;
+    const auto           result = lottie_baker::bake(input, options, output, report);
+    switch(result) {
+    case lottie_baker::Result::InvalidInput:
+        std::fprintf(stderr, "%s isn't a lottie animation\n", argv[1]);
+        return EXIT_FAILURE;
+    case lottie_baker::Result::RenderFailed:
+        std::fprintf(stderr, "rendering %s headlessly failed\n", argv[1]);
+        return EXIT_FAILURE;
+    case lottie_baker::Result::NothingToBake:
+        print_report(report);
+        std::printf("nothing to bake, %s left unchanged\n", argv[2]);
+        return report.expressions ? EXIT_FAILURE : EXIT_SUCCESS;
+    case lottie_baker::Result::ValidationFailed:
+        print_report(report);
+        std::fprintf(stderr, "the baked animation renders differently, %s left unchanged\n", argv[2]);
+        return EXIT_FAILURE;
+    case lottie_baker::Result::Baked:
+        break;
+    }
+
+    print_report(report);
+    if(!lottie_tools::write_file(output_path, output)) {
+        std::fprintf(stderr, "can't write %s\n", argv[2]);
+        return EXIT_FAILURE;
+    }
+    if(report.baked_expressions == report.expressions)
+        std::printf("no expressions left, the result can be used with a build made --without-expressions\n");
+    return EXIT_SUCCESS;
+}
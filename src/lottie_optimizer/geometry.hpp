@@ -0,0 +1,143 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace lottie_optimizer {
+struct Point {
+    double x = 0.0;
+    double y = 0.0;
+};
+
+// A lottie bezier path: vertices with in and out tangents relative to them.
+struct BezierPath {
+    std::vector<Point> vertices;
+    std::vector<Point> in_tangents;
+    std::vector<Point> out_tangents;
+    bool               closed = false;
+};
+
+struct Rect {
+    double x      = 0.0;
+    double y      = 0.0;
+    double width  = 0.0;
+    double height = 0.0;
+};
+
+inline bool is_zero(const Point & p) noexcept { return p.x == 0.0 && p.y == 0.0; }
+
+inline double distance_to_segment(const Point & p, const Point & a, const Point & b) noexcept {
+    const double dx      = b.x - a.x;
+    const double dy      = b.y - a.y;
+    const double squared = dx * dx + dy * dy;
+    const double t       = squared > 0.0 ? std::clamp(((p.x - a.x) * dx + (p.y - a.y) * dy) / squared, 0.0, 1.0) : 0.0;
+    return std::hypot(p.x - (a.x + t * dx), p.y - (a.y + t * dy));
+}
+
+// Ramer-Douglas-Peucker over a polyline, clearing `keep` for the points between the ends which can go.
+inline void simplify_polyline(const std::span<const Point> points, const double tolerance, std::vector<bool> & keep) {
+    std::vector<std::pair<size_t, size_t>> ranges{{0, points.size() - 1}};
+    while(!ranges.empty()) {
+        const auto [first, last] = ranges.back();
+        ranges.pop_back();
+
+        size_t farthest = first;
+        double distance = 0.0;
+        for(size_t i = first + 1; i < last; ++i) {
+            if(const double d = distance_to_segment(points[i], points[first], points[last]); d > distance) {
+                farthest = i;
+                distance = d;
+            }
+        }
+
+        if(farthest == first || distance <= tolerance) {
+            std::fill(keep.begin() + first + 1, keep.begin() + last, false);
+            continue;
+        }
+        ranges.emplace_back(first, farthest);
+        ranges.emplace_back(farthest, last);
+    }
+}
+
+// Which vertices of the path to keep. Only vertices between two straight segments are candidates, so curves stay
+// exactly as they are. Returns all true when too few vertices would be left to enclose anything.
+inline std::vector<bool> simplify(const BezierPath & path, const double tolerance) {
+    const size_t      count = path.vertices.size();
+    std::vector<bool> keep(count, true);
+    if(count < 3)
+        return keep;
+
+    const size_t segments = path.closed ? count : count - 1;
+    const auto   straight = [&](const size_t segment) {
+        return is_zero(path.out_tangents[segment % count]) && is_zero(path.in_tangents[(segment + 1) % count]);
+    };
+
+    // A closed path is walked from a vertex behind a curve, so no straight run is split at the seam. If there's no
+    // curve at all, the whole outline is one run from vertex 0 around to itself.
+    size_t start = 0;
+    if(path.closed) {
+        for(size_t i = 0; i < count; ++i) {
+            if(!straight(i + count - 1)) {
+                start = i;
+                break;
+            }
+        }
+    }
+
+    std::vector<Point> run;
+    std::vector<bool>  run_keep;
+    for(size_t done = 0; done < segments;) {
+        const size_t first = start + done;
+        size_t       length = 0;
+        while(done + length < segments && straight(first + length))
+            ++length;
+        if(length < 2) {
+            done += std::max<size_t>(length, 1);
+            continue;
+        }
+
+        run.clear();
+        for(size_t i = 0; i <= length; ++i)
+            run.push_back(path.vertices[(first + i) % count]);
+        run_keep.assign(run.size(), true);
+        simplify_polyline(run, tolerance, run_keep);
+        for(size_t i = 1; i < length; ++i)
+            keep[(first + i) % count] = run_keep[i];
+        done += length;
+    }
+
+    const auto kept = static_cast<size_t>(std::count(keep.begin(), keep.end(), true));
+    if(kept < (path.closed ? 3u : 2u))
+        keep.assign(count, true);
+    return keep;
+}
+
+// The rectangle a closed path outlines, if it's axis-aligned and has straight edges.
+inline std::optional<Rect> as_rect(const BezierPath & path) {
+    if(!path.closed || path.vertices.size() != 4)
+        return std::nullopt;
+    for(size_t i = 0; i < 4; ++i) {
+        if(!is_zero(path.in_tangents[i]) || !is_zero(path.out_tangents[i]))
+            return std::nullopt;
+    }
+
+    const auto & v           = path.vertices;
+    const auto [left, right] = std::minmax({v[0].x, v[1].x, v[2].x, v[3].x});
+    const auto [top, bottom] = std::minmax({v[0].y, v[1].y, v[2].y, v[3].y});
+    if(left == right || top == bottom)
+        return std::nullopt;
+
+    // Every vertex on a corner, and each edge along an axis, which also rules out a bow tie through the corners.
+    for(size_t i = 0; i < 4; ++i) {
+        const Point & p    = path.vertices[i];
+        const Point & next = path.vertices[(i + 1) % 4];
+        if((p.x != left && p.x != right) || (p.y != top && p.y != bottom) || (p.x != next.x) == (p.y != next.y))
+            return std::nullopt;
+    }
+    return Rect{left, top, right - left, bottom - top};
+}
+}
@@ -0,0 +1,109 @@
+// Offline lottie optimizer. Rewrites an animation so the software rasterizer has less to do: invisible layers go,
+// static shape layers are merged, straight path runs lose redundant vertices, rectangle masks become precomp clips and
+// redundant keyframes are dropped. Every pass is checked by rendering all frames headlessly against the original:
+//   lottie_optimizer <input.json> <output.json> [--min-psnr <dB>] [--path-tolerance <units>]
+
+#include "optimizer.hpp"
+
+#include <lottie_tools/json.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+
+namespace {
+double to_ms(const std::chrono::nanoseconds duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+void print_usage() {
+    std::fprintf(stderr,
+                 "usage: lottie_optimizer <input.json> <output.json> [--min-psnr <dB>] [--path-tolerance <units>]\n");
+}
+
+void print_pass(const lottie_optimizer::PassReport & pass) {
+    if(!pass.changes) {
+        std::printf("  %-26s nothing to do\n", pass.name);
+        return;
+    }
+    std::printf("  %-26s %5u changes, %s, ", pass.name, pass.changes, pass.kept ? "kept" : "rejected");
+    if(std::isinf(pass.worst.psnr))
+        std::printf("renders identically\n");
+    else
+        std::printf("worst PSNR %.2f dB\n", pass.worst.psnr);
+}
+
+void print_report(const lottie_optimizer::Report & report) {
+    std::printf("%u frames\n", report.frames);
+    for(const auto & pass : report.passes)
+        print_pass(pass);
+    if(!report.output_bytes)
+        return;
+
+    std::printf("validation: max channel difference %u, worst PSNR %.2f dB\n",
+                report.worst.max_channel_difference,
+                report.worst.psnr);
+    std::printf("size %zu -> %zu bytes\n", report.input_bytes, report.output_bytes);
+    const double original_ms  = to_ms(report.original_render_time) / report.frames;
+    const double optimized_ms = to_ms(report.optimized_render_time) / report.frames;
+    std::printf("rendering a frame %.3f ms -> %.3f ms, %.2fx\n",
+                original_ms,
+                optimized_ms,
+                optimized_ms > 0.0 ? original_ms / optimized_ms : 1.0);
+}
+}
+
+int main(int argc, char ** argv) {
+    if(argc < 3 || argc % 2 == 0) {
+        print_usage();
+        return EXIT_FAILURE;
+    }
+
+    lottie_optimizer::Options options;
+    for(int i = 3; i < argc; i += 2) {
+        if(std::strcmp(argv[i], "--min-psnr") == 0) {
+            options.min_psnr = std::strtod(argv[i + 1], nullptr);
+        } else if(std::strcmp(argv[i], "--path-tolerance") == 0) {
+            options.path_tolerance = std::strtod(argv[i + 1], nullptr);
+        } else {
+            print_usage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    const std::filesystem::path input_path{argv[1]};
+    const std::filesystem::path output_path{argv[2]};
+    std::string                 input;
+    if(!lottie_tools::read_file(input_path, input)) {
+        std::fprintf(stderr, "can't read %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    std::string              output;
+    lottie_optimizer::Report report;
+    const auto               result = lottie_optimizer::optimize(input, options, output, report);
+    switch(result) {
+    case lottie_optimizer::Result::InvalidInput:
+        std::fprintf(stderr, "%s isn't a lottie animation\n", argv[1]);
+        return EXIT_FAILURE;
+    case lottie_optimizer::Result::RenderFailed:
+        std::fprintf(stderr, "rendering %s headlessly failed\n", argv[1]);
+        return EXIT_FAILURE;
+    case lottie_optimizer::Result::NothingToOptimize:
+        print_report(report);
+        std::printf("nothing to optimize, %s left unchanged\n", argv[2]);
+        return EXIT_SUCCESS;
+    case lottie_optimizer::Result::Optimized:
+        break;
+    }
+
+    print_report(report);
+    if(!lottie_tools::write_file(output_path, output)) {
+        std::fprintf(stderr, "can't write %s\n", argv[2]);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,134 @@
+#include "optimizer.hpp"
+#include "passes.hpp"
+
+#include <lottie_tools/headless.hpp>
+#include <lottie_tools/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace lottie_optimizer {
+namespace {
+using Clock = std::chrono::steady_clock;
+
+struct Pass {
+    const char * name;
+    uint32_t (*run)(rapidjson::Document &, const Options &);
+};
+
+// Passes which remove things come first, so the ones after them have less to look at.
+constexpr std::array<Pass, 5> PASSES = {{
+    {"remove invisible layers", remove_invisible_layers},
+    {"merge static shape layers", merge_static_shape_layers},
+    {"simplify paths", simplify_paths},
+    {"masks to clips", masks_to_clips},
+    {"quantize keyframes", quantize_keyframes},
+}};
+
+// Runs with fewer repetitions than this are too noisy to compare two files.
+constexpr int TIMING_RUNS = 3;
+
+bool parse(const std::string_view json, rapidjson::Document & document) {
+    document.Parse(json.data(), json.size());
+    return !document.HasParseError() && document.IsObject() && document.HasMember("layers") &&
+           document["layers"].IsArray();
+}
+
+// Renders both animations at every frame and returns the worst of each measure, or false when either fails to render.
+bool compare_frames(lottie_tools::HeadlessAnimation & original,
+                    lottie_tools::HeadlessAnimation & candidate,
+                    const std::vector<float> &        frames,
+                    lottie_tools::Difference &        worst) {
+    worst = {};
+    for(const float frame : frames) {
+        if(!original.render(frame) || !candidate.render(frame))
+            return false;
+
+        const auto difference        = lottie_tools::compare(original.pixels(), candidate.pixels());
+        worst.differing_pixels       = std::max(worst.differing_pixels, difference.differing_pixels);
+        worst.max_channel_difference = std::max(worst.max_channel_difference, difference.max_channel_difference);
+        worst.psnr                   = std::min(worst.psnr, difference.psnr);
+    }
+    return true;
+}
+
+// Time to render every frame once, the best of a few runs.
+bool render_time(lottie_tools::HeadlessAnimation & animation,
+                 const std::vector<float> &        frames,
+                 std::chrono::nanoseconds &        best) {
+    best = std::chrono::nanoseconds::max();
+    for(int run = 0; run < TIMING_RUNS; ++run) {
+        const auto start = Clock::now();
+        for(const float frame : frames) {
+            if(!animation.render(frame))
+                return false;
+        }
+        best = std::min(best, std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start));
+    }
+    return true;
+}
+}
+
+Result optimize(const std::string_view input, const Options & options, std::string & output, Report & report) {
+    report = {};
+    output.clear();
+    report.input_bytes = input.size();
+
+    rapidjson::Document document;
+    if(!parse(input, document))
+        return Result::InvalidInput;
+
+    lottie_tools::Engine            engine;
+    lottie_tools::HeadlessAnimation original;
+    if(!engine.initialized() || !original.load(input))
+        return Result::RenderFailed;
+
+    // Whole frames only, splash windows showing the result are expected to set quantize_frames.
+    const double       first_frame = lottie_tools::number_member(document, "ip", 0.0);
+    const double       last_frame  = lottie_tools::number_member(document, "op", 0.0);
+    std::vector<float> frames;
+    for(double frame = std::ceil(first_frame); frame < last_frame; ++frame)
+        frames.push_back(static_cast<float>(frame - first_frame));
+    if(frames.empty())
+        return Result::InvalidInput;
+    report.frames = static_cast<uint32_t>(frames.size());
+
+    // Every pass starts from the last accepted version. Each is checked against the original rather than against the
+    // previous version, so small differences can't add up over several passes unnoticed.
+    std::string current{input};
+    for(const Pass & pass : PASSES) {
+        PassReport & pass_report = report.passes.emplace_back();
+        pass_report.name         = pass.name;
+
+        if(!parse(current, document))
+            return Result::InvalidInput;
+        pass_report.changes = pass.run(document, options);
+        if(!pass_report.changes)
+            continue;
+
+        std::string                     candidate_json = lottie_tools::to_json(document);
+        lottie_tools::HeadlessAnimation candidate;
+        if(!candidate.load(candidate_json) || candidate.width() != original.width() ||
+           candidate.height() != original.height() || !compare_frames(original, candidate, frames, pass_report.worst))
+            continue;
+
+        pass_report.kept = pass_report.worst.psnr >= options.min_psnr;
+        if(pass_report.kept)
+            current = std::move(candidate_json);
+    }
+
+    if(std::none_of(report.passes.begin(), report.passes.end(), [](const PassReport & pass) { return pass.kept; }))
+        return Result::NothingToOptimize;
+
+    lottie_tools::HeadlessAnimation optimized;
+    if(!optimized.load(current) || !compare_frames(original, optimized, frames, report.worst) ||
+       !render_time(original, frames, report.original_render_time) ||
+       !render_time(optimized, frames, report.optimized_render_time))
+        return Result::RenderFailed;
+
+    output              = std::move(current);
+    report.output_bytes = output.size();
+    return Result::Optimized;
+}
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <lottie_tools/compare.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace lottie_optimizer {
+struct Options {
+    // Lowest PSNR in dB any frame may have against the original for a rewrite to count as visually identical.
+    double min_psnr = 45.0;
+    // How far, in the layer's own units, a path's outline may move when vertices on straight runs are dropped.
+    double path_tolerance = 0.25;
+    // Keyframe values closer than this count as equal.
+    double value_epsilon = 0.001;
+};
+
+struct PassReport {
+    const char * name = "";
+    // Layers, vertices, masks or keyframes the pass removed or rewrote.
+    uint32_t changes = 0;
+    // Whether the rewrite rendered like the original and was kept.
+    bool                     kept = false;
+    lottie_tools::Difference worst;
+};
+
+struct Report {
+    std::vector<PassReport> passes;
+    uint32_t                frames       = 0;
+    size_t                  input_bytes  = 0;
+    size_t                  output_bytes = 0;
+    // Worst value of each measure over all frames, between the original and the final result.
+    lottie_tools::Difference worst;
+    // Rendering every frame once with the software rasterizer, the best of a few runs.
+    std::chrono::nanoseconds original_render_time{};
+    std::chrono::nanoseconds optimized_render_time{};
+};
+
+enum class Result {
+    Optimized,
+    NothingToOptimize,
+    InvalidInput,
+    RenderFailed,
+};
+
+// Runs the rewriting passes one after another. After each pass that changed something, the result is rendered
+// headlessly next to the original at every frame and only kept if no frame falls below the PSNR bound, so a pass which
+// doesn't suit an animation is skipped without losing the others.
+Result optimize(std::string_view input, const Options & options, std::string & output, Report & report);
+}
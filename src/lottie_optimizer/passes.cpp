@@ -0,0 +1,524 @@
+#include "passes.hpp"
+#include "geometry.hpp"
+
+#include <lottie_tools/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace lottie_optimizer {
+namespace {
+using lottie_tools::number_member;
+using lottie_tools::string_member;
+
+using Value     = rapidjson::Value;
+using Allocator = rapidjson::Document::AllocatorType;
+
+// Layer transform properties, as they appear in a shape group's transform as well.
+constexpr std::array<const char *, 7> TRANSFORM_PROPERTIES = {"p", "a", "s", "r", "o", "sk", "sa"};
+
+const Value * find(const Value & object, const char * name) {
+    if(!object.IsObject())
+        return nullptr;
+    const auto member = object.FindMember(name);
+    return member != object.MemberEnd() ? &member->value : nullptr;
+}
+
+Value * find(Value & object, const char * name) {
+    return const_cast<Value *>(find(static_cast<const Value &>(object), name));
+}
+
+bool is_set(const Value & object, const char * name) {
+    const auto * value = find(object, name);
+    return value && ((value->IsBool() && value->GetBool()) || (value->IsNumber() && value->GetDouble() != 0.0));
+}
+
+bool is_non_empty_array(const Value * value) { return value && value->IsArray() && !value->Empty(); }
+
+void set_member(Value & object, const char * name, Value && value, Allocator & allocator) {
+    if(auto * member = find(object, name))
+        *member = value;
+    else
+        object.AddMember(rapidjson::StringRef(name), value, allocator);
+}
+
+bool is_keyframes(const Value & k) { return k.IsArray() && !k.Empty() && k[0].IsObject() && k[0].HasMember("t"); }
+
+bool has_expression(const Value & property) {
+    const auto * x = find(property, "x");
+    return x && x->IsString() && x->GetStringLength() > 0;
+}
+
+// The value of a property which isn't animated, or null.
+const Value * static_value(const Value * property) {
+    if(!property || !property->IsObject() || has_expression(*property) || is_set(*property, "a"))
+        return nullptr;
+    const auto * k = find(*property, "k");
+    return k && !is_keyframes(*k) ? k : nullptr;
+}
+
+// A static number, or the first component of a static array of numbers.
+std::optional<double> static_number(const Value * property) {
+    const auto * value = static_value(property);
+    if(value && value->IsArray() && !value->Empty())
+        value = &(*value)[0];
+    return value && value->IsNumber() ? std::optional{value->GetDouble()} : std::nullopt;
+}
+
+std::optional<Point> static_point(const Value * property) {
+    const auto * value = static_value(property);
+    if(!value || !value->IsArray() || value->Size() < 2 || !(*value)[0].IsNumber() || !(*value)[1].IsNumber())
+        return std::nullopt;
+    return Point{(*value)[0].GetDouble(), (*value)[1].GetDouble()};
+}
+
+Value static_property(Value && k, Allocator & allocator) {
+    Value property{rapidjson::kObjectType};
+    property.AddMember("a", 0, allocator);
+    property.AddMember("k", k, allocator);
+    return property;
+}
+
+Value point_value(const Point & point, Allocator & allocator) {
+    Value array{rapidjson::kArrayType};
+    array.PushBack(point.x, allocator);
+    array.PushBack(point.y, allocator);
+    return array;
+}
+
+Value translation(const Point & offset, Allocator & allocator) {
+    Value ks{rapidjson::kObjectType};
+    ks.AddMember("p", static_property(point_value(offset, allocator), allocator), allocator);
+    ks.AddMember("a", static_property(point_value({}, allocator), allocator), allocator);
+    ks.AddMember("s", static_property(point_value({100.0, 100.0}, allocator), allocator), allocator);
+    ks.AddMember("r", static_property(Value{0}, allocator), allocator);
+    ks.AddMember("o", static_property(Value{100}, allocator), allocator);
+    return ks;
+}
+
+std::optional<BezierPath> read_path(const Value & k) {
+    const auto * vertices = find(k, "v");
+    const auto * in       = find(k, "i");
+    const auto * out      = find(k, "o");
+    if(!vertices || !in || !out || !vertices->IsArray() || !in->IsArray() || !out->IsArray() ||
+       in->Size() != vertices->Size() || out->Size() != vertices->Size())
+        return std::nullopt;
+
+    BezierPath path;
+    path.closed = is_set(k, "c");
+    for(const auto & [array, points] : {std::pair{vertices, &path.vertices},
+                                        std::pair{in, &path.in_tangents},
+                                        std::pair{out, &path.out_tangents}}) {
+        for(const auto & point : array->GetArray()) {
+            if(!point.IsArray() || point.Size() < 2 || !point[0].IsNumber() || !point[1].IsNumber())
+                return std::nullopt;
+            points->push_back({point[0].GetDouble(), point[1].GetDouble()});
+        }
+    }
+    return path;
+}
+
+template <typename Visitor>
+void for_each_layer_array(Value & document, Visitor && visit) {
+    if(auto * layers = find(document, "layers"); layers && layers->IsArray())
+        visit(*layers, true);
+    if(auto * assets = find(document, "assets"); assets && assets->IsArray()) {
+        for(auto & asset : assets->GetArray()) {
+            if(auto * layers = find(asset, "layers"); layers && layers->IsArray())
+                visit(*layers, false);
+        }
+    }
+}
+
+// Indices other layers in the same array refer to, as parent or as matte.
+std::set<int64_t> referenced_layers(const Value & layers) {
+    std::set<int64_t> referenced;
+    for(const auto & layer : layers.GetArray()) {
+        for(const char * reference : {"parent", "tp"}) {
+            if(const auto * index = find(layer, reference); index && index->IsNumber())
+                referenced.insert(static_cast<int64_t>(index->GetDouble()));
+        }
+    }
+    return referenced;
+}
+
+bool is_referenced(const Value & layer, const std::set<int64_t> & referenced) {
+    const auto * index = find(layer, "ind");
+    return index && index->IsNumber() && referenced.contains(static_cast<int64_t>(index->GetDouble()));
+}
+
+// Whether the layer takes part in a track matte, either as the matte or as the layer drawn through it.
+bool in_track_matte(const Value & layers, const rapidjson::SizeType i) {
+    const Value & layer = layers[i];
+    return is_set(layer, "td") || is_set(layer, "tt") || find(layer, "tp") ||
+           (i + 1 < layers.Size() && is_set(layers[i + 1], "tt"));
+}
+
+bool is_invisible(const Value & layer, const bool top_level, const double first_frame, const double last_frame) {
+    if(is_set(layer, "hd"))
+        return true;
+    if(const auto * ks = find(layer, "ks"); ks && static_number(find(*ks, "o")) == 0.0)
+        return true;
+
+    const auto * in  = find(layer, "ip");
+    const auto * out = find(layer, "op");
+    if(!in || !out || !in->IsNumber() || !out->IsNumber())
+        return false;
+    return in->GetDouble() >= out->GetDouble() ||
+           (top_level && (out->GetDouble() <= first_frame || in->GetDouble() >= last_frame));
+}
+
+bool is_static_transform(const Value & ks) {
+    if(!ks.IsObject())
+        return false;
+    for(const auto & member : ks.GetObject()) {
+        if(!static_value(&member.value))
+            return false;
+    }
+    return true;
+}
+
+bool can_merge(const Value & layers, const rapidjson::SizeType i, const std::set<int64_t> & referenced) {
+    const Value & layer = layers[i];
+    const auto *  ks    = find(layer, "ks");
+    return number_member(layer, "ty", -1.0) == 4.0 && find(layer, "shapes") && find(layer, "shapes")->IsArray() &&
+           !is_set(layer, "hd") && !is_set(layer, "ddd") && !is_set(layer, "ao") && !is_set(layer, "bm") &&
+           !find(layer, "parent") && !is_referenced(layer, referenced) && !in_track_matte(layers, i) &&
+           !is_non_empty_array(find(layer, "masksProperties")) && !is_non_empty_array(find(layer, "ef")) && ks &&
+           is_static_transform(*ks) && static_number(find(*ks, "o")).value_or(100.0) == 100.0;
+}
+
+bool same_timing(const Value & a, const Value & b) {
+    for(const char * name : {"ip", "op", "st"}) {
+        if(number_member(a, name, 0.0) != number_member(b, name, 0.0))
+            return false;
+    }
+    return number_member(a, "sr", 1.0) == number_member(b, "sr", 1.0);
+}
+
+// Moves the layer's shapes into a group which applies the layer's transform.
+Value transform_group(Value & layer, Allocator & allocator) {
+    Value items{rapidjson::kArrayType};
+    for(auto & shape : (*find(layer, "shapes")).GetArray())
+        items.PushBack(shape, allocator);
+
+    Value transform{rapidjson::kObjectType};
+    transform.AddMember("ty", "tr", allocator);
+    if(const auto * ks = find(layer, "ks")) {
+        for(const char * property : TRANSFORM_PROPERTIES) {
+            if(const auto * value = find(*ks, property))
+                transform.AddMember(rapidjson::StringRef(property), Value{*value, allocator}, allocator);
+        }
+    }
+    items.PushBack(transform, allocator);
+
+    Value group{rapidjson::kObjectType};
+    group.AddMember("ty", "gr", allocator);
+    group.AddMember("it", items, allocator);
+    return group;
+}
+
+bool values_close(const Value & a, const Value & b, const double epsilon) {
+    if(a.IsNumber() && b.IsNumber())
+        return std::abs(a.GetDouble() - b.GetDouble()) <= epsilon;
+    if(a.IsArray() && b.IsArray()) {
+        if(a.Size() != b.Size())
+            return false;
+        for(rapidjson::SizeType i = 0; i < a.Size(); ++i) {
+            if(!values_close(a[i], b[i], epsilon))
+                return false;
+        }
+        return true;
+    }
+    if(a.IsObject() && b.IsObject()) {
+        if(a.MemberCount() != b.MemberCount())
+            return false;
+        for(const auto & member : a.GetObject()) {
+            const auto * other = find(b, member.name.GetString());
+            if(!other || !values_close(member.value, *other, epsilon))
+                return false;
+        }
+        return true;
+    }
+    return a == b;
+}
+
+// Numbers, lists of numbers and paths. Text documents and anything else keyframed stays as it is.
+bool is_plain_value(const Value & value) {
+    if(value.IsNumber())
+        return true;
+    if(!value.IsArray() || value.Empty())
+        return false;
+    if(value.Size() == 1 && value[0].IsObject())
+        return value[0].HasMember("v");
+    return std::all_of(value.Begin(), value.End(), [](const Value & component) { return component.IsNumber(); });
+}
+
+// Position keyframes can move along a curve between two equal values.
+bool has_spatial_tangents(const Value & keyframe) {
+    for(const char * name : {"to", "ti"}) {
+        if(const auto * tangent = find(keyframe, name); tangent && tangent->IsArray()) {
+            for(const auto & component : tangent->GetArray()) {
+                if(!component.IsNumber() || component.GetDouble() != 0.0)
+                    return true;
+            }
+        }
+    }
+    return false;
+}
+
+uint32_t quantize_property(Value & property, const double epsilon, Allocator & allocator) {
+    auto & keyframes = *find(property, "k");
+    for(const auto & keyframe : keyframes.GetArray()) {
+        // The older format stores each segment's end value in "e", which the rules below don't cover.
+        if(!keyframe.IsObject() || keyframe.HasMember("e"))
+            return 0;
+        if(const auto * value = find(keyframe, "s"); value && !is_plain_value(*value))
+            return 0;
+    }
+
+    const auto * first_value = find(keyframes[0], "s");
+    if(!first_value)
+        return 0;
+    const bool constant = std::all_of(keyframes.Begin(), keyframes.End(), [&](const Value & keyframe) {
+        const auto * value = find(keyframe, "s");
+        return !has_spatial_tangents(keyframe) && (!value || values_close(*value, *first_value, epsilon));
+    });
+    if(constant) {
+        // Static single numbers are stored bare, paths as the path object itself.
+        const Value & source  = first_value->IsArray() && first_value->Size() == 1 ? (*first_value)[0] : *first_value;
+        Value         value   = Value{source, allocator};
+        const auto    removed = keyframes.Size();
+        set_member(property, "k", std::move(value), allocator);
+        set_member(property, "a", Value{0}, allocator);
+        return removed;
+    }
+
+    // Keyframe i can go when the stretch from i - 1 to i + 1 holds its value either way: both neighbors have the same
+    // value, or both segments are holds.
+    uint32_t removed = 0;
+    for(rapidjson::SizeType i = 1; i + 1 < keyframes.Size();) {
+        const auto & previous = keyframes[i - 1];
+        const auto & current  = keyframes[i];
+        const auto & next     = keyframes[i + 1];
+        const auto * previous_value = find(previous, "s");
+        const auto * current_value  = find(current, "s");
+        const auto * next_value     = find(next, "s");
+        const bool   holds          = is_set(previous, "h") && is_set(current, "h");
+        if(previous_value && current_value && next_value && !has_spatial_tangents(previous) &&
+           !has_spatial_tangents(current) && values_close(*previous_value, *current_value, epsilon) &&
+           (holds || values_close(*current_value, *next_value, epsilon))) {
+            keyframes.Erase(keyframes.Begin() + i);
+            ++removed;
+        } else {
+            ++i;
+        }
+    }
+    return removed;
+}
+}
+
+uint32_t remove_invisible_layers(rapidjson::Document & document, const Options &) {
+    const double first_frame = number_member(document, "ip", 0.0);
+    const double last_frame  = number_member(document, "op", 0.0);
+
+    uint32_t removed = 0;
+    for_each_layer_array(document, [&](Value & layers, const bool top_level) {
+        const auto referenced = referenced_layers(layers);
+        for(rapidjson::SizeType i = 0; i < layers.Size();) {
+            const Value & layer = layers[i];
+            if(is_invisible(layer, top_level, first_frame, last_frame) && !is_referenced(layer, referenced) &&
+               !in_track_matte(layers, i)) {
+                layers.Erase(layers.Begin() + i);
+                ++removed;
+            } else {
+                ++i;
+            }
+        }
+    });
+
+    lottie_tools::for_each_member(document, [&](Value & value, Value &, const std::string_view key) {
+        if((key != "shapes" && key != "it") || !value.IsArray())
+            return;
+        for(rapidjson::SizeType i = 0; i < value.Size();) {
+            if(is_set(value[i], "hd")) {
+                value.Erase(value.Begin() + i);
+                ++removed;
+            } else {
+                ++i;
+            }
+        }
+    });
+    return removed;
+}
+
+uint32_t merge_static_shape_layers(rapidjson::Document & document, const Options &) {
+    auto &   allocator = document.GetAllocator();
+    uint32_t merged    = 0;
+    for_each_layer_array(document, [&](Value & layers, bool) {
+        const auto referenced = referenced_layers(layers);
+        // Layers earlier in the array are drawn on top, and so are earlier shapes, so groups keep the layers' order.
+        bool grouped = false;
+        for(rapidjson::SizeType i = 0; i + 1 < layers.Size();) {
+            Value & target = layers[i];
+            Value & source = layers[i + 1];
+            if(!can_merge(layers, i, referenced) || !can_merge(layers, i + 1, referenced) ||
+               !same_timing(target, source)) {
+                grouped = false;
+                ++i;
+                continue;
+            }
+
+            if(!grouped) {
+                Value shapes{rapidjson::kArrayType};
+                shapes.PushBack(transform_group(target, allocator), allocator);
+                set_member(target, "shapes", std::move(shapes), allocator);
+                set_member(target, "ks", translation({}, allocator), allocator);
+                grouped = true;
+            }
+            find(target, "shapes")->PushBack(transform_group(source, allocator), allocator);
+            layers.Erase(layers.Begin() + i + 1);
+            ++merged;
+        }
+    });
+    return merged;
+}
+
+uint32_t simplify_paths(rapidjson::Document & document, const Options & options) {
+    uint32_t removed = 0;
+    lottie_tools::for_each_member(document, [&](Value & value, Value & parent, const std::string_view key) {
+        if(key != "ks" || string_member(parent, "ty") != "sh")
+            return;
+        auto * k = const_cast<Value *>(static_value(&value));
+        if(!k)
+            return;
+        const auto path = read_path(*k);
+        if(!path)
+            return;
+
+        const auto keep = simplify(*path, options.path_tolerance);
+        for(size_t i = keep.size(); i-- > 0;) {
+            if(keep[i])
+                continue;
+            for(const char * name : {"v", "i", "o"}) {
+                auto & points = *find(*k, name);
+                points.Erase(points.Begin() + i);
+            }
+            ++removed;
+        }
+    });
+    return removed;
+}
+
+uint32_t masks_to_clips(rapidjson::Document & document, const Options &) {
+    auto & allocator = document.GetAllocator();
+
+    std::set<std::string> asset_ids;
+    if(const auto * assets = find(document, "assets"); assets && assets->IsArray()) {
+        for(const auto & asset : assets->GetArray())
+            asset_ids.emplace(string_member(asset, "id"));
+    }
+
+    // New precomps are added once all layer arrays have been walked, since they go into the array holding some of them.
+    std::vector<Value> precomps;
+    for_each_layer_array(document, [&](Value & layers, bool) {
+        const auto referenced = referenced_layers(layers);
+        for(auto & layer : layers.GetArray()) {
+            const auto * masks = find(layer, "masksProperties");
+            auto *       ks    = find(layer, "ks");
+            if(!masks || !masks->IsArray() || masks->Size() != 1 || !ks || !ks->IsObject() ||
+               is_referenced(layer, referenced) || is_set(layer, "bm") || is_set(layer, "ddd") ||
+               is_non_empty_array(find(layer, "ef")))
+                continue;
+
+            // Effects would apply after the clip instead of after the mask, so only plain additive masks qualify.
+            const Value & mask   = (*masks)[0];
+            const auto *  shape  = static_value(find(mask, "pt"));
+            const auto    path   = shape ? read_path(*shape) : std::nullopt;
+            const auto    rect   = path ? as_rect(*path) : std::nullopt;
+            const auto    anchor = find(*ks, "a") ? static_point(find(*ks, "a")) : std::optional{Point{}};
+            if(!rect || !anchor || string_member(mask, "mode") != "a" || is_set(mask, "inv") ||
+               static_number(find(mask, "o")).value_or(find(mask, "o") ? -1.0 : 100.0) != 100.0 ||
+               static_number(find(mask, "x")).value_or(find(mask, "x") ? -1.0 : 0.0) != 0.0)
+                continue;
+
+            std::string id;
+            for(size_t n = asset_ids.size();; ++n) {
+                id = "clip_" + std::to_string(n);
+                if(asset_ids.insert(id).second)
+                    break;
+            }
+
+            // The precomp layer takes the layer's place in the composition and its transform, moved so the precomp's
+            // origin is the rectangle's corner. Inside, the layer is only shifted by the same amount.
+            Value precomp{rapidjson::kObjectType};
+            precomp.AddMember("ty", 0, allocator);
+            const std::string name{string_member(layer, "nm")};
+            const std::string content_name = name + " content";
+            precomp.AddMember("nm", Value{name.c_str(), static_cast<rapidjson::SizeType>(name.size()), allocator},
+                              allocator);
+            precomp.AddMember("refId", Value{id.c_str(), static_cast<rapidjson::SizeType>(id.size()), allocator},
+                              allocator);
+            for(const char * name : {"ind", "parent", "td", "tt", "tp", "ao", "ip", "op", "hd"}) {
+                if(auto * value = find(layer, name)) {
+                    precomp.AddMember(rapidjson::StringRef(name), Value{*value, allocator}, allocator);
+                    layer.RemoveMember(name);
+                }
+            }
+            Value transform{*ks, allocator};
+            set_member(transform,
+                       "a",
+                       static_property(point_value({anchor->x - rect->x, anchor->y - rect->y}, allocator), allocator),
+                       allocator);
+            precomp.AddMember("ks", transform, allocator);
+            precomp.AddMember("st", 0, allocator);
+            precomp.AddMember("w", rect->width, allocator);
+            precomp.AddMember("h", rect->height, allocator);
+            if(const auto * in = find(precomp, "ip"))
+                layer.AddMember("ip", Value{*in, allocator}, allocator);
+            if(const auto * out = find(precomp, "op"))
+                layer.AddMember("op", Value{*out, allocator}, allocator);
+
+            layer.RemoveMember("masksProperties");
+            layer.RemoveMember("hasMask");
+            set_member(layer, "ks", translation({-rect->x, -rect->y}, allocator), allocator);
+            set_member(layer,
+                       "nm",
+                       Value{content_name.c_str(), static_cast<rapidjson::SizeType>(content_name.size()), allocator},
+                       allocator);
+
+            Value asset{rapidjson::kObjectType};
+            asset.AddMember("id", Value{id.c_str(), static_cast<rapidjson::SizeType>(id.size()), allocator}, allocator);
+            asset.AddMember("layers", Value{rapidjson::kArrayType}, allocator);
+            (*find(asset, "layers")).PushBack(layer, allocator);
+            layer = precomp;
+            precomps.push_back(std::move(asset));
+        }
+    });
+
+    if(precomps.empty())
+        return 0;
+    if(!find(document, "assets"))
+        document.AddMember("assets", Value{rapidjson::kArrayType}, allocator);
+    for(auto & precomp : precomps)
+        (*find(document, "assets")).PushBack(precomp, allocator);
+    return static_cast<uint32_t>(precomps.size());
+}
+
+uint32_t quantize_keyframes(rapidjson::Document & document, const Options & options) {
+    auto &   allocator = document.GetAllocator();
+    uint32_t removed   = 0;
+    lottie_tools::for_each_member(document, [&](Value & value, Value &, std::string_view) {
+        const auto * k = find(value, "k");
+        if(k && is_keyframes(*k) && !has_expression(value))
+            removed += quantize_property(value, options.value_epsilon, allocator);
+    });
+    return removed;
+}
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "optimizer.hpp"
+
+#include <cstdint>
+
+#include <rapidjson/document.h>
+
+// Rewrites of a lottie document which make it cheaper to render without changing what it looks like. Each returns the
+// number of changes it made. They rely on the headless validation in optimize() to catch what thorvg draws
+// differently than the format suggests.
+namespace lottie_optimizer {
+// Layers which are hidden, fully transparent or never inside their composition's time range, and hidden shape items.
+// Layers other layers are parented to or matted with stay.
+uint32_t remove_invisible_layers(rapidjson::Document & document, const Options & options);
+
+// Runs of adjacent shape layers with static transforms and the same timing become one layer, with each one's shapes in
+// a group carrying its transform. Saves a scene, and its compositing, per merged layer.
+uint32_t merge_static_shape_layers(rapidjson::Document & document, const Options & options);
+
+// Drops vertices of static paths which lie within the tolerance of the straight line through their neighbors.
+uint32_t simplify_paths(rapidjson::Document & document, const Options & options);
+
+// A layer whose only mask is an axis-aligned rectangle is moved into a precomp of the rectangle's size. thorvg clips
+// precomps to their bounds with a rectangle clip, which the software rasterizer applies to spans directly, where a
+// mask is drawn into an offscreen buffer and composed.
+uint32_t masks_to_clips(rapidjson::Document & document, const Options & options);
+
+// Removes keyframes which only repeat the value of a constant stretch, and turns properties whose keyframes all hold
+// the same value into static ones.
+uint32_t quantize_keyframes(rapidjson::Document & document, const Options & options);
+}
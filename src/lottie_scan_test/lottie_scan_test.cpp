@@ -0,0 +1,155 @@
+// Headless checks of the lottie scanner, mainly which top level layers it classifies as constant and thus lets the
+// software renderer draw from a bitmap rendered once: layers with keyframes, expressions, blend modes, parents,
+// precomps, track mattes or a partial timeline must never be. Also checks the flags and names thorvg's paints are
+// looked up by, and expression detection. Exits with an error when a check fails. Doesn't depend on any window system,
+// so it runs anywhere:
+//   lottie_scan_test
+
+#include <utils/lottie_scan.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+constexpr std::string_view STATIC_TRANSFORM =
+  R"({"o":{"a":0,"k":100},"p":{"a":0,"k":[50,50,0]},"s":{"a":0,"k":[100,100,100]}})";
+constexpr std::string_view STATIC_SHAPES =
+  R"([{"ty":"rc","p":{"a":0,"k":[0,0]},"s":{"a":0,"k":[20,20]},"r":{"a":0,"k":0}},)"
+  R"({"ty":"fl","c":{"a":0,"k":[1,0,0,1]},"o":{"a":0,"k":100}}])";
+constexpr std::string_view ANIMATED_TRANSFORM =
+  R"({"o":{"a":0,"k":100},"p":{"a":1,"k":[{"t":0,"s":[0,0,0]},{"t":60,"s":[99,0,0]}]}})";
+constexpr std::string_view ANIMATED_SHAPES = R"([{"ty":"rc","s":{"a":1,"k":[{"t":0,"s":[0,0]},{"t":9,"s":[9,9]}]}}])";
+constexpr std::string_view STATIC_MASK =
+  R"(,"masksProperties":[{"mode":"a","pt":{"a":0,"k":{"c":true,"v":[[0,0],[9,0],[9,9]],)"
+  R"("i":[[0,0],[0,0],[0,0]],"o":[[0,0],[0,0],[0,0]]}}}])";
+
+int failures = 0;
+
+void check(const bool condition, const char * what) {
+    if(!condition) {
+        std::fprintf(stderr, "failed: %s\n", what);
+        ++failures;
+    }
+}
+
+struct Layer {
+    std::string_view name;
+    // Further keys, each with a leading comma.
+    std::string_view extra     = {};
+    std::string_view transform = STATIC_TRANSFORM;
+    std::string_view shapes    = STATIC_SHAPES;
+    int              in_point  = 0;
+    int              out_point = 60;
+};
+
+std::string layer(const Layer & layer) {
+    return std::string{R"({"ty":4,"nm":")"} + std::string{layer.name} + R"(","ip":)" + std::to_string(layer.in_point) +
+           R"(,"op":)" + std::to_string(layer.out_point) + R"(,"st":0,"ks":)" + std::string{layer.transform} +
+           R"(,"shapes":)" + std::string{layer.shapes} + std::string{layer.extra} + "}";
+}
+
+// A 60 frame animation with the given top level layers and assets.
+std::string animation(const std::vector<std::string> & layers, const std::string_view assets = {}) {
+    std::string json = R"({"v":"5.7.0","fr":30,"ip":0,"op":60,"w":100,"h":100,"assets":[)" + std::string{assets} +
+                       R"(],"layers":[)";
+    for(size_t i = 0; i < layers.size(); ++i)
+        json += (i ? "," : "") + layers[i];
+    return json + "]}";
+}
+
+// Scans an animation with just the given layer and returns whether it's constant.
+bool constant(const Layer & single) {
+    const auto layers = utils::scan_layers(animation({layer(single)}));
+    return layers.size() == 1 && layers[0].constant;
+}
+
+void check_constant() {
+    check(constant({.name = "static"}), "a static shape layer shown for the whole timeline is constant");
+    check(constant({.name = "normal blend", .extra = R"(,"bm":0)"}), "the normal blend mode is no blend mode");
+    check(constant({.name = "longer", .in_point = -10, .out_point = 90}), "a layer outlasting the timeline");
+    check(constant({.name = "unparented", .extra = R"(,"parent":null)"}), "a null parent is no parent");
+    check(constant({.name = "visible", .extra = R"(,"hd":false)"}), "a layer explicitly not hidden");
+
+    const auto masked = utils::scan_layers(animation({layer({.name = "masked", .extra = STATIC_MASK})}));
+    check(masked.size() == 1 && masked[0].masked && masked[0].constant, "a static mask keeps a layer constant");
+}
+
+void check_not_constant() {
+    check(!constant({.name = "moving", .transform = ANIMATED_TRANSFORM}), "an animated transform");
+    check(!constant({.name = "keyframed", .transform = R"({"o":{"k":[{"t":0,"s":[0]},{"t":60,"s":[100]}]}})"}),
+          "keyframes without the animated flag");
+    check(!constant({.name = "growing", .shapes = ANIMATED_SHAPES}), "an animated shape");
+    check(!constant({.name = "scripted", .transform = R"({"o":{"a":0,"k":100,"x":"$bm_rt = time * 10;"}})"}),
+          "an expression");
+    check(!constant({.name = "blended", .extra = R"(,"bm":3)"}), "a blend mode on the layer");
+    check(!constant({.name   = "blended shape",
+                     .shapes = R"([{"ty":"gr","bm":1,"it":[{"ty":"fl","c":{"a":0,"k":[0,0,0,1]}}]}])"}),
+          "a blend mode on a shape");
+    check(!constant({.name = "child", .extra = R"(,"parent":1)"}), "a parented layer");
+    check(!constant({.name = "hidden", .extra = R"(,"hd":true)"}), "a hidden layer");
+    check(!constant({.name = "late", .in_point = 10}), "a layer starting after the animation");
+    check(!constant({.name = "early", .out_point = 30}), "a layer ending before the animation");
+
+    const auto matte = utils::scan_layers(animation({layer({.name = "source", .extra = R"(,"td":1)"}),
+                                                     layer({.name = "matted", .extra = R"(,"tt":1)"})}));
+    check(matte.size() == 2 && matte[0].matte_source && matte[1].matted, "track mattes are detected");
+    check(matte.size() == 2 && !matte[0].constant && !matte[1].constant, "neither side of a track matte");
+}
+
+void check_precomps() {
+    const std::string asset = R"({"id":"comp","layers":[)" + layer({.name = "inner"}) + "]}";
+    const auto        layers =
+      utils::scan_layers(animation({R"({"ty":0,"nm":"precomp","refId":"comp","ip":0,"op":60,"st":0,"ks":)" +
+                                      std::string{STATIC_TRANSFORM} + "}",
+                                    layer({.name = "outer"})},
+                                   asset));
+
+    check(layers.size() == 3, "layers in precomps are listed");
+    if(layers.size() != 3)
+        return;
+    check(layers[0].name == "inner" && !layers[0].top_level, "a precomp's layer comes first and isn't top level");
+    check(!layers[0].constant, "a static layer in a precomp isn't constant");
+    check(layers[1].name == "precomp" && layers[1].top_level && !layers[1].constant, "a precomp layer isn't constant");
+    check(layers[2].name == "outer" && layers[2].constant, "a static layer next to a precomp is");
+}
+
+void check_names() {
+    const auto layers = utils::scan_layers(animation({layer({.name = "same"}),
+                                                      layer({.name = "same"}),
+                                                      layer({.name = R"(quo\"ted)"}),
+                                                      layer({.name = "unique"})}));
+    check(layers.size() == 4, "all layers are listed");
+    if(layers.size() != 4)
+        return;
+    check(layers[0].name.empty() && layers[1].name.empty(), "duplicate names can't identify a layer");
+    check(layers[2].name.empty(), "escaped names can't identify a layer");
+    check(layers[3].name == "unique", "a unique name is kept");
+    check(utils::layer_names(animation({layer({.name = "a"}), layer({.name = "b"})})) ==
+            std::vector<std::string>{"a", "b"},
+          "names in document order");
+}
+
+void check_expressions() {
+    check(utils::uses_expressions(R"({"o":{"a":0,"k":100,"x":"value"}})"), "an expression");
+    check(!utils::uses_expressions(R"({"o":{"a":0,"k":100,"x":""}})"), "an empty expression");
+    check(!utils::uses_expressions(R"({"masksProperties":[{"x":{"a":0,"k":0}}]})"), "a mask's expansion");
+    check(!utils::uses_expressions(R"({"nm":"x","v":"x"})"), "\"x\" as a value");
+}
+}
+
+int main() {
+    check_constant();
+    check_not_constant();
+    check_precomps();
+    check_names();
+    check_expressions();
+    if(failures) {
+        std::fprintf(stderr, "%d checks failed\n", failures);
+        return EXIT_FAILURE;
+    }
+    std::printf("all checks passed\n");
+    return EXIT_SUCCESS;
+}
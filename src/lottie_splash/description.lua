@@ -1,5 +1,5 @@
 kind "StaticLib"
-links {"deps", "dwmapi.lib"}
+links {"deps", "dwmapi.lib", "wtsapi32.lib"}
 dependson {"deps"}
 runtime "Release"
 
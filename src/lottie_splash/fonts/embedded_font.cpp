@@ -0,0 +1,1096 @@
+// Generated by subset_font.py from Lato Regular, licensed under the SIL Open Font License 1.1.
+// Do not edit by hand.
+#include "../utils/font_provider.hpp"
+
+namespace {
+// clang-format off
+constexpr unsigned char EMBEDDED_FONT_DATA[25852] = {
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x80, 0x00, 0x03, 0x00, 0x20, 0x4f, 0x53, 0x2f, 0x32, 0xd9, 0xae, 0xaa, 0x69, 0x00, 0x00, 0x00, 0xac,
+  0x00, 0x00, 0x00, 0x60, 0x63, 0x6d, 0x61, 0x70, 0x43, 0xac, 0x63, 0x36, 0x00, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x5c, 0x67, 0x6c, 0x79, 0x66,
+  0x89, 0xbd, 0x61, 0xb4, 0x00, 0x00, 0x01, 0x68, 0x00, 0x00, 0x4b, 0x04, 0x68, 0x65, 0x61, 0x64, 0xff, 0x91, 0x65, 0x82, 0x00, 0x00, 0x4c, 0x6c,
+  0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61, 0x0f, 0xb6, 0x07, 0x6e, 0x00, 0x00, 0x4c, 0xa4, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78,
+  0x56, 0x98, 0x4c, 0x47, 0x00, 0x00, 0x4c, 0xc8, 0x00, 0x00, 0x03, 0x48, 0x6c, 0x6f, 0x63, 0x61, 0x00, 0x22, 0xc0, 0x28, 0x00, 0x00, 0x50, 0x10,
+  0x00, 0x00, 0x03, 0x4c, 0x6d, 0x61, 0x78, 0x70, 0x01, 0x02, 0x00, 0xe7, 0x00, 0x00, 0x53, 0x5c, 0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0xbe, 0x0c, 0x24, 0xed, 0x00, 0x00, 0x53, 0x7c, 0x00, 0x00, 0x11, 0x5e, 0x70, 0x6f, 0x73, 0x74, 0xff, 0x77, 0x00, 0x78, 0x00, 0x00, 0x64, 0xdc,
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x03, 0x04, 0x12, 0x01, 0x90, 0x00, 0x05, 0x00, 0x00, 0x05, 0x78, 0x05, 0x14, 0x00, 0x00, 0x01, 0x18, 0x05, 0x78,
+  0x05, 0x14, 0x00, 0x00, 0x03, 0xba, 0x00, 0x78, 0x01, 0xf4, 0x08, 0x03, 0x02, 0x0f, 0x05, 0x02, 0x02, 0x02, 0x04, 0x03, 0x02, 0x03, 0xa0, 0x00,
+  0x00, 0xaf, 0x50, 0x00, 0x60, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x79, 0x50, 0x4c, 0x00, 0x40, 0x00, 0x00, 0xfb, 0x02,
+  0x06, 0x4a, 0xfe, 0x7a, 0x01, 0x90, 0x07, 0xb6, 0x01, 0xaa, 0x20, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf5, 0x05, 0x99, 0x00, 0x00,
+  0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x7e, 0x00, 0xff, 0x20, 0x14, 0x20, 0x19, 0x20, 0x1d, 0x20, 0x22, 0x20, 0x26, 0xff, 0xff, 0x00, 0x00,
+  0x00, 0x20, 0x00, 0xa0, 0x20, 0x13, 0x20, 0x18, 0x20, 0x1c, 0x20, 0x22, 0x20, 0x26, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xc0, 0xe0, 0xb1, 0xe0, 0xae,
+  0xe0, 0xac, 0xe0, 0xa8, 0xe0, 0xa5, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x2d, 0x00, 0x00, 0x03, 0xfb, 0x05, 0x99, 0x00, 0x25, 0x00, 0x35, 0x00, 0x39, 0x00, 0x3d, 0x00, 0x00, 0x13, 0x3e, 0x03, 0x33,
+  0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x04, 0x0f, 0x01, 0x23, 0x27, 0x26, 0x3e, 0x04, 0x35, 0x34, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x23, 0x22, 0x27,
+  0x13, 0x34, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x01, 0x21, 0x11, 0x21, 0x37, 0x21, 0x11, 0x21, 0xfa, 0x19,
+  0x39, 0x44, 0x4f, 0x2e, 0x3f, 0x67, 0x49, 0x29, 0x1e, 0x2d, 0x36, 0x30, 0x23, 0x04, 0x11, 0x7a, 0x0c, 0x04, 0x1a, 0x2d, 0x37, 0x30, 0x20, 0x49,
+  0x39, 0x29, 0x38, 0x28, 0x1c, 0x0b, 0x19, 0x0c, 0x63, 0x3e, 0x30, 0x16, 0x28, 0x1d, 0x11, 0x11, 0x1d, 0x28, 0x16, 0x30, 0x3e, 0xfe, 0xa1, 0x03,
+  0xce, 0xfc, 0x32, 0x32, 0x03, 0x63, 0xfc, 0x9d, 0x04, 0x75, 0x16, 0x26, 0x1d, 0x11, 0x23, 0x40, 0x5b, 0x38, 0x37, 0x50, 0x3b, 0x2b, 0x26, 0x25,
+  0x17, 0x69, 0x75, 0x22, 0x33, 0x2b, 0x28, 0x2e, 0x3a, 0x28, 0x33, 0x3c, 0x12, 0x16, 0x12, 0x16, 0xfc, 0xfb, 0x2f, 0x40, 0x11, 0x1e, 0x29, 0x17,
+  0x17, 0x28, 0x1e, 0x11, 0x3f, 0x04, 0xa4, 0xfa, 0x67, 0x36, 0x05, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xda, 0xff, 0xf1, 0x01, 0xd3,
+  0x05, 0x99, 0x00, 0x0d, 0x00, 0x21, 0x00, 0x00, 0x01, 0x11, 0x14, 0x0e, 0x02, 0x07, 0x23, 0x2e, 0x03, 0x35, 0x11, 0x03, 0x34, 0x3e, 0x02, 0x33,
+  0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x01, 0xae, 0x03, 0x06, 0x09, 0x06, 0x79, 0x06, 0x09, 0x06, 0x03, 0x2b, 0x13,
+  0x21, 0x2e, 0x1a, 0x1a, 0x2e, 0x22, 0x13, 0x13, 0x22, 0x2e, 0x1a, 0x1a, 0x2e, 0x21, 0x13, 0x05, 0x99, 0xfd, 0xc4, 0x2d, 0x56, 0x57, 0x5b, 0x34,
+  0x34, 0x5b, 0x57, 0x56, 0x2d, 0x02, 0x3c, 0xfa, 0xd5, 0x1a, 0x2e, 0x22, 0x14, 0x14, 0x22, 0x2e, 0x1a, 0x1b, 0x2d, 0x22, 0x13, 0x13, 0x22, 0x2d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x98, 0x03, 0x99, 0x02, 0x80, 0x05, 0x99, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x00, 0x01, 0x11, 0x07, 0x0e,
+  0x01, 0x23, 0x22, 0x26, 0x2f, 0x01, 0x11, 0x21, 0x11, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x2f, 0x01, 0x11, 0x01, 0x33, 0x10, 0x03, 0x1c, 0x1f,
+  0x1a, 0x1d, 0x06, 0x10, 0x01, 0xe8, 0x10, 0x03, 0x1c, 0x1f, 0x1a, 0x1d, 0x06, 0x10, 0x05, 0x99, 0xfe, 0xde, 0x9b, 0x20, 0x23, 0x23, 0x20, 0x9b,
+  0x01, 0x22, 0xfe, 0xde, 0x9b, 0x20, 0x23, 0x23, 0x20, 0x9b, 0x01, 0x22, 0x00, 0x02, 0x00, 0x36, 0x00, 0x00, 0x04, 0x51, 0x05, 0x99, 0x00, 0x3e,
+  0x00, 0x42, 0x00, 0x00, 0x01, 0x03, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x37, 0x13, 0x23, 0x03, 0x0e, 0x01, 0x2b, 0x01, 0x13, 0x23, 0x22, 0x26,
+  0x35, 0x34, 0x36, 0x3f, 0x01, 0x33, 0x13, 0x23, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x13, 0x3e, 0x01, 0x3b, 0x01, 0x03, 0x33, 0x13, 0x33, 0x32, 0x16,
+  0x15, 0x14, 0x07, 0x03, 0x33, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x03, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x25, 0x33, 0x13, 0x23, 0x03,
+  0x16, 0x54, 0x51, 0x17, 0x20, 0x01, 0x01, 0x47, 0xf7, 0x47, 0x08, 0x2d, 0x1d, 0x4f, 0x55, 0x92, 0x17, 0x1a, 0x01, 0x01, 0x08, 0xcc, 0x41, 0xe8,
+  0x0d, 0x05, 0x24, 0x27, 0x9e, 0x48, 0x06, 0x2b, 0x1e, 0x50, 0x54, 0xf7, 0x54, 0x4f, 0x19, 0x21, 0x01, 0x49, 0xd4, 0x0d, 0x05, 0x25, 0x26, 0x8a,
+  0x41, 0xb3, 0x18, 0x1a, 0x01, 0x01, 0x09, 0xfd, 0x9c, 0xf7, 0x41, 0xf7, 0x01, 0xa7, 0xfe, 0x59, 0x22, 0x1b, 0x04, 0x07, 0x05, 0x01, 0x5a, 0xfe,
+  0x9d, 0x25, 0x1f, 0x01, 0xa7, 0x17, 0x1c, 0x05, 0x0c, 0x06, 0x39, 0x01, 0x46, 0x4a, 0x1d, 0x1c, 0x01, 0x66, 0x1e, 0x22, 0xfe, 0x5a, 0x01, 0xa6,
+  0x1e, 0x18, 0x08, 0x05, 0xfe, 0x9d, 0x4b, 0x1d, 0x1b, 0xfe, 0xba, 0x17, 0x1d, 0x05, 0x0b, 0x06, 0x39, 0x83, 0x01, 0x46, 0x00, 0x03, 0x00, 0x6a,
+  0xff, 0x12, 0x04, 0x24, 0x06, 0x67, 0x00, 0x38, 0x00, 0x43, 0x00, 0x4e, 0x00, 0x00, 0x05, 0x2e, 0x01, 0x27, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x1e,
+  0x02, 0x17, 0x13, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x3f, 0x01, 0x3e, 0x01, 0x3b, 0x01, 0x07, 0x1e, 0x01, 0x17, 0x07, 0x06, 0x23, 0x22, 0x2e,
+  0x02, 0x27, 0x03, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x0f, 0x01, 0x0e, 0x01, 0x2b, 0x01, 0x01, 0x34, 0x2e, 0x02, 0x27, 0x03, 0x3e, 0x03, 0x01,
+  0x14, 0x1e, 0x02, 0x17, 0x13, 0x0e, 0x03, 0x01, 0xf2, 0x79, 0xc7, 0x48, 0x35, 0x07, 0x1a, 0x0e, 0x13, 0x30, 0x46, 0x61, 0x44, 0x25, 0x46, 0x87,
+  0x6b, 0x41, 0x39, 0x6d, 0xa0, 0x68, 0x0a, 0x02, 0x1a, 0x16, 0x42, 0x0e, 0x69, 0x98, 0x3c, 0x2b, 0x14, 0x1a, 0x0e, 0x29, 0x3a, 0x4c, 0x31, 0x21,
+  0x48, 0x8c, 0x70, 0x45, 0x3c, 0x73, 0xa7, 0x6b, 0x0c, 0x02, 0x1b, 0x15, 0x42, 0x01, 0x98, 0x25, 0x40, 0x56, 0x31, 0x22, 0x41, 0x65, 0x45, 0x23,
+  0xfd, 0xd5, 0x22, 0x3c, 0x50, 0x2f, 0x1e, 0x41, 0x5f, 0x3d, 0x1e, 0x0c, 0x0b, 0x61, 0x4b, 0x52, 0x0b, 0x0e, 0x26, 0x31, 0x2e, 0x08, 0x02, 0x13,
+  0x15, 0x35, 0x55, 0x81, 0x61, 0x49, 0x8b, 0x6c, 0x45, 0x04, 0x90, 0x13, 0x1e, 0xc6, 0x0d, 0x52, 0x3a, 0x42, 0x1e, 0x19, 0x21, 0x21, 0x07, 0xfe,
+  0x1c, 0x16, 0x34, 0x52, 0x7b, 0x5c, 0x5a, 0x9e, 0x78, 0x4b, 0x06, 0xb0, 0x13, 0x1d, 0x02, 0x85, 0x32, 0x48, 0x34, 0x26, 0x10, 0xfe, 0x0e, 0x06,
+  0x2d, 0x46, 0x5d, 0x02, 0xd0, 0x30, 0x47, 0x36, 0x28, 0x10, 0x01, 0xc3, 0x06, 0x28, 0x3c, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x48,
+  0xff, 0xef, 0x05, 0xdb, 0x05, 0xa7, 0x00, 0x13, 0x00, 0x27, 0x00, 0x31, 0x00, 0x45, 0x00, 0x59, 0x00, 0x00, 0x01, 0x14, 0x0e, 0x02, 0x23, 0x22,
+  0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x07, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32,
+  0x3e, 0x02, 0x01, 0x3e, 0x01, 0x3b, 0x01, 0x01, 0x0e, 0x01, 0x2b, 0x01, 0x01, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02,
+  0x33, 0x32, 0x1e, 0x02, 0x07, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x02, 0xc3, 0x34, 0x57,
+  0x74, 0x3f, 0x44, 0x73, 0x56, 0x30, 0x30, 0x56, 0x73, 0x44, 0x43, 0x75, 0x55, 0x31, 0x8b, 0x1c, 0x31, 0x41, 0x25, 0x25, 0x41, 0x30, 0x1b, 0x1b,
+  0x30, 0x41, 0x25, 0x25, 0x41, 0x31, 0x1c, 0x02, 0x80, 0x0d, 0x1d, 0x18, 0x80, 0xfb, 0xe9, 0x0a, 0x1c, 0x13, 0x84, 0x05, 0x35, 0x34, 0x57, 0x73,
+  0x3f, 0x44, 0x73, 0x56, 0x30, 0x30, 0x56, 0x73, 0x44, 0x43, 0x74, 0x56, 0x30, 0x8a, 0x1c, 0x31, 0x41, 0x25, 0x25, 0x41, 0x30, 0x1b, 0x1b, 0x30,
+  0x41, 0x25, 0x25, 0x41, 0x31, 0x1c, 0x04, 0x3f, 0x54, 0x85, 0x5b, 0x30, 0x30, 0x5b, 0x85, 0x54, 0x56, 0x86, 0x5c, 0x30, 0x30, 0x5c, 0x86, 0x56,
+  0x42, 0x5c, 0x3b, 0x1a, 0x1a, 0x3b, 0x5c, 0x42, 0x41, 0x5b, 0x39, 0x19, 0x19, 0x39, 0x5b, 0x01, 0x77, 0x11, 0x13, 0xfa, 0x84, 0x0d, 0x10, 0x01,
+  0x52, 0x54, 0x84, 0x5b, 0x30, 0x30, 0x5b, 0x84, 0x54, 0x56, 0x87, 0x5c, 0x30, 0x30, 0x5c, 0x87, 0x56, 0x42, 0x5d, 0x3a, 0x1a, 0x1a, 0x3a, 0x5d,
+  0x42, 0x41, 0x5a, 0x39, 0x19, 0x19, 0x39, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x52, 0xff, 0xf0, 0x05, 0x78, 0x05, 0xa9, 0x00, 0x3f,
+  0x00, 0x4b, 0x00, 0x00, 0x01, 0x32, 0x1e, 0x02, 0x17, 0x07, 0x06, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e,
+  0x02, 0x17, 0x01, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x0e, 0x01, 0x07, 0x01, 0x23, 0x22, 0x26, 0x2f, 0x01, 0x0e, 0x01, 0x23, 0x22, 0x2e,
+  0x02, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x2e, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x01, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37, 0x01, 0x0e, 0x01, 0x02,
+  0x94, 0x4f, 0x82, 0x5f, 0x37, 0x04, 0x6f, 0x05, 0x04, 0x0d, 0x17, 0x05, 0x07, 0x1f, 0x31, 0x45, 0x2e, 0x32, 0x50, 0x39, 0x1f, 0x11, 0x22, 0x36,
+  0x26, 0x01, 0x9c, 0x26, 0x2d, 0x08, 0x02, 0x14, 0x12, 0x6e, 0x02, 0x46, 0x42, 0x01, 0x2c, 0xac, 0x1d, 0x24, 0x16, 0x90, 0x5e, 0xf5, 0x93, 0x50,
+  0x9a, 0x79, 0x4a, 0x2f, 0x53, 0x72, 0x44, 0x3d, 0x3a, 0x35, 0x64, 0x8f, 0xfe, 0xcc, 0x30, 0x4e, 0x64, 0x34, 0x70, 0xb2, 0x44, 0xfe, 0x59, 0x6a,
+  0x6b, 0x05, 0xa9, 0x33, 0x54, 0x6f, 0x3c, 0x16, 0x01, 0x0e, 0x12, 0x1a, 0x38, 0x2e, 0x1e, 0x20, 0x39, 0x4d, 0x2d, 0x23, 0x40, 0x41, 0x45, 0x26,
+  0xfe, 0x5d, 0x43, 0x93, 0x4a, 0x13, 0x16, 0x73, 0xde, 0x61, 0xfe, 0xd0, 0x0e, 0x16, 0x91, 0x5b, 0x6a, 0x36, 0x67, 0x94, 0x5d, 0x46, 0x7d, 0x6a,
+  0x54, 0x1e, 0x4d, 0x92, 0x4e, 0x49, 0x80, 0x5f, 0x37, 0xfb, 0xe3, 0x41, 0x63, 0x44, 0x23, 0x52, 0x44, 0x01, 0xab, 0x39, 0x9f, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x98, 0x03, 0x99, 0x01, 0x33, 0x05, 0x99, 0x00, 0x0a, 0x00, 0x00, 0x01, 0x11, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x2f, 0x01,
+  0x11, 0x01, 0x33, 0x10, 0x03, 0x1c, 0x1f, 0x1a, 0x1d, 0x06, 0x10, 0x05, 0x99, 0xfe, 0xde, 0x9b, 0x20, 0x23, 0x23, 0x20, 0x9b, 0x01, 0x22, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x86, 0xfe, 0xdb, 0x02, 0x01, 0x06, 0x0f, 0x00, 0x1c, 0x00, 0x00, 0x01, 0x14, 0x12, 0x17, 0x1e, 0x01,
+  0x15, 0x14, 0x06, 0x0f, 0x01, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x07, 0x06, 0x02, 0x01, 0x21, 0x6e, 0x68,
+  0x06, 0x04, 0x0e, 0x0b, 0x4f, 0x4b, 0x69, 0x41, 0x1e, 0x1e, 0x41, 0x69, 0x4b, 0x4f, 0x0b, 0x0e, 0x0a, 0x69, 0x6d, 0x02, 0x75, 0xd6, 0xfe, 0x6d,
+  0xb7, 0x0b, 0x10, 0x08, 0x0e, 0x12, 0x07, 0x30, 0x73, 0xe2, 0xe4, 0xe7, 0x7a, 0x79, 0xe8, 0xe3, 0xe2, 0x74, 0x31, 0x07, 0x12, 0x0e, 0x0f, 0x13,
+  0xb6, 0xfe, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4a, 0xfe, 0xdb, 0x01, 0xc5, 0x06, 0x0f, 0x00, 0x1c, 0x00, 0x00, 0x01, 0x34,
+  0x02, 0x27, 0x26, 0x35, 0x34, 0x36, 0x3f, 0x01, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x36, 0x12,
+  0x01, 0x2a, 0x6d, 0x69, 0x0a, 0x0e, 0x0b, 0x4f, 0x4b, 0x69, 0x41, 0x1e, 0x1e, 0x41, 0x69, 0x4b, 0x4f, 0x0b, 0x0e, 0x04, 0x06, 0x68, 0x6e, 0x02,
+  0x75, 0xd6, 0x01, 0x94, 0xb6, 0x13, 0x0f, 0x0e, 0x12, 0x07, 0x31, 0x74, 0xe2, 0xe3, 0xe8, 0x79, 0x7a, 0xe7, 0xe4, 0xe2, 0x73, 0x30, 0x07, 0x12,
+  0x0e, 0x08, 0x10, 0x0b, 0xb7, 0x01, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x60, 0x03, 0x5f, 0x02, 0xbc, 0x05, 0xe2, 0x00, 0x30,
+  0x00, 0x00, 0x01, 0x35, 0x34, 0x36, 0x37, 0x06, 0x0f, 0x01, 0x27, 0x37, 0x36, 0x37, 0x2e, 0x01, 0x2f, 0x01, 0x37, 0x17, 0x16, 0x17, 0x2e, 0x01,
+  0x3d, 0x01, 0x33, 0x15, 0x14, 0x07, 0x3e, 0x01, 0x3f, 0x01, 0x17, 0x07, 0x0e, 0x01, 0x07, 0x1e, 0x01, 0x1f, 0x01, 0x07, 0x27, 0x2e, 0x01, 0x27,
+  0x16, 0x1d, 0x01, 0x01, 0x62, 0x05, 0x07, 0x14, 0x21, 0xac, 0x2c, 0xac, 0x24, 0x25, 0x14, 0x23, 0x12, 0xad, 0x2c, 0xad, 0x23, 0x16, 0x09, 0x07,
+  0x58, 0x0e, 0x0b, 0x1b, 0x11, 0xac, 0x2c, 0xac, 0x11, 0x21, 0x12, 0x12, 0x21, 0x11, 0xad, 0x2c, 0xad, 0x12, 0x1c, 0x0b, 0x10, 0x03, 0x5f, 0xc5,
+  0x13, 0x22, 0x10, 0x19, 0x14, 0x63, 0x4b, 0x64, 0x15, 0x03, 0x02, 0x0b, 0x0c, 0x65, 0x4b, 0x64, 0x14, 0x20, 0x12, 0x25, 0x14, 0xc6, 0xc5, 0x29,
+  0x1f, 0x0f, 0x16, 0x0b, 0x63, 0x4b, 0x64, 0x0b, 0x0c, 0x02, 0x02, 0x0b, 0x0b, 0x65, 0x4b, 0x64, 0x0b, 0x16, 0x10, 0x21, 0x27, 0xc6, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x64, 0x00, 0xae, 0x04, 0x22, 0x04, 0x8e, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x11, 0x21, 0x15, 0x21, 0x11, 0x23, 0x11, 0x21, 0x35,
+  0x21, 0x11, 0x02, 0x8b, 0x01, 0x97, 0xfe, 0x69, 0x92, 0xfe, 0x6b, 0x01, 0x95, 0x04, 0x8e, 0xfe, 0x55, 0x87, 0xfe, 0x52, 0x01, 0xae, 0x87, 0x01,
+  0xab, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5e, 0xfe, 0xf1, 0x01, 0x50, 0x00, 0xec, 0x00, 0x1e, 0x00, 0x00, 0x37, 0x34, 0x3e, 0x02, 0x33, 0x32,
+  0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x27, 0x26, 0x35, 0x34, 0x37, 0x3e, 0x03, 0x37, 0x23, 0x22, 0x2e, 0x02, 0x5e, 0x11, 0x1f, 0x2c, 0x1a,
+  0x1e, 0x2f, 0x1f, 0x10, 0x1a, 0x30, 0x47, 0x2d, 0x1e, 0x0d, 0x0e, 0x0a, 0x1f, 0x20, 0x1b, 0x06, 0x0d, 0x1a, 0x2a, 0x1f, 0x11, 0x7b, 0x17, 0x29,
+  0x1f, 0x12, 0x16, 0x27, 0x33, 0x1e, 0x2d, 0x61, 0x5f, 0x5a, 0x26, 0x1d, 0x0c, 0x10, 0x0d, 0x0e, 0x0b, 0x25, 0x30, 0x3a, 0x21, 0x12, 0x21, 0x2d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x64, 0x02, 0x0c, 0x02, 0x52, 0x02, 0xa3, 0x00, 0x03, 0x00, 0x00, 0x13, 0x21, 0x15, 0x21, 0x64, 0x01,
+  0xee, 0xfe, 0x12, 0x02, 0xa3, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x58, 0xff, 0xf1, 0x01, 0x51, 0x00, 0xec, 0x00, 0x13,
+  0x00, 0x00, 0x37, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x58, 0x13, 0x21, 0x2e, 0x1a, 0x1a,
+  0x2e, 0x22, 0x13, 0x13, 0x22, 0x2e, 0x1a, 0x1a, 0x2e, 0x21, 0x13, 0x6e, 0x1a, 0x2e, 0x22, 0x14, 0x14, 0x22, 0x2e, 0x1a, 0x1b, 0x2d, 0x22, 0x13,
+  0x13, 0x22, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf4, 0xff, 0xa6, 0x02, 0xf6, 0x05, 0xc1, 0x00, 0x09, 0x00, 0x00, 0x17, 0x0e,
+  0x01, 0x2b, 0x01, 0x01, 0x3e, 0x01, 0x3b, 0x01, 0xa1, 0x0e, 0x37, 0x1d, 0x4b, 0x02, 0x59, 0x0d, 0x30, 0x21, 0x4b, 0x15, 0x23, 0x22, 0x05, 0xd9,
+  0x20, 0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3c, 0xff, 0xf1, 0x04, 0x4c, 0x05, 0xa9, 0x00, 0x13, 0x00, 0x27, 0x00, 0x00, 0x01, 0x14, 0x02, 0x0e,
+  0x01, 0x23, 0x22, 0x2e, 0x01, 0x02, 0x35, 0x34, 0x12, 0x3e, 0x01, 0x33, 0x32, 0x1e, 0x01, 0x12, 0x07, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02,
+  0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x04, 0x4c, 0x51, 0x8c, 0xbf, 0x6d, 0x6e, 0xbd, 0x8c, 0x50, 0x50, 0x8c, 0xbd, 0x6e, 0x6d, 0xbf,
+  0x8c, 0x51, 0xb9, 0x37, 0x5d, 0x7a, 0x42, 0x42, 0x7a, 0x5c, 0x37, 0x37, 0x5c, 0x7a, 0x42, 0x42, 0x7a, 0x5d, 0x37, 0x02, 0xcc, 0xbc, 0xfe, 0xed,
+  0xb4, 0x58, 0x58, 0xb4, 0x01, 0x13, 0xbc, 0xbc, 0x01, 0x14, 0xb5, 0x58, 0x58, 0xb5, 0xfe, 0xec, 0xbc, 0xa4, 0xdf, 0x88, 0x3b, 0x3b, 0x88, 0xdf,
+  0xa4, 0xa4, 0xde, 0x88, 0x3b, 0x3b, 0x88, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xca, 0x00, 0x00, 0x04, 0x1f, 0x05, 0x9c, 0x00, 0x12,
+  0x00, 0x00, 0x25, 0x21, 0x11, 0x34, 0x37, 0x05, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x2f, 0x01, 0x01, 0x33, 0x11, 0x21, 0x15, 0x21, 0x01, 0x1f, 0x01,
+  0x34, 0x03, 0xff, 0x00, 0x0a, 0x14, 0x09, 0x0f, 0x18, 0x06, 0x38, 0x01, 0xaa, 0x91, 0x01, 0x1a, 0xfd, 0x00, 0x88, 0x03, 0xd1, 0x2c, 0x2d, 0xdb,
+  0x08, 0x07, 0x0d, 0x09, 0x4d, 0x01, 0x71, 0xfa, 0xec, 0x88, 0x00, 0x00, 0x00, 0x01, 0x00, 0x68, 0x00, 0x00, 0x04, 0x24, 0x05, 0xa9, 0x00, 0x33,
+  0x00, 0x00, 0x01, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x01, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x1d, 0x01, 0x21, 0x35, 0x34, 0x36,
+  0x37, 0x01, 0x3e, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x2f, 0x01, 0x3e, 0x03, 0x02, 0x59,
+  0x5b, 0x9e, 0x73, 0x42, 0x30, 0x52, 0x6b, 0x3c, 0xfe, 0x87, 0x28, 0x52, 0x26, 0x01, 0xe0, 0x1d, 0x22, 0xfc, 0x44, 0x0f, 0x11, 0x01, 0xcb, 0x39,
+  0x5e, 0x43, 0x24, 0x28, 0x46, 0x5e, 0x36, 0x36, 0x5c, 0x47, 0x31, 0x0a, 0x08, 0x20, 0x1a, 0x05, 0x0b, 0x07, 0x5d, 0x0e, 0x50, 0x7b, 0x9f, 0x05,
+  0xa9, 0x36, 0x67, 0x94, 0x5e, 0x50, 0x88, 0x7d, 0x75, 0x3d, 0xfe, 0x7e, 0x0b, 0x0d, 0x22, 0x1b, 0x6c, 0x3d, 0x13, 0x28, 0x11, 0x01, 0xcd, 0x3a,
+  0x6b, 0x6c, 0x6f, 0x3f, 0x3f, 0x5f, 0x3e, 0x1f, 0x20, 0x39, 0x4e, 0x2f, 0x1d, 0x1a, 0x01, 0x01, 0x10, 0x62, 0x97, 0x66, 0x35, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x6c, 0xff, 0xf0, 0x04, 0x2e, 0x05, 0xa9, 0x00, 0x4a, 0x00, 0x00, 0x01, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x1e,
+  0x01, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x37, 0x36, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x03, 0x33, 0x32, 0x3e,
+  0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x35, 0x3e, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x2f,
+  0x01, 0x3e, 0x03, 0x02, 0x6c, 0x5b, 0x9a, 0x6f, 0x3e, 0x23, 0x41, 0x5c, 0x39, 0x8c, 0x8d, 0x4b, 0x82, 0xad, 0x63, 0x72, 0xa2, 0x70, 0x48, 0x19,
+  0x4c, 0x15, 0x15, 0x14, 0x1f, 0x08, 0x02, 0x04, 0x02, 0x0e, 0x28, 0x44, 0x65, 0x4b, 0x4b, 0x71, 0x4b, 0x26, 0x1f, 0x51, 0x8f, 0x70, 0x5b, 0x81,
+  0x52, 0x25, 0x27, 0x44, 0x5d, 0x36, 0x36, 0x5c, 0x47, 0x30, 0x0c, 0x08, 0x20, 0x19, 0x05, 0x0b, 0x07, 0x5d, 0x0e, 0x50, 0x7b, 0x9f, 0x05, 0xa9,
+  0x34, 0x60, 0x88, 0x53, 0x44, 0x6b, 0x51, 0x38, 0x11, 0x25, 0xae, 0x83, 0x63, 0x9e, 0x6f, 0x3b, 0x39, 0x64, 0x89, 0x50, 0x20, 0x09, 0x11, 0x12,
+  0x04, 0x09, 0x05, 0x1d, 0x49, 0x40, 0x2c, 0x31, 0x4e, 0x60, 0x2f, 0x3a, 0x60, 0x46, 0x28, 0x81, 0x01, 0x26, 0x42, 0x5c, 0x38, 0x3e, 0x5c, 0x3c,
+  0x1e, 0x20, 0x39, 0x4f, 0x2e, 0x1d, 0x1a, 0x01, 0x01, 0x10, 0x62, 0x97, 0x66, 0x35, 0x00, 0x00, 0x00, 0x02, 0x00, 0x28, 0x00, 0x00, 0x04, 0x60,
+  0x05, 0x99, 0x00, 0x10, 0x00, 0x16, 0x00, 0x00, 0x01, 0x33, 0x15, 0x14, 0x06, 0x2b, 0x01, 0x11, 0x23, 0x11, 0x21, 0x22, 0x26, 0x2f, 0x01, 0x01,
+  0x33, 0x03, 0x34, 0x36, 0x37, 0x01, 0x21, 0x03, 0x87, 0xd9, 0x13, 0x14, 0xb2, 0x9d, 0xfd, 0x85, 0x14, 0x1d, 0x04, 0x12, 0x02, 0xb9, 0xa6, 0x9d,
+  0x03, 0x05, 0xfd, 0xf7, 0x02, 0x01, 0x02, 0x05, 0x66, 0x10, 0x16, 0xfe, 0x87, 0x01, 0x79, 0x17, 0x11, 0x5b, 0x03, 0x9d, 0xfe, 0xbb, 0x1a, 0x3c,
+  0x20, 0xfd, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x6c, 0xff, 0xf0, 0x03, 0xfe, 0x05, 0x99, 0x00, 0x2e, 0x00, 0x00, 0x01, 0x14,
+  0x06, 0x23, 0x21, 0x03, 0x36, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x37, 0x36, 0x33, 0x32, 0x1e, 0x02,
+  0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x07, 0x27, 0x13, 0x21, 0x03, 0xd2, 0x30, 0x39, 0xfe, 0x3e, 0x42, 0x70, 0x5f,
+  0x70, 0xab, 0x74, 0x3b, 0x50, 0x8b, 0xbc, 0x6d, 0x3f, 0x74, 0x64, 0x56, 0x21, 0x36, 0x12, 0x1e, 0x13, 0x33, 0x48, 0x61, 0x43, 0x4b, 0x78, 0x55,
+  0x2e, 0x27, 0x4f, 0x76, 0x4f, 0x36, 0x74, 0x3e, 0x70, 0x74, 0x02, 0xa7, 0x05, 0x4b, 0x26, 0x31, 0xfe, 0x88, 0x18, 0x42, 0x74, 0x9e, 0x5d, 0x72,
+  0xb8, 0x83, 0x46, 0x19, 0x2a, 0x36, 0x1e, 0x4c, 0x1a, 0x1f, 0x26, 0x1f, 0x30, 0x59, 0x7c, 0x4d, 0x43, 0x6c, 0x4c, 0x2a, 0x12, 0x14, 0x21, 0x02,
+  0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x6c, 0xff, 0xf0, 0x04, 0x32, 0x05, 0x99, 0x00, 0x1a, 0x00, 0x2e, 0x00, 0x00, 0x01, 0x32, 0x1e, 0x02,
+  0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x37, 0x01, 0x3e, 0x01, 0x3b, 0x01, 0x01, 0x3e, 0x01, 0x01, 0x14, 0x1e, 0x02,
+  0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x02, 0x8a, 0x56, 0x9a, 0x74, 0x44, 0x48, 0x81, 0xb6, 0x6d, 0x6c, 0xaf,
+  0x7c, 0x43, 0x54, 0x5b, 0x01, 0x6b, 0x0e, 0x32, 0x20, 0x9e, 0xfe, 0x0f, 0x33, 0x7c, 0xfe, 0xd6, 0x28, 0x4d, 0x6f, 0x47, 0x48, 0x74, 0x53, 0x2d,
+  0x2c, 0x50, 0x70, 0x43, 0x48, 0x74, 0x51, 0x2b, 0x03, 0x6e, 0x39, 0x6d, 0x9f, 0x66, 0x63, 0xaa, 0x7e, 0x48, 0x45, 0x7f, 0xb5, 0x70, 0x5e, 0xd4,
+  0x7a, 0x01, 0xe9, 0x12, 0x19, 0xfd, 0x8b, 0x23, 0x27, 0xfe, 0x4c, 0x45, 0x72, 0x52, 0x2d, 0x2e, 0x52, 0x70, 0x42, 0x46, 0x71, 0x4f, 0x2a, 0x31,
+  0x53, 0x6d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x6e, 0x00, 0x00, 0x04, 0x3c, 0x05, 0x99, 0x00, 0x12, 0x00, 0x00, 0x01, 0x15, 0x14, 0x06, 0x07, 0x01,
+  0x0e, 0x01, 0x2b, 0x01, 0x01, 0x3e, 0x01, 0x37, 0x21, 0x22, 0x26, 0x3d, 0x01, 0x04, 0x3c, 0x0f, 0x08, 0xfd, 0xaf, 0x0d, 0x2e, 0x27, 0x7f, 0x02,
+  0x5a, 0x0d, 0x1b, 0x11, 0xfd, 0x14, 0x11, 0x1b, 0x05, 0x99, 0x50, 0x22, 0x2c, 0x0f, 0xfb, 0x53, 0x1a, 0x25, 0x04, 0x9e, 0x19, 0x2a, 0x13, 0x1b,
+  0x11, 0x79, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0xff, 0xf0, 0x04, 0x26, 0x05, 0xa9, 0x00, 0x1f, 0x00, 0x33, 0x00, 0x47, 0x00, 0x00, 0x05, 0x22,
+  0x2e, 0x02, 0x35, 0x34, 0x36, 0x37, 0x2e, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x07, 0x1e, 0x01, 0x15, 0x14,
+  0x0e, 0x02, 0x27, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x13, 0x32, 0x3e, 0x02, 0x35, 0x34,
+  0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x02, 0x43, 0x6b, 0xb2, 0x80, 0x46, 0x90, 0x86, 0x71, 0x73, 0x3e, 0x72, 0x9f, 0x62,
+  0x61, 0xa0, 0x72, 0x3e, 0x74, 0x70, 0x86, 0x90, 0x47, 0x7f, 0xb2, 0x6b, 0x46, 0x6f, 0x4d, 0x29, 0x31, 0x53, 0x6c, 0x3b, 0x3b, 0x6c, 0x53, 0x31,
+  0x29, 0x4d, 0x6f, 0x46, 0x46, 0x63, 0x3e, 0x1c, 0x21, 0x41, 0x61, 0x40, 0x40, 0x61, 0x41, 0x21, 0x1c, 0x3e, 0x63, 0x10, 0x39, 0x6a, 0x97, 0x5e,
+  0x8a, 0xb3, 0x26, 0x2a, 0xa7, 0x74, 0x4f, 0x8a, 0x66, 0x3a, 0x3a, 0x66, 0x8a, 0x4f, 0x74, 0xa7, 0x2a, 0x26, 0xb3, 0x8a, 0x5e, 0x97, 0x6a, 0x39,
+  0x8e, 0x27, 0x47, 0x63, 0x3c, 0x4a, 0x69, 0x42, 0x1f, 0x1f, 0x42, 0x69, 0x4a, 0x3c, 0x63, 0x47, 0x27, 0x02, 0xb0, 0x2b, 0x47, 0x5c, 0x31, 0x32,
+  0x58, 0x42, 0x26, 0x26, 0x42, 0x58, 0x32, 0x31, 0x5c, 0x47, 0x2b, 0x00, 0x00, 0x02, 0x00, 0x94, 0x00, 0x00, 0x04, 0x36, 0x05, 0xa9, 0x00, 0x1f,
+  0x00, 0x33, 0x00, 0x00, 0x01, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x01, 0x0e, 0x01,
+  0x2b, 0x01, 0x01, 0x3e, 0x01, 0x37, 0x0e, 0x01, 0x01, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02,
+  0x02, 0x25, 0x51, 0x91, 0x6e, 0x41, 0x46, 0x7e, 0xae, 0x68, 0x67, 0xa8, 0x78, 0x41, 0x17, 0x2c, 0x3d, 0x27, 0xfe, 0xa3, 0x0d, 0x30, 0x1f, 0xa4,
+  0x01, 0xb4, 0x16, 0x26, 0x11, 0x37, 0x8a, 0x01, 0x19, 0x2b, 0x4c, 0x69, 0x3f, 0x42, 0x6d, 0x4d, 0x2a, 0x27, 0x49, 0x69, 0x41, 0x48, 0x6f, 0x4c,
+  0x28, 0x02, 0x4c, 0x36, 0x69, 0x99, 0x63, 0x5e, 0xa4, 0x7a, 0x46, 0x44, 0x7a, 0xaa, 0x67, 0x3e, 0x6f, 0x6a, 0x69, 0x38, 0xfe, 0x08, 0x13, 0x17,
+  0x02, 0x3b, 0x1d, 0x34, 0x1a, 0x2c, 0x2e, 0x01, 0xa3, 0x43, 0x6d, 0x4c, 0x29, 0x2b, 0x4c, 0x6a, 0x3f, 0x44, 0x6b, 0x4a, 0x26, 0x2f, 0x4e, 0x66,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0xff, 0xf1, 0x01, 0x79, 0x03, 0xda, 0x00, 0x13, 0x00, 0x27, 0x00, 0x00, 0x37, 0x34, 0x3e, 0x02,
+  0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02,
+  0x23, 0x22, 0x2e, 0x02, 0x80, 0x13, 0x21, 0x2e, 0x1a, 0x1a, 0x2e, 0x22, 0x13, 0x13, 0x22, 0x2e, 0x1a, 0x1a, 0x2e, 0x21, 0x13, 0x13, 0x21, 0x2e,
+  0x1a, 0x1a, 0x2e, 0x22, 0x13, 0x13, 0x22, 0x2e, 0x1a, 0x1a, 0x2e, 0x21, 0x13, 0x6e, 0x1a, 0x2e, 0x22, 0x14, 0x14, 0x22, 0x2e, 0x1a, 0x1b, 0x2d,
+  0x22, 0x13, 0x13, 0x22, 0x2d, 0x03, 0x09, 0x1a, 0x2e, 0x22, 0x14, 0x14, 0x22, 0x2e, 0x1a, 0x1b, 0x2d, 0x22, 0x13, 0x13, 0x22, 0x2d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0xfe, 0xf1, 0x01, 0x79, 0x03, 0xda, 0x00, 0x1e, 0x00, 0x32, 0x00, 0x00, 0x37, 0x34, 0x3e, 0x02,
+  0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x27, 0x26, 0x35, 0x34, 0x37, 0x3e, 0x03, 0x37, 0x23, 0x22, 0x2e, 0x02, 0x03, 0x34, 0x3e,
+  0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x86, 0x11, 0x1f, 0x2c, 0x1a, 0x1e, 0x2f, 0x1f, 0x10, 0x1a, 0x30,
+  0x47, 0x2d, 0x1e, 0x0d, 0x0e, 0x0a, 0x1f, 0x20, 0x1b, 0x06, 0x0d, 0x1a, 0x2a, 0x1f, 0x11, 0x06, 0x13, 0x21, 0x2e, 0x1a, 0x1a, 0x2e, 0x22, 0x13,
+  0x13, 0x22, 0x2e, 0x1a, 0x1a, 0x2e, 0x21, 0x13, 0x7b, 0x17, 0x29, 0x1f, 0x12, 0x16, 0x27, 0x33, 0x1e, 0x2d, 0x61, 0x5f, 0x5a, 0x26, 0x1d, 0x0c,
+  0x10, 0x0d, 0x0e, 0x0b, 0x25, 0x30, 0x3a, 0x21, 0x12, 0x21, 0x2d, 0x02, 0xfc, 0x1a, 0x2e, 0x22, 0x14, 0x14, 0x22, 0x2e, 0x1a, 0x1b, 0x2d, 0x22,
+  0x13, 0x13, 0x22, 0x2d, 0x00, 0x01, 0x00, 0x94, 0x00, 0xea, 0x03, 0x9a, 0x04, 0x57, 0x00, 0x12, 0x00, 0x00, 0x13, 0x01, 0x15, 0x14, 0x06, 0x07,
+  0x05, 0x0e, 0x01, 0x07, 0x1e, 0x01, 0x17, 0x05, 0x1e, 0x01, 0x1d, 0x01, 0x01, 0x94, 0x03, 0x06, 0x10, 0x14, 0xfe, 0x3f, 0x14, 0x2d, 0x19, 0x19,
+  0x2d, 0x14, 0x01, 0xc1, 0x14, 0x10, 0xfc, 0xfa, 0x02, 0xc6, 0x01, 0x91, 0x7f, 0x11, 0x19, 0x0a, 0xe4, 0x0b, 0x0f, 0x06, 0x05, 0x10, 0x0a, 0xe3,
+  0x0a, 0x1a, 0x10, 0x80, 0x01, 0x92, 0x00, 0x00, 0x00, 0x02, 0x00, 0x96, 0x01, 0xb7, 0x03, 0xf1, 0x03, 0x8d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+  0x13, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x96, 0x03, 0x5b, 0xfc, 0xa5, 0x03, 0x5b, 0xfc, 0xa5, 0x02, 0x3e, 0x87, 0x01, 0xd6, 0x87, 0x00,
+  0x00, 0x01, 0x00, 0xee, 0x00, 0xea, 0x03, 0xf3, 0x04, 0x57, 0x00, 0x12, 0x00, 0x00, 0x37, 0x35, 0x34, 0x36, 0x37, 0x25, 0x3e, 0x01, 0x37, 0x2e,
+  0x01, 0x27, 0x25, 0x2e, 0x01, 0x3d, 0x01, 0x01, 0x15, 0xee, 0x10, 0x14, 0x01, 0xc1, 0x14, 0x2b, 0x19, 0x19, 0x2b, 0x14, 0xfe, 0x3f, 0x14, 0x10,
+  0x03, 0x05, 0xea, 0x80, 0x10, 0x1a, 0x0a, 0xe3, 0x0a, 0x10, 0x05, 0x06, 0x0f, 0x0b, 0xe4, 0x0a, 0x19, 0x11, 0x7f, 0xfe, 0x6f, 0x4a, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x22, 0xff, 0xf1, 0x02, 0xf8, 0x05, 0xa9, 0x00, 0x28, 0x00, 0x3c, 0x00, 0x00, 0x13, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x15,
+  0x14, 0x0e, 0x04, 0x0f, 0x01, 0x23, 0x27, 0x35, 0x34, 0x3e, 0x04, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x23, 0x22, 0x27, 0x13, 0x34,
+  0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x22, 0x1f, 0x4b, 0x59, 0x67, 0x3c, 0x4f, 0x87, 0x62, 0x38,
+  0x2d, 0x45, 0x52, 0x47, 0x33, 0x04, 0x12, 0x7a, 0x0c, 0x2d, 0x45, 0x4f, 0x45, 0x2d, 0x22, 0x3a, 0x4f, 0x2d, 0x3d, 0x57, 0x3c, 0x25, 0x0c, 0x19,
+  0x0e, 0x95, 0x13, 0x21, 0x2e, 0x1a, 0x1a, 0x2e, 0x22, 0x13, 0x13, 0x22, 0x2e, 0x1a, 0x1a, 0x2e, 0x21, 0x13, 0x05, 0x19, 0x1d, 0x34, 0x28, 0x17,
+  0x2e, 0x54, 0x78, 0x4b, 0x4c, 0x6e, 0x53, 0x3d, 0x36, 0x36, 0x21, 0x99, 0xa6, 0x0b, 0x2a, 0x41, 0x39, 0x39, 0x45, 0x58, 0x3c, 0x2b, 0x46, 0x31,
+  0x1a, 0x1e, 0x24, 0x1e, 0x17, 0xfb, 0xa0, 0x1a, 0x2e, 0x22, 0x14, 0x14, 0x22, 0x2e, 0x1a, 0x1b, 0x2d, 0x22, 0x13, 0x13, 0x22, 0x2d, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x56, 0xff, 0x11, 0x06, 0x1c, 0x05, 0x4f, 0x00, 0x51, 0x00, 0x61, 0x00, 0x00, 0x25, 0x22, 0x26, 0x27, 0x0e, 0x01, 0x23, 0x22,
+  0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x03, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02,
+  0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x12, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, 0x36, 0x33, 0x32, 0x1f, 0x01, 0x06, 0x04, 0x23, 0x22, 0x24, 0x26,
+  0x02, 0x35, 0x34, 0x3e, 0x04, 0x33, 0x32, 0x1e, 0x04, 0x15, 0x14, 0x0e, 0x02, 0x25, 0x32, 0x3e, 0x02, 0x37, 0x13, 0x26, 0x23, 0x22, 0x0e, 0x02,
+  0x15, 0x14, 0x16, 0x04, 0x8f, 0x4e, 0x62, 0x0d, 0x3a, 0x88, 0x4e, 0x3c, 0x58, 0x3b, 0x1d, 0x41, 0x80, 0xbf, 0x7d, 0x43, 0x65, 0x2d, 0x5d, 0x13,
+  0x12, 0x1f, 0x29, 0x17, 0x31, 0x58, 0x43, 0x27, 0x59, 0x9b, 0xd3, 0x7a, 0x86, 0xea, 0xae, 0x64, 0x6b, 0xb9, 0xf9, 0x8f, 0x98, 0xe9, 0x55, 0x0f,
+  0x0c, 0x15, 0x0a, 0x19, 0x6b, 0xfe, 0xef, 0xad, 0xad, 0xfe, 0xd6, 0xdb, 0x7d, 0x37, 0x64, 0x8c, 0xac, 0xc6, 0x6c, 0x5c, 0xb0, 0x9d, 0x84, 0x5f,
+  0x35, 0x3d, 0x6b, 0x91, 0xfe, 0x02, 0x1f, 0x3f, 0x3b, 0x31, 0x11, 0x4c, 0x27, 0x2e, 0x4b, 0x7d, 0x5a, 0x33, 0x42, 0xba, 0x4b, 0x4e, 0x51, 0x46,
+  0x29, 0x49, 0x64, 0x3a, 0x55, 0xad, 0x8b, 0x58, 0x15, 0x14, 0xfe, 0x97, 0x4b, 0x31, 0x24, 0x2f, 0x1b, 0x0a, 0x38, 0x66, 0x8f, 0x57, 0x8a, 0xd0,
+  0x8b, 0x45, 0x66, 0xb4, 0xf6, 0x91, 0xaa, 0xfe, 0xff, 0xae, 0x58, 0x42, 0x33, 0x09, 0x18, 0x42, 0x48, 0x52, 0x6e, 0xcf, 0x01, 0x2c, 0xbe, 0x6d,
+  0xca, 0xaf, 0x91, 0x67, 0x39, 0x28, 0x4e, 0x73, 0x95, 0xb7, 0x6b, 0x6c, 0xb7, 0x86, 0x4c, 0x78, 0x14, 0x32, 0x56, 0x41, 0x01, 0x27, 0x09, 0x3f,
+  0x66, 0x84, 0x45, 0x48, 0x57, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x00, 0x05, 0x49, 0x05, 0x99, 0x00, 0x0d, 0x00, 0x15, 0x00, 0x00,
+  0x21, 0x23, 0x22, 0x26, 0x27, 0x03, 0x21, 0x03, 0x0e, 0x01, 0x2b, 0x01, 0x01, 0x33, 0x01, 0x21, 0x03, 0x26, 0x27, 0x0e, 0x01, 0x07, 0x05, 0x49,
+  0x96, 0x1a, 0x20, 0x08, 0x86, 0xfd, 0x7d, 0x86, 0x07, 0x22, 0x19, 0x96, 0x02, 0x3d, 0xc5, 0xfe, 0x92, 0x02, 0x17, 0xe1, 0x16, 0x15, 0x0b, 0x15,
+  0x0a, 0x1a, 0x14, 0x01, 0x5a, 0xfe, 0xa6, 0x12, 0x1c, 0x05, 0x99, 0xfc, 0x7b, 0x02, 0x47, 0x36, 0x51, 0x29, 0x45, 0x1a, 0x00, 0x03, 0x00, 0xae,
+  0x00, 0x00, 0x04, 0xa0, 0x05, 0x99, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x2a, 0x00, 0x00, 0x33, 0x11, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02,
+  0x07, 0x1e, 0x01, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x01, 0x11, 0x21, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x23, 0x25, 0x21, 0x32, 0x3e, 0x02, 0x35,
+  0x34, 0x26, 0x23, 0x21, 0xae, 0x01, 0xc9, 0x84, 0xbf, 0x7b, 0x3b, 0x21, 0x43, 0x65, 0x44, 0x9d, 0xa0, 0x43, 0x81, 0xbb, 0x78, 0xfe, 0xc7, 0x01,
+  0x36, 0x53, 0x77, 0x4d, 0x24, 0x9d, 0x9f, 0xfe, 0xcb, 0x01, 0x00, 0x52, 0x78, 0x4f, 0x26, 0x98, 0xa0, 0xfe, 0xf9, 0x05, 0x99, 0x34, 0x60, 0x8b,
+  0x57, 0x35, 0x62, 0x54, 0x42, 0x15, 0x1f, 0xa4, 0x86, 0x5b, 0x96, 0x6c, 0x3b, 0x02, 0x8d, 0xfe, 0x0d, 0x26, 0x45, 0x5f, 0x39, 0x6f, 0x81, 0x8a,
+  0x24, 0x40, 0x5b, 0x36, 0x7e, 0x76, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5a, 0xff, 0xf0, 0x05, 0x09, 0x05, 0xa9, 0x00, 0x2e, 0x00, 0x00, 0x01, 0x32,
+  0x1f, 0x01, 0x0e, 0x01, 0x23, 0x22, 0x2e, 0x01, 0x02, 0x35, 0x34, 0x12, 0x36, 0x24, 0x33, 0x32, 0x16, 0x17, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x2e,
+  0x04, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x04, 0xa0, 0x10, 0x0d, 0x4c, 0x58, 0xfb, 0xb1, 0x9b,
+  0xfc, 0xb2, 0x62, 0x69, 0xbe, 0x01, 0x09, 0xa0, 0x9e, 0xe5, 0x59, 0x3f, 0x07, 0x12, 0x11, 0x0d, 0x1d, 0x28, 0x36, 0x4a, 0x62, 0x40, 0x73, 0xbf,
+  0x8a, 0x4d, 0x4d, 0x85, 0xb6, 0x69, 0x40, 0x66, 0x57, 0x4b, 0x26, 0x11, 0x01, 0x28, 0x0d, 0x53, 0x66, 0x72, 0x6b, 0xc1, 0x01, 0x0e, 0xa2, 0xa2,
+  0x01, 0x0e, 0xc2, 0x6b, 0x62, 0x54, 0x59, 0x0a, 0x0d, 0x13, 0x1c, 0x20, 0x1c, 0x13, 0x4f, 0x92, 0xd2, 0x82, 0x86, 0xd2, 0x91, 0x4c, 0x0f, 0x20,
+  0x31, 0x22, 0x0f, 0x00, 0x00, 0x02, 0x00, 0xae, 0x00, 0x00, 0x05, 0x88, 0x05, 0x99, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x00, 0x01, 0x14, 0x02, 0x06,
+  0x04, 0x23, 0x21, 0x11, 0x21, 0x32, 0x04, 0x16, 0x12, 0x07, 0x34, 0x2e, 0x02, 0x23, 0x21, 0x11, 0x21, 0x32, 0x3e, 0x02, 0x05, 0x88, 0x66, 0xba,
+  0xfe, 0xfc, 0x9e, 0xfd, 0xe8, 0x02, 0x18, 0x9e, 0x01, 0x04, 0xba, 0x66, 0xc7, 0x48, 0x84, 0xbc, 0x73, 0xfe, 0xab, 0x01, 0x55, 0x73, 0xbc, 0x84,
+  0x48, 0x02, 0xcc, 0xa1, 0xfe, 0xf8, 0xbc, 0x67, 0x05, 0x99, 0x67, 0xbd, 0xfe, 0xf8, 0xa1, 0x84, 0xd0, 0x90, 0x4c, 0xfb, 0xa1, 0x4c, 0x8f, 0xd0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xae, 0x00, 0x00, 0x04, 0x21, 0x05, 0x99, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x15, 0x21, 0x11, 0x21, 0x15,
+  0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x04, 0x21, 0xfd, 0x50, 0x02, 0x2d, 0xfd, 0xd3, 0x02, 0xb0, 0xfc, 0x8d, 0x05, 0x99, 0x9e, 0xfe, 0x24, 0x98,
+  0xfe, 0x17, 0x9e, 0x05, 0x99, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xae, 0x00, 0x00, 0x04, 0x21, 0x05, 0x99, 0x00, 0x09, 0x00, 0x00, 0x01, 0x15,
+  0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x23, 0x11, 0x04, 0x21, 0xfd, 0x50, 0x02, 0x4c, 0xfd, 0xb4, 0xc3, 0x05, 0x99, 0x9e, 0xfe, 0x0b, 0x9e, 0xfd,
+  0x98, 0x05, 0x99, 0x00, 0x00, 0x01, 0x00, 0x5a, 0xff, 0xf0, 0x05, 0x40, 0x05, 0xa9, 0x00, 0x34, 0x00, 0x00, 0x25, 0x32, 0x3e, 0x02, 0x37, 0x11,
+  0x23, 0x22, 0x26, 0x3d, 0x01, 0x21, 0x11, 0x0e, 0x03, 0x23, 0x22, 0x24, 0x26, 0x02, 0x35, 0x34, 0x12, 0x36, 0x24, 0x33, 0x32, 0x1e, 0x02, 0x17,
+  0x07, 0x06, 0x23, 0x22, 0x27, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x03, 0x2d, 0x3a, 0x61, 0x56, 0x4c, 0x26, 0xde, 0x13,
+  0x17, 0x01, 0xb8, 0x36, 0x75, 0x85, 0x98, 0x59, 0x9c, 0xfe, 0xfc, 0xbc, 0x69, 0x67, 0xbf, 0x01, 0x0f, 0xa8, 0x55, 0x92, 0x7d, 0x6a, 0x2e, 0x37,
+  0x11, 0x1b, 0x10, 0x13, 0x19, 0x3e, 0x59, 0x79, 0x53, 0x79, 0xc4, 0x8a, 0x4a, 0x4d, 0x8c, 0xc0, 0x8d, 0x0b, 0x16, 0x1f, 0x14, 0x01, 0x3c, 0x16,
+  0x10, 0x6e, 0xfd, 0xda, 0x27, 0x3a, 0x27, 0x13, 0x6b, 0xc1, 0x01, 0x0e, 0xa2, 0xa4, 0x01, 0x0e, 0xc1, 0x6a, 0x19, 0x2f, 0x43, 0x2a, 0x58, 0x1b,
+  0x0b, 0x0e, 0x28, 0x25, 0x1a, 0x4f, 0x93, 0xd1, 0x82, 0x88, 0xd5, 0x94, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xae, 0x00, 0x00, 0x05, 0x38,
+  0x05, 0x99, 0x00, 0x0b, 0x00, 0x00, 0x21, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x05, 0x38, 0xc3, 0xfc, 0xfc, 0xc3,
+  0xc3, 0x03, 0x04, 0xc3, 0x02, 0x8c, 0xfd, 0x74, 0x05, 0x99, 0xfd, 0x81, 0x02, 0x7f, 0x00, 0x00, 0x00, 0x01, 0x00, 0xd2, 0x00, 0x00, 0x01, 0x94,
+  0x05, 0x99, 0x00, 0x03, 0x00, 0x00, 0x21, 0x23, 0x11, 0x33, 0x01, 0x94, 0xc2, 0xc2, 0x05, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3c,
+  0xff, 0xf0, 0x02, 0xc9, 0x05, 0x99, 0x00, 0x17, 0x00, 0x00, 0x01, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x27, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x33, 0x32,
+  0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x11, 0x33, 0x02, 0xc9, 0x3b, 0x73, 0xa8, 0x6d, 0x61, 0x69, 0x02, 0x06, 0x03, 0x02, 0x15, 0x15, 0x12, 0x3c,
+  0x32, 0x42, 0x67, 0x47, 0x25, 0xc1, 0x01, 0xef, 0x78, 0xbe, 0x83, 0x46, 0x1c, 0x1d, 0x39, 0x1c, 0x11, 0x15, 0x12, 0x28, 0x54, 0x83, 0x5a, 0x03,
+  0xae, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc2, 0x00, 0x00, 0x05, 0x3a, 0x05, 0x99, 0x00, 0x22, 0x00, 0x00, 0x01, 0x33, 0x32, 0x36, 0x37, 0x01,
+  0x3e, 0x01, 0x3b, 0x01, 0x01, 0x0e, 0x01, 0x07, 0x1e, 0x01, 0x17, 0x01, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x01, 0x2e, 0x03, 0x2b, 0x01, 0x11, 0x23,
+  0x11, 0x33, 0x01, 0x83, 0x49, 0x26, 0x2d, 0x14, 0x01, 0xdd, 0x16, 0x29, 0x20, 0xa5, 0xfd, 0xde, 0x15, 0x25, 0x15, 0x1c, 0x2a, 0x17, 0x02, 0x3a,
+  0xa8, 0x13, 0x1a, 0x13, 0x10, 0x08, 0xfe, 0x11, 0x0b, 0x13, 0x19, 0x21, 0x18, 0x58, 0xc1, 0xc1, 0x03, 0x25, 0x13, 0x17, 0x02, 0x1c, 0x19, 0x15,
+  0xfd, 0x97, 0x17, 0x20, 0x0a, 0x09, 0x24, 0x1b, 0xfd, 0x59, 0x06, 0x0a, 0x10, 0x09, 0x02, 0x39, 0x0c, 0x11, 0x0c, 0x05, 0xfd, 0x70, 0x05, 0x99,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xae, 0x00, 0x00, 0x03, 0xdc, 0x05, 0x99, 0x00, 0x05, 0x00, 0x00, 0x25, 0x21, 0x15, 0x21, 0x11, 0x33,
+  0x01, 0x70, 0x02, 0x6c, 0xfc, 0xd2, 0xc2, 0xa3, 0xa3, 0x05, 0x99, 0x00, 0x00, 0x01, 0x00, 0xae, 0x00, 0x00, 0x06, 0x81, 0x05, 0x99, 0x00, 0x23,
+  0x00, 0x00, 0x01, 0x1e, 0x01, 0x17, 0x3e, 0x01, 0x37, 0x01, 0x3e, 0x01, 0x3b, 0x01, 0x11, 0x23, 0x11, 0x34, 0x36, 0x37, 0x01, 0x06, 0x2b, 0x01,
+  0x22, 0x27, 0x01, 0x1e, 0x01, 0x15, 0x11, 0x23, 0x11, 0x33, 0x32, 0x16, 0x17, 0x01, 0x03, 0x6f, 0x0e, 0x15, 0x0a, 0x0a, 0x16, 0x0e, 0x01, 0xe5,
+  0x0d, 0x1c, 0x1a, 0x8f, 0xaa, 0x02, 0x02, 0xfe, 0x15, 0x19, 0x2d, 0x1c, 0x2d, 0x19, 0xfe, 0x0a, 0x03, 0x03, 0xaa, 0x8f, 0x1a, 0x1c, 0x0d, 0x01,
+  0xef, 0x02, 0x06, 0x18, 0x35, 0x1b, 0x1c, 0x33, 0x1a, 0x03, 0x71, 0x17, 0x0a, 0xfa, 0x67, 0x04, 0x1d, 0x15, 0x30, 0x19, 0xfc, 0x80, 0x2d, 0x2d,
+  0x03, 0x83, 0x1a, 0x32, 0x15, 0xfb, 0xe3, 0x05, 0x99, 0x0a, 0x17, 0xfc, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xae, 0x00, 0x00, 0x05, 0x38,
+  0x05, 0x99, 0x00, 0x16, 0x00, 0x00, 0x01, 0x32, 0x16, 0x17, 0x01, 0x2e, 0x01, 0x35, 0x11, 0x33, 0x11, 0x23, 0x22, 0x26, 0x27, 0x01, 0x1e, 0x01,
+  0x15, 0x11, 0x23, 0x11, 0x33, 0x01, 0x12, 0x1a, 0x19, 0x10, 0x03, 0x3e, 0x03, 0x02, 0xaa, 0x62, 0x17, 0x1f, 0x0f, 0xfc, 0xc3, 0x02, 0x02, 0xaa,
+  0x64, 0x05, 0x99, 0x0d, 0x14, 0xfb, 0xc8, 0x1a, 0x31, 0x17, 0x03, 0xf7, 0xfa, 0x67, 0x10, 0x13, 0x04, 0x37, 0x19, 0x30, 0x14, 0xfc, 0x03, 0x05,
+  0x99, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5c, 0xff, 0xf1, 0x05, 0xe1, 0x05, 0xa9, 0x00, 0x13, 0x00, 0x27, 0x00, 0x00, 0x01, 0x14, 0x02, 0x06,
+  0x04, 0x23, 0x22, 0x24, 0x26, 0x02, 0x35, 0x34, 0x12, 0x36, 0x24, 0x33, 0x32, 0x04, 0x16, 0x12, 0x07, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02,
+  0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x05, 0xe1, 0x66, 0xba, 0xfe, 0xfb, 0x9e, 0x9e, 0xfe, 0xfc, 0xba, 0x66, 0x66, 0xba, 0x01, 0x04,
+  0x9e, 0x9e, 0x01, 0x05, 0xba, 0x66, 0xc7, 0x48, 0x84, 0xbc, 0x74, 0x73, 0xbc, 0x85, 0x48, 0x48, 0x85, 0xbc, 0x73, 0x74, 0xbc, 0x84, 0x48, 0x02,
+  0xcc, 0xa1, 0xfe, 0xf3, 0xc2, 0x6b, 0x6b, 0xc2, 0x01, 0x0d, 0xa1, 0xa1, 0x01, 0x0d, 0xc3, 0x6c, 0x6c, 0xc3, 0xfe, 0xf3, 0xa1, 0x84, 0xd2, 0x91,
+  0x4e, 0x4e, 0x91, 0xd2, 0x84, 0x84, 0xd1, 0x91, 0x4d, 0x4d, 0x91, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc2, 0x00, 0x00, 0x04, 0x7f,
+  0x05, 0x99, 0x00, 0x0e, 0x00, 0x19, 0x00, 0x00, 0x01, 0x11, 0x23, 0x11, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x27, 0x33, 0x32,
+  0x3e, 0x02, 0x35, 0x34, 0x26, 0x2b, 0x01, 0x01, 0x83, 0xc1, 0x01, 0xa7, 0x88, 0xc9, 0x84, 0x41, 0x46, 0x87, 0xc8, 0x81, 0xe6, 0xe6, 0x53, 0x7f,
+  0x56, 0x2c, 0xa9, 0xab, 0xe6, 0x02, 0x18, 0xfd, 0xe8, 0x05, 0x99, 0x3f, 0x74, 0xa4, 0x65, 0x64, 0xa6, 0x78, 0x43, 0x9a, 0x2c, 0x4f, 0x6e, 0x42,
+  0x89, 0x9a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5c, 0xfe, 0xd8, 0x06, 0x24, 0x05, 0xa9, 0x00, 0x1c, 0x00, 0x30, 0x00, 0x00, 0x01, 0x14, 0x0e, 0x02,
+  0x07, 0x01, 0x23, 0x22, 0x26, 0x27, 0x03, 0x0e, 0x01, 0x23, 0x22, 0x24, 0x26, 0x02, 0x35, 0x34, 0x12, 0x36, 0x24, 0x33, 0x32, 0x04, 0x16, 0x12,
+  0x07, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x05, 0xe1, 0x29, 0x4e, 0x70, 0x46, 0x01, 0x70,
+  0xa0, 0x24, 0x38, 0x17, 0xfc, 0x39, 0x7b, 0x43, 0x9e, 0xfe, 0xfc, 0xba, 0x66, 0x66, 0xba, 0x01, 0x04, 0x9e, 0x9e, 0x01, 0x05, 0xba, 0x66, 0xc7,
+  0x48, 0x84, 0xbc, 0x74, 0x73, 0xbc, 0x85, 0x48, 0x48, 0x85, 0xbc, 0x73, 0x74, 0xbc, 0x84, 0x48, 0x02, 0xcc, 0x65, 0xb6, 0x9d, 0x80, 0x2f, 0xfe,
+  0x73, 0x14, 0x19, 0x01, 0x12, 0x12, 0x14, 0x6b, 0xc2, 0x01, 0x0d, 0xa1, 0xa1, 0x01, 0x0d, 0xc3, 0x6c, 0x6c, 0xc3, 0xfe, 0xf3, 0xa1, 0x84, 0xd2,
+  0x91, 0x4e, 0x4e, 0x91, 0xd2, 0x84, 0x84, 0xd1, 0x91, 0x4d, 0x4d, 0x91, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc2, 0x00, 0x00, 0x04, 0xe5,
+  0x05, 0x99, 0x00, 0x18, 0x00, 0x23, 0x00, 0x00, 0x01, 0x11, 0x23, 0x11, 0x21, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x16, 0x17, 0x01,
+  0x23, 0x22, 0x27, 0x01, 0x2e, 0x01, 0x23, 0x27, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x2b, 0x01, 0x01, 0x83, 0xc1, 0x01, 0x95, 0x88, 0xc6,
+  0x81, 0x3e, 0x30, 0x5b, 0x83, 0x53, 0x24, 0x1c, 0x01, 0xa2, 0xac, 0x35, 0x19, 0xfe, 0x8c, 0x11, 0x28, 0x28, 0x93, 0xcb, 0x55, 0x81, 0x57, 0x2c,
+  0xa9, 0xa7, 0xd4, 0x02, 0x56, 0xfd, 0xaa, 0x05, 0x99, 0x37, 0x68, 0x93, 0x5b, 0x4c, 0x84, 0x69, 0x4a, 0x13, 0x15, 0x28, 0xfd, 0xc7, 0x29, 0x02,
+  0x00, 0x18, 0x15, 0x8d, 0x29, 0x4b, 0x68, 0x3f, 0x80, 0x82, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3a, 0xff, 0xf0, 0x03, 0xdb, 0x05, 0xa9, 0x00, 0x3d,
+  0x00, 0x00, 0x01, 0x0e, 0x01, 0x23, 0x22, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x06, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26,
+  0x27, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x06, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17,
+  0x03, 0x8c, 0x09, 0x14, 0x10, 0x11, 0x2d, 0x45, 0x61, 0x45, 0x41, 0x64, 0x43, 0x22, 0x3b, 0x61, 0x7b, 0x81, 0x7b, 0x61, 0x3b, 0x40, 0x7b, 0xb3,
+  0x72, 0x8b, 0xe5, 0x51, 0x38, 0x08, 0x17, 0x0e, 0x15, 0x36, 0x51, 0x73, 0x53, 0x45, 0x6c, 0x4b, 0x28, 0x3b, 0x60, 0x7b, 0x81, 0x7b, 0x60, 0x3b,
+  0x3b, 0x70, 0xa5, 0x6b, 0x78, 0xc6, 0x4a, 0x04, 0xb9, 0x0f, 0x0f, 0x22, 0x29, 0x22, 0x23, 0x3c, 0x51, 0x2f, 0x3c, 0x4f, 0x38, 0x29, 0x2c, 0x37,
+  0x54, 0x7a, 0x59, 0x5e, 0xa5, 0x7a, 0x46, 0x65, 0x56, 0x5c, 0x0b, 0x0f, 0x2d, 0x36, 0x2d, 0x26, 0x45, 0x60, 0x3b, 0x41, 0x53, 0x38, 0x27, 0x29,
+  0x36, 0x56, 0x81, 0x5f, 0x4c, 0x8e, 0x6e, 0x42, 0x4c, 0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x04, 0x7e, 0x05, 0x99, 0x00, 0x07,
+  0x00, 0x00, 0x01, 0x15, 0x21, 0x11, 0x23, 0x11, 0x21, 0x35, 0x04, 0x7e, 0xfe, 0x31, 0xc2, 0xfe, 0x2f, 0x05, 0x99, 0xa3, 0xfb, 0x0a, 0x04, 0xf6,
+  0xa3, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa0, 0xff, 0xef, 0x05, 0x15, 0x05, 0x99, 0x00, 0x19, 0x00, 0x00, 0x25, 0x32, 0x3e, 0x02, 0x35, 0x11,
+  0x33, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1e, 0x02, 0x02, 0xdb, 0x59, 0x8c, 0x61, 0x33, 0xc1, 0x4f,
+  0x93, 0xd4, 0x84, 0x84, 0xd4, 0x94, 0x4f, 0xc1, 0x33, 0x61, 0x8d, 0x9a, 0x3c, 0x6c, 0x96, 0x5a, 0x03, 0x67, 0xfc, 0x99, 0x7c, 0xd4, 0x9b, 0x58,
+  0x58, 0x9b, 0xd4, 0x7c, 0x03, 0x67, 0xfc, 0x9a, 0x5a, 0x96, 0x6c, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x05, 0x47,
+  0x05, 0x99, 0x00, 0x12, 0x00, 0x00, 0x13, 0x33, 0x32, 0x16, 0x17, 0x01, 0x1e, 0x01, 0x17, 0x3e, 0x01, 0x37, 0x01, 0x3e, 0x01, 0x3b, 0x01, 0x01,
+  0x23, 0x08, 0x9b, 0x1a, 0x20, 0x08, 0x01, 0x95, 0x0e, 0x17, 0x0b, 0x09, 0x15, 0x0e, 0x01, 0x93, 0x07, 0x22, 0x19, 0x9c, 0xfd, 0xb8, 0xaf, 0x05,
+  0x99, 0x1a, 0x14, 0xfc, 0x0d, 0x22, 0x50, 0x2b, 0x2b, 0x50, 0x22, 0x03, 0xf3, 0x11, 0x1d, 0xfa, 0x67, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0e,
+  0x00, 0x00, 0x07, 0xe7, 0x05, 0x99, 0x00, 0x28, 0x00, 0x00, 0x13, 0x33, 0x32, 0x16, 0x17, 0x01, 0x1e, 0x01, 0x17, 0x3e, 0x01, 0x37, 0x01, 0x3e,
+  0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, 0x01, 0x16, 0x17, 0x3e, 0x01, 0x37, 0x01, 0x3e, 0x01, 0x3b, 0x01, 0x01, 0x23, 0x01, 0x26, 0x27, 0x0e, 0x01,
+  0x07, 0x01, 0x23, 0x0e, 0xa1, 0x1a, 0x22, 0x06, 0x01, 0x28, 0x08, 0x0d, 0x06, 0x07, 0x0e, 0x09, 0x01, 0x51, 0x06, 0x23, 0x19, 0x38, 0x1a, 0x21,
+  0x07, 0x01, 0x4f, 0x12, 0x0e, 0x06, 0x0a, 0x08, 0x01, 0x29, 0x05, 0x23, 0x19, 0x97, 0xfe, 0x41, 0xae, 0xfe, 0x95, 0x0b, 0x09, 0x05, 0x09, 0x05,
+  0xfe, 0x93, 0xae, 0x05, 0x99, 0x1a, 0x14, 0xfc, 0x1c, 0x1b, 0x3e, 0x22, 0x22, 0x3f, 0x1a, 0x03, 0xe4, 0x11, 0x1d, 0x1a, 0x14, 0xfc, 0x1c, 0x34,
+  0x43, 0x21, 0x3c, 0x1a, 0x03, 0xe4, 0x12, 0x1c, 0xfa, 0x67, 0x04, 0x45, 0x1f, 0x29, 0x14, 0x25, 0x0f, 0xfb, 0xbb, 0x00, 0x00, 0x01, 0x00, 0x0e,
+  0x00, 0x00, 0x04, 0xf6, 0x05, 0x99, 0x00, 0x1b, 0x00, 0x00, 0x09, 0x01, 0x33, 0x32, 0x16, 0x17, 0x01, 0x36, 0x37, 0x01, 0x3e, 0x01, 0x3b, 0x01,
+  0x09, 0x01, 0x23, 0x22, 0x26, 0x27, 0x01, 0x06, 0x07, 0x01, 0x0e, 0x01, 0x2b, 0x01, 0x01, 0xfb, 0xfe, 0x27, 0xc1, 0x15, 0x14, 0x08, 0x01, 0x76,
+  0x07, 0x0e, 0x01, 0x61, 0x09, 0x15, 0x0f, 0xb9, 0xfe, 0x25, 0x01, 0xeb, 0xc0, 0x16, 0x19, 0x08, 0xfe, 0x80, 0x07, 0x0b, 0xfe, 0x8a, 0x09, 0x17,
+  0x15, 0xb4, 0x02, 0xe0, 0x02, 0xb9, 0x0e, 0x0d, 0xfd, 0xc2, 0x15, 0x19, 0x02, 0x0c, 0x0e, 0x11, 0xfd, 0x50, 0xfd, 0x17, 0x17, 0x0e, 0x02, 0x59,
+  0x15, 0x13, 0xfd, 0xcf, 0x0e, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x04, 0xe4, 0x05, 0x99, 0x00, 0x14, 0x00, 0x00, 0x01, 0x11,
+  0x23, 0x11, 0x01, 0x33, 0x32, 0x16, 0x17, 0x01, 0x1e, 0x01, 0x17, 0x3e, 0x01, 0x37, 0x01, 0x3e, 0x01, 0x3b, 0x01, 0x02, 0xd6, 0xc1, 0xfd, 0xf3,
+  0xaa, 0x1a, 0x1e, 0x0b, 0x01, 0x48, 0x14, 0x1b, 0x0b, 0x0b, 0x1a, 0x14, 0x01, 0x47, 0x09, 0x1f, 0x19, 0xac, 0x02, 0x3a, 0xfd, 0xc6, 0x02, 0x3a,
+  0x03, 0x5f, 0x1a, 0x13, 0xfd, 0xd3, 0x23, 0x3e, 0x1e, 0x1f, 0x3e, 0x22, 0x02, 0x2d, 0x10, 0x1d, 0x00, 0x01, 0x00, 0x56, 0x00, 0x00, 0x04, 0x94,
+  0x05, 0x99, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x15, 0x14, 0x07, 0x01, 0x21, 0x15, 0x21, 0x35, 0x34, 0x37, 0x01, 0x21, 0x35, 0x04, 0x94, 0x15, 0xfc,
+  0xd5, 0x03, 0x32, 0xfb, 0xd0, 0x13, 0x03, 0x2c, 0xfc, 0xe7, 0x05, 0x99, 0x48, 0x22, 0x1e, 0xfb, 0x8d, 0x9e, 0x4c, 0x1e, 0x1b, 0x04, 0x76, 0x9e,
+  0x00, 0x01, 0x00, 0x8e, 0xfe, 0xdf, 0x01, 0xfe, 0x05, 0xfd, 0x00, 0x0d, 0x00, 0x00, 0x13, 0x11, 0x21, 0x15, 0x14, 0x06, 0x2b, 0x01, 0x11, 0x33,
+  0x32, 0x16, 0x1d, 0x01, 0x8e, 0x01, 0x70, 0x1b, 0x16, 0xa9, 0xa9, 0x16, 0x1b, 0xfe, 0xdf, 0x07, 0x1e, 0x46, 0x16, 0x19, 0xf9, 0xcd, 0x19, 0x17,
+  0x46, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xec, 0xff, 0xa6, 0x02, 0xef, 0x05, 0xc1, 0x00, 0x09, 0x00, 0x00, 0x03, 0x33, 0x32, 0x16, 0x17, 0x01,
+  0x23, 0x22, 0x26, 0x27, 0x14, 0x4c, 0x21, 0x30, 0x0d, 0x02, 0x59, 0x4b, 0x1d, 0x38, 0x0d, 0x05, 0xc1, 0x22, 0x20, 0xfa, 0x27, 0x22, 0x23, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5a, 0xfe, 0xdf, 0x01, 0xca, 0x05, 0xfd, 0x00, 0x0d, 0x00, 0x00, 0x17, 0x34, 0x36, 0x3b, 0x01, 0x11,
+  0x23, 0x22, 0x26, 0x3d, 0x01, 0x21, 0x11, 0x21, 0x5a, 0x1b, 0x16, 0xa9, 0xa9, 0x16, 0x1b, 0x01, 0x70, 0xfe, 0x90, 0xdb, 0x14, 0x1c, 0x06, 0x33,
+  0x1b, 0x14, 0x46, 0xf8, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x9e, 0x03, 0x13, 0x03, 0xdd, 0x05, 0x99, 0x00, 0x11, 0x00, 0x00, 0x01, 0x33,
+  0x01, 0x23, 0x22, 0x26, 0x27, 0x03, 0x2e, 0x01, 0x27, 0x06, 0x07, 0x03, 0x0e, 0x01, 0x2b, 0x01, 0x02, 0x04, 0x73, 0x01, 0x66, 0x81, 0x11, 0x18,
+  0x08, 0xc4, 0x0d, 0x13, 0x07, 0x0e, 0x17, 0xc2, 0x08, 0x17, 0x14, 0x88, 0x05, 0x99, 0xfd, 0x7a, 0x14, 0x0e, 0x01, 0x60, 0x17, 0x2b, 0x15, 0x2c,
+  0x2b, 0xfe, 0xa0, 0x0e, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xfe, 0xe3, 0x03, 0x14, 0xff, 0x5b, 0x00, 0x03, 0x00, 0x00, 0x05, 0x15,
+  0x21, 0x35, 0x03, 0x14, 0xfc, 0xec, 0xa5, 0x78, 0x78, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x26, 0x04, 0x8b, 0x01, 0xb3, 0x05, 0xa9, 0x00, 0x09,
+  0x00, 0x00, 0x13, 0x32, 0x16, 0x1f, 0x01, 0x23, 0x22, 0x26, 0x27, 0x03, 0xcf, 0x21, 0x20, 0x0e, 0x95, 0x66, 0x15, 0x1a, 0x0e, 0xea, 0x05, 0xa9,
+  0x15, 0x17, 0xf2, 0x0d, 0x0f, 0x01, 0x02, 0x00, 0x00, 0x02, 0x00, 0x5c, 0xff, 0xf0, 0x03, 0x7a, 0x04, 0x07, 0x00, 0x29, 0x00, 0x39, 0x00, 0x00,
+  0x21, 0x23, 0x22, 0x26, 0x2f, 0x01, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x35, 0x34, 0x26, 0x23, 0x22, 0x0e, 0x02,
+  0x23, 0x22, 0x26, 0x2f, 0x01, 0x3e, 0x01, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x01, 0x32, 0x3e, 0x02, 0x37, 0x35, 0x0e, 0x03, 0x15, 0x14, 0x1e, 0x02,
+  0x03, 0x7a, 0x4f, 0x1a, 0x20, 0x05, 0x14, 0x28, 0x4c, 0x54, 0x5f, 0x3a, 0x3b, 0x67, 0x4c, 0x2d, 0x42, 0x93, 0xee, 0xac, 0x65, 0x63, 0x41, 0x59,
+  0x41, 0x2f, 0x17, 0x12, 0x1b, 0x08, 0x20, 0x54, 0xc2, 0x76, 0x55, 0x84, 0x5a, 0x2e, 0xfe, 0x32, 0x2f, 0x4e, 0x45, 0x3f, 0x1e, 0x7b, 0xac, 0x6c,
+  0x31, 0x1a, 0x2c, 0x3c, 0x10, 0x1a, 0x5e, 0x24, 0x39, 0x27, 0x14, 0x21, 0x42, 0x65, 0x45, 0x3c, 0x6f, 0x56, 0x37, 0x04, 0x4f, 0x76, 0x79, 0x21,
+  0x29, 0x21, 0x13, 0x0e, 0x39, 0x51, 0x50, 0x38, 0x64, 0x8e, 0x55, 0xfd, 0xe5, 0x13, 0x23, 0x32, 0x20, 0xd3, 0x04, 0x1f, 0x32, 0x44, 0x2a, 0x28,
+  0x3a, 0x25, 0x11, 0x00, 0x00, 0x02, 0x00, 0x98, 0xff, 0xf2, 0x04, 0x16, 0x05, 0xc1, 0x00, 0x16, 0x00, 0x25, 0x00, 0x00, 0x33, 0x11, 0x33, 0x11,
+  0x3e, 0x01, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x07, 0x06, 0x23, 0x01, 0x22, 0x06, 0x07, 0x11, 0x1e, 0x01,
+  0x33, 0x32, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x98, 0xb3, 0x3f, 0xa3, 0x69, 0x58, 0x8e, 0x64, 0x36, 0x3c, 0x71, 0xa3, 0x66, 0x62, 0x89, 0x33, 0x09,
+  0x08, 0x26, 0x01, 0x51, 0x57, 0x83, 0x37, 0x30, 0x75, 0x48, 0x8e, 0x98, 0x23, 0x42, 0x60, 0x05, 0xc1, 0xfd, 0xa2, 0x49, 0x59, 0x42, 0x83, 0xc1,
+  0x7e, 0x70, 0xc1, 0x8d, 0x51, 0x4c, 0x44, 0x5c, 0x26, 0x03, 0x77, 0x50, 0x49, 0xfe, 0x16, 0x42, 0x36, 0xca, 0xbb, 0x63, 0x8e, 0x5b, 0x2a, 0x00,
+  0x00, 0x01, 0x00, 0x4a, 0xff, 0xf2, 0x03, 0x7f, 0x04, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x01, 0x0e, 0x01, 0x23, 0x22, 0x2e, 0x02, 0x23, 0x22, 0x0e,
+  0x02, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x33, 0x32, 0x1f, 0x01, 0x0e, 0x01, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33,
+  0x32, 0x16, 0x17, 0x03, 0x45, 0x08, 0x10, 0x0f, 0x0f, 0x23, 0x36, 0x4d, 0x38, 0x4a, 0x72, 0x4d, 0x27, 0x2a, 0x4c, 0x6d, 0x44, 0x41, 0x54, 0x38,
+  0x24, 0x12, 0x17, 0x0b, 0x32, 0x42, 0xc6, 0x6e, 0x5f, 0xa3, 0x78, 0x45, 0x3f, 0x79, 0xb2, 0x73, 0x6a, 0xa4, 0x3f, 0x03, 0x41, 0x0b, 0x0c, 0x19,
+  0x1e, 0x19, 0x35, 0x64, 0x8e, 0x58, 0x5c, 0x8f, 0x61, 0x33, 0x1f, 0x26, 0x1f, 0x11, 0x41, 0x51, 0x4b, 0x46, 0x85, 0xc2, 0x7c, 0x71, 0xc0, 0x8b,
+  0x4e, 0x45, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x48, 0xff, 0xf2, 0x03, 0xc5, 0x05, 0xc1, 0x00, 0x16, 0x00, 0x25, 0x00, 0x00, 0x21, 0x22, 0x2f, 0x01,
+  0x0e, 0x01, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x11, 0x33, 0x11, 0x25, 0x32, 0x36, 0x37, 0x11, 0x2e, 0x01,
+  0x23, 0x22, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x03, 0x5b, 0x26, 0x0a, 0x10, 0x41, 0xa7, 0x6c, 0x57, 0x8e, 0x64, 0x36, 0x3c, 0x71, 0xa2, 0x67, 0x5d,
+  0x84, 0x34, 0xb2, 0xfe, 0x3d, 0x57, 0x83, 0x37, 0x31, 0x75, 0x47, 0x8e, 0x98, 0x22, 0x42, 0x60, 0x25, 0x7b, 0x4f, 0x5f, 0x43, 0x82, 0xc2, 0x7e,
+  0x70, 0xc1, 0x8e, 0x51, 0x3f, 0x39, 0x02, 0x32, 0xfa, 0x3f, 0x82, 0x50, 0x49, 0x01, 0xea, 0x42, 0x35, 0xca, 0xbb, 0x63, 0x8d, 0x5b, 0x2a, 0x00,
+  0x00, 0x02, 0x00, 0x4a, 0xff, 0xf2, 0x03, 0xc7, 0x04, 0x05, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x23,
+  0x21, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x33, 0x32, 0x1f, 0x01, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x17, 0x22, 0x06,
+  0x07, 0x21, 0x34, 0x2e, 0x02, 0x02, 0x23, 0x5b, 0x9a, 0x70, 0x3f, 0x12, 0x19, 0xfd, 0x5e, 0x02, 0x30, 0x54, 0x74, 0x48, 0x43, 0x61, 0x46, 0x2f,
+  0x11, 0x16, 0x0c, 0x32, 0x21, 0x5c, 0x69, 0x70, 0x37, 0x69, 0xb1, 0x81, 0x48, 0x41, 0x7a, 0xb0, 0x72, 0x81, 0x94, 0x12, 0x02, 0x27, 0x22, 0x42,
+  0x5f, 0x04, 0x05, 0x3d, 0x73, 0xa9, 0x6c, 0x2a, 0x1c, 0x60, 0x8e, 0x5f, 0x2f, 0x1f, 0x24, 0x1f, 0x11, 0x41, 0x28, 0x3b, 0x26, 0x13, 0x47, 0x89,
+  0xca, 0x83, 0x6a, 0xb8, 0x87, 0x4d, 0x83, 0x95, 0x84, 0x3e, 0x67, 0x4b, 0x29, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x00, 0x02, 0x94,
+  0x05, 0xae, 0x00, 0x1e, 0x00, 0x00, 0x33, 0x11, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x33, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x17, 0x07, 0x0e, 0x01,
+  0x2b, 0x01, 0x22, 0x0e, 0x02, 0x1d, 0x01, 0x21, 0x15, 0x21, 0x11, 0xba, 0x70, 0x15, 0x1b, 0xa0, 0x31, 0x5b, 0x80, 0x50, 0x44, 0x3a, 0x04, 0x01,
+  0x20, 0x1d, 0x1f, 0x2e, 0x4b, 0x36, 0x1d, 0x01, 0x25, 0xfe, 0xe1, 0x03, 0x5d, 0x0d, 0x05, 0x15, 0x14, 0x49, 0x62, 0x57, 0x87, 0x5d, 0x30, 0x14,
+  0x59, 0x14, 0x08, 0x18, 0x36, 0x58, 0x41, 0x5d, 0x81, 0xfc, 0xa0, 0x00, 0x00, 0x03, 0x00, 0x32, 0xfe, 0x93, 0x03, 0xde, 0x04, 0x06, 0x00, 0x39,
+  0x00, 0x4d, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x32, 0x16, 0x17, 0x21, 0x15, 0x14, 0x0f, 0x01, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x27, 0x0e,
+  0x01, 0x15, 0x14, 0x1e, 0x06, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x37, 0x2e, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x37,
+  0x2e, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x01, 0x34, 0x2e, 0x04, 0x27, 0x0e, 0x01, 0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x01, 0x32, 0x3e,
+  0x02, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x01, 0xe7, 0x42, 0x73, 0x2f, 0x01, 0x13, 0x2a, 0x73, 0x22, 0x39, 0x65, 0x8b,
+  0x53, 0x47, 0x3f, 0x20, 0x21, 0x3a, 0x60, 0x7a, 0x7f, 0x7a, 0x60, 0x3a, 0x41, 0x7a, 0xb0, 0x6f, 0x6f, 0xa7, 0x6e, 0x37, 0x5f, 0x53, 0x2b, 0x33,
+  0x10, 0x21, 0x30, 0x20, 0x4b, 0x55, 0x39, 0x66, 0x8d, 0x01, 0x90, 0x2a, 0x48, 0x5e, 0x68, 0x6c, 0x31, 0x39, 0x47, 0x23, 0x48, 0x6d, 0x4a, 0x48,
+  0x72, 0x4f, 0x2a, 0xfe, 0xc4, 0x36, 0x53, 0x38, 0x1c, 0x71, 0x6c, 0x6b, 0x71, 0x1d, 0x38, 0x52, 0x04, 0x06, 0x1d, 0x1c, 0x42, 0x21, 0x09, 0x10,
+  0x41, 0x50, 0x4a, 0x79, 0x56, 0x2e, 0x11, 0x14, 0x2e, 0x16, 0x24, 0x25, 0x10, 0x04, 0x09, 0x16, 0x32, 0x58, 0x46, 0x41, 0x7a, 0x5f, 0x39, 0x2c,
+  0x4a, 0x61, 0x35, 0x4b, 0x69, 0x1f, 0x14, 0x43, 0x38, 0x16, 0x2f, 0x2e, 0x2a, 0x10, 0x2a, 0x8b, 0x5d, 0x4a, 0x79, 0x55, 0x2e, 0xfb, 0xc3, 0x26,
+  0x2e, 0x19, 0x0c, 0x05, 0x06, 0x08, 0x1b, 0x4e, 0x36, 0x22, 0x3b, 0x2b, 0x19, 0x1a, 0x30, 0x42, 0x02, 0x4e, 0x1e, 0x36, 0x4b, 0x2d, 0x5d, 0x6e,
+  0x6e, 0x5d, 0x2d, 0x4b, 0x36, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x92, 0x00, 0x00, 0x03, 0xdd, 0x05, 0xc1, 0x00, 0x15,
+  0x00, 0x00, 0x33, 0x11, 0x33, 0x11, 0x3e, 0x01, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x11, 0x92,
+  0xb2, 0x41, 0x9e, 0x67, 0x53, 0x7f, 0x55, 0x2c, 0xb2, 0x69, 0x6c, 0x4f, 0x89, 0x3a, 0x05, 0xc1, 0xfd, 0xac, 0x45, 0x53, 0x37, 0x65, 0x8e, 0x56,
+  0xfd, 0x7b, 0x02, 0x85, 0x73, 0x7f, 0x4c, 0x41, 0xfd, 0x16, 0x00, 0x00, 0x00, 0x02, 0x00, 0x82, 0x00, 0x00, 0x01, 0x80, 0x05, 0xb3, 0x00, 0x03,
+  0x00, 0x17, 0x00, 0x00, 0x01, 0x11, 0x23, 0x11, 0x13, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02,
+  0x01, 0x58, 0xb2, 0xda, 0x15, 0x23, 0x2e, 0x1a, 0x1a, 0x2d, 0x23, 0x14, 0x14, 0x23, 0x2d, 0x1a, 0x1a, 0x2e, 0x23, 0x15, 0x03, 0xf5, 0xfc, 0x0b,
+  0x03, 0xf5, 0x01, 0x3e, 0x1a, 0x2d, 0x23, 0x14, 0x14, 0x23, 0x2d, 0x1a, 0x1a, 0x2f, 0x23, 0x14, 0x14, 0x23, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0xff, 0xc8, 0xfe, 0x94, 0x01, 0x80, 0x05, 0xb3, 0x00, 0x14, 0x00, 0x28, 0x00, 0x00, 0x01, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26,
+  0x27, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11, 0x13, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02,
+  0x33, 0x32, 0x1e, 0x02, 0x01, 0x58, 0x20, 0x45, 0x6d, 0x4c, 0x21, 0x36, 0x1b, 0x08, 0x02, 0x0e, 0x0f, 0x08, 0x12, 0x0d, 0x4e, 0x42, 0xda, 0x15,
+  0x23, 0x2e, 0x1a, 0x1a, 0x2d, 0x23, 0x14, 0x14, 0x23, 0x2d, 0x1a, 0x1a, 0x2e, 0x23, 0x15, 0x03, 0xf5, 0xfb, 0xc0, 0x3d, 0x69, 0x4e, 0x2d, 0x0a,
+  0x0a, 0x60, 0x0d, 0x07, 0x01, 0x49, 0x51, 0x04, 0x40, 0x01, 0x3e, 0x1a, 0x2d, 0x23, 0x14, 0x14, 0x23, 0x2d, 0x1a, 0x1a, 0x2f, 0x23, 0x14, 0x14,
+  0x23, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x98, 0x00, 0x00, 0x03, 0xf8, 0x05, 0xc1, 0x00, 0x1e, 0x00, 0x00, 0x01, 0x11, 0x33, 0x32, 0x36, 0x37,
+  0x01, 0x3e, 0x01, 0x3b, 0x01, 0x01, 0x0e, 0x01, 0x07, 0x1e, 0x01, 0x17, 0x01, 0x23, 0x22, 0x26, 0x27, 0x01, 0x2e, 0x01, 0x2b, 0x01, 0x11, 0x23,
+  0x11, 0x01, 0x4b, 0x2e, 0x14, 0x1a, 0x10, 0x01, 0x40, 0x0f, 0x1e, 0x19, 0xa2, 0xfe, 0x8b, 0x0e, 0x1b, 0x11, 0x12, 0x1d, 0x0d, 0x01, 0x8c, 0xa0,
+  0x16, 0x1f, 0x0e, 0xfe, 0xb3, 0x0f, 0x1e, 0x1e, 0x32, 0xb3, 0x05, 0xc1, 0xfc, 0x9d, 0x0b, 0x11, 0x01, 0x57, 0x10, 0x14, 0xfe, 0x73, 0x11, 0x1a,
+  0x0a, 0x0c, 0x1f, 0x14, 0xfe, 0x0c, 0x11, 0x12, 0x01, 0x9f, 0x15, 0x0d, 0xfe, 0x1c, 0x05, 0xc1, 0x00, 0x01, 0x00, 0xa6, 0x00, 0x00, 0x01, 0x58,
+  0x05, 0xc1, 0x00, 0x03, 0x00, 0x00, 0x01, 0x11, 0x23, 0x11, 0x01, 0x58, 0xb2, 0x05, 0xc1, 0xfa, 0x3f, 0x05, 0xc1, 0x00, 0x00, 0x01, 0x00, 0x92,
+  0x00, 0x00, 0x05, 0xef, 0x04, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x33, 0x11, 0x33, 0x32, 0x1f, 0x01, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x3e, 0x03,
+  0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07,
+  0x11, 0x92, 0x6a, 0x26, 0x0a, 0x0d, 0x38, 0x8b, 0x5c, 0x67, 0x7f, 0x1c, 0x15, 0x45, 0x56, 0x61, 0x32, 0x50, 0x7d, 0x57, 0x2e, 0xb2, 0x68, 0x63,
+  0x2c, 0x4f, 0x3c, 0x23, 0xb2, 0x62, 0x5e, 0x42, 0x71, 0x2f, 0x03, 0xf5, 0x25, 0x68, 0x45, 0x58, 0x72, 0x61, 0x37, 0x50, 0x34, 0x18, 0x33, 0x62,
+  0x8f, 0x5c, 0xfd, 0x7b, 0x02, 0x85, 0x77, 0x7b, 0x1f, 0x3c, 0x5b, 0x3c, 0xfd, 0x7b, 0x02, 0x85, 0x7a, 0x78, 0x47, 0x3d, 0xfd, 0x0d, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x92, 0x00, 0x00, 0x03, 0xdd, 0x04, 0x05, 0x00, 0x17, 0x00, 0x00, 0x33, 0x11, 0x33, 0x32, 0x1f, 0x01, 0x3e, 0x01, 0x33, 0x32,
+  0x1e, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x11, 0x92, 0x6a, 0x26, 0x0a, 0x0e, 0x42, 0xa3, 0x6b, 0x53, 0x7f, 0x55,
+  0x2c, 0xb2, 0x69, 0x6c, 0x4f, 0x89, 0x3a, 0x03, 0xf5, 0x25, 0x6e, 0x49, 0x5a, 0x37, 0x65, 0x8e, 0x56, 0xfd, 0x7b, 0x02, 0x85, 0x73, 0x7f, 0x4c,
+  0x41, 0xfd, 0x16, 0x00, 0x00, 0x02, 0x00, 0x48, 0xff, 0xf2, 0x04, 0x0e, 0x04, 0x05, 0x00, 0x13, 0x00, 0x23, 0x00, 0x00, 0x01, 0x32, 0x1e, 0x02,
+  0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x13, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14,
+  0x1e, 0x02, 0x02, 0x2c, 0x6f, 0xb3, 0x7d, 0x43, 0x43, 0x7d, 0xb3, 0x6f, 0x6f, 0xb3, 0x7e, 0x44, 0x44, 0x7e, 0xb3, 0x6f, 0x96, 0x94, 0x94, 0x96,
+  0x4c, 0x70, 0x4b, 0x25, 0x25, 0x4b, 0x70, 0x04, 0x05, 0x4a, 0x88, 0xc1, 0x77, 0x78, 0xc0, 0x88, 0x49, 0x49, 0x88, 0xc0, 0x78, 0x77, 0xc1, 0x88,
+  0x4a, 0xfc, 0x78, 0xc9, 0xb4, 0xb5, 0xca, 0x34, 0x62, 0x8f, 0x5a, 0x5a, 0x8e, 0x61, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x92,
+  0xfe, 0xa9, 0x04, 0x0f, 0x04, 0x07, 0x00, 0x16, 0x00, 0x25, 0x00, 0x00, 0x13, 0x11, 0x33, 0x32, 0x1f, 0x01, 0x3e, 0x01, 0x33, 0x32, 0x1e, 0x02,
+  0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x11, 0x01, 0x22, 0x06, 0x07, 0x11, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x92,
+  0x6a, 0x26, 0x0a, 0x0f, 0x41, 0xa7, 0x6d, 0x57, 0x8e, 0x64, 0x36, 0x3c, 0x70, 0xa3, 0x66, 0x5e, 0x85, 0x33, 0x01, 0x11, 0x57, 0x83, 0x37, 0x31,
+  0x75, 0x48, 0x8d, 0x98, 0x23, 0x42, 0x60, 0xfe, 0xa9, 0x05, 0x4c, 0x25, 0x78, 0x4f, 0x60, 0x43, 0x83, 0xc2, 0x7e, 0x70, 0xc1, 0x8d, 0x51, 0x3e,
+  0x39, 0xfe, 0x40, 0x04, 0xce, 0x50, 0x49, 0xfe, 0x16, 0x42, 0x36, 0xca, 0xbb, 0x63, 0x8e, 0x5b, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x48,
+  0xfe, 0xa9, 0x03, 0xc5, 0x04, 0x07, 0x00, 0x16, 0x00, 0x25, 0x00, 0x00, 0x01, 0x11, 0x23, 0x11, 0x0e, 0x01, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34,
+  0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x37, 0x36, 0x33, 0x01, 0x32, 0x36, 0x37, 0x11, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x15, 0x14, 0x1e, 0x02, 0x03,
+  0xc5, 0xb2, 0x40, 0xa3, 0x69, 0x57, 0x8e, 0x64, 0x36, 0x3c, 0x71, 0xa2, 0x67, 0x62, 0x89, 0x36, 0x0c, 0x0a, 0x26, 0xfe, 0xa7, 0x57, 0x83, 0x37,
+  0x30, 0x76, 0x47, 0x8e, 0x98, 0x22, 0x42, 0x60, 0x03, 0xf5, 0xfa, 0xb4, 0x01, 0xed, 0x4a, 0x5a, 0x43, 0x82, 0xc2, 0x7e, 0x70, 0xc1, 0x8e, 0x51,
+  0x46, 0x40, 0x4f, 0x25, 0xfc, 0x8d, 0x50, 0x49, 0x01, 0xea, 0x40, 0x37, 0xca, 0xbb, 0x63, 0x8d, 0x5b, 0x2a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x92,
+  0x00, 0x00, 0x02, 0xfa, 0x04, 0x07, 0x00, 0x16, 0x00, 0x00, 0x33, 0x11, 0x33, 0x32, 0x16, 0x1f, 0x01, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x07,
+  0x06, 0x23, 0x22, 0x26, 0x23, 0x22, 0x06, 0x07, 0x11, 0x92, 0x66, 0x1d, 0x16, 0x04, 0x0c, 0x34, 0x99, 0x67, 0x2a, 0x44, 0x1d, 0x17, 0x07, 0x18,
+  0x0e, 0x3a, 0x34, 0x5d, 0x7d, 0x2a, 0x03, 0xf5, 0x16, 0x1b, 0x9e, 0x6a, 0x77, 0x13, 0x11, 0x85, 0x19, 0x13, 0x6c, 0x67, 0xfd, 0x7b, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x3e, 0xff, 0xf0, 0x03, 0x0f, 0x04, 0x05, 0x00, 0x3c, 0x00, 0x00, 0x01, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02,
+  0x15, 0x14, 0x1e, 0x06, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35,
+  0x34, 0x2e, 0x06, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x02, 0xd6, 0x0c, 0x19, 0x0f, 0x26, 0x37, 0x4c, 0x34, 0x2d, 0x48, 0x33, 0x1b,
+  0x2d, 0x4a, 0x5e, 0x63, 0x5e, 0x4a, 0x2d, 0x32, 0x62, 0x8e, 0x5d, 0x6a, 0xac, 0x3c, 0x2a, 0x08, 0x16, 0x12, 0x12, 0x28, 0x39, 0x51, 0x3d, 0x34,
+  0x4e, 0x34, 0x19, 0x2d, 0x4a, 0x5f, 0x63, 0x5f, 0x4a, 0x2d, 0x30, 0x5c, 0x86, 0x56, 0x64, 0x9f, 0x3a, 0x03, 0x4e, 0x16, 0x16, 0x1b, 0x17, 0x17,
+  0x28, 0x35, 0x1f, 0x27, 0x34, 0x26, 0x1d, 0x21, 0x28, 0x3c, 0x57, 0x3d, 0x46, 0x77, 0x57, 0x32, 0x45, 0x36, 0x44, 0x0d, 0x0e, 0x1c, 0x22, 0x1c,
+  0x1b, 0x2e, 0x3c, 0x22, 0x2a, 0x37, 0x27, 0x1d, 0x20, 0x29, 0x3e, 0x5b, 0x41, 0x3a, 0x6b, 0x51, 0x30, 0x3f, 0x37, 0x00, 0x00, 0x01, 0x00, 0x2c,
+  0xff, 0xf0, 0x02, 0xba, 0x05, 0x3e, 0x00, 0x21, 0x00, 0x00, 0x05, 0x22, 0x26, 0x35, 0x11, 0x23, 0x22, 0x26, 0x3d, 0x01, 0x37, 0x13, 0x3e, 0x01,
+  0x3b, 0x01, 0x11, 0x21, 0x15, 0x21, 0x11, 0x14, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x33, 0x32, 0x1f, 0x01, 0x0e, 0x01, 0x01, 0xc5, 0x78, 0x81, 0x7a,
+  0x10, 0x16, 0xa6, 0x29, 0x02, 0x16, 0x11, 0x5a, 0x01, 0x22, 0xfe, 0xde, 0x3e, 0x31, 0x1c, 0x29, 0x1e, 0x15, 0x08, 0x0e, 0x0b, 0x34, 0x2e, 0x82,
+  0x10, 0x86, 0x7e, 0x02, 0x6c, 0x13, 0x14, 0x47, 0x15, 0x01, 0x39, 0x0f, 0x13, 0xfe, 0xa3, 0x81, 0xfd, 0xa0, 0x40, 0x3e, 0x0f, 0x12, 0x0f, 0x11,
+  0x55, 0x2b, 0x31, 0x00, 0x00, 0x01, 0x00, 0x7a, 0xff, 0xf0, 0x03, 0xc5, 0x03, 0xf5, 0x00, 0x17, 0x00, 0x00, 0x01, 0x11, 0x14, 0x16, 0x33, 0x32,
+  0x36, 0x37, 0x11, 0x33, 0x11, 0x23, 0x22, 0x2f, 0x01, 0x0e, 0x01, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x01, 0x2c, 0x6a, 0x6b, 0x4e, 0x8a, 0x3a,
+  0xb2, 0x6a, 0x26, 0x0a, 0x0e, 0x42, 0xa4, 0x6a, 0x53, 0x7f, 0x56, 0x2b, 0x03, 0xf5, 0xfd, 0x7a, 0x73, 0x7e, 0x4a, 0x42, 0x02, 0xeb, 0xfc, 0x0b,
+  0x25, 0x6d, 0x49, 0x59, 0x37, 0x64, 0x8e, 0x56, 0x02, 0x86, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x03, 0xed, 0x03, 0xf5, 0x00, 0x12,
+  0x00, 0x00, 0x13, 0x33, 0x32, 0x16, 0x17, 0x01, 0x1e, 0x01, 0x17, 0x3e, 0x01, 0x37, 0x01, 0x3e, 0x01, 0x3b, 0x01, 0x01, 0x23, 0x12, 0x92, 0x15,
+  0x1c, 0x06, 0x01, 0x01, 0x0e, 0x10, 0x07, 0x08, 0x12, 0x0e, 0x01, 0x04, 0x06, 0x1b, 0x14, 0x8b, 0xfe, 0x63, 0xa1, 0x03, 0xf5, 0x16, 0x0f, 0xfd,
+  0x74, 0x24, 0x48, 0x23, 0x23, 0x48, 0x24, 0x02, 0x8c, 0x10, 0x15, 0xfc, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x05, 0xef,
+  0x03, 0xf7, 0x00, 0x2e, 0x00, 0x00, 0x13, 0x33, 0x32, 0x16, 0x17, 0x13, 0x1e, 0x01, 0x17, 0x3e, 0x01, 0x37, 0x13, 0x3e, 0x01, 0x3b, 0x01, 0x32,
+  0x16, 0x17, 0x13, 0x1e, 0x01, 0x17, 0x3e, 0x01, 0x37, 0x13, 0x3e, 0x01, 0x3b, 0x01, 0x01, 0x23, 0x22, 0x27, 0x03, 0x2e, 0x01, 0x27, 0x0e, 0x01,
+  0x07, 0x03, 0x06, 0x2b, 0x01, 0x0e, 0x8c, 0x16, 0x1c, 0x05, 0xc2, 0x08, 0x0e, 0x05, 0x08, 0x14, 0x0b, 0xd6, 0x05, 0x19, 0x13, 0x4d, 0x14, 0x1a,
+  0x05, 0xd1, 0x0b, 0x11, 0x08, 0x05, 0x10, 0x09, 0xc6, 0x05, 0x1c, 0x13, 0x86, 0xfe, 0xb8, 0x8d, 0x1a, 0x0a, 0xe0, 0x08, 0x0a, 0x05, 0x05, 0x0a,
+  0x08, 0xe3, 0x0b, 0x1e, 0x86, 0x03, 0xf5, 0x16, 0x0f, 0xfd, 0x74, 0x24, 0x43, 0x22, 0x22, 0x43, 0x24, 0x02, 0x90, 0x0f, 0x14, 0x14, 0x0f, 0xfd,
+  0x70, 0x23, 0x44, 0x21, 0x21, 0x48, 0x1f, 0x02, 0x8c, 0x10, 0x15, 0xfc, 0x0b, 0x22, 0x02, 0xaf, 0x17, 0x2f, 0x17, 0x17, 0x30, 0x17, 0xfd, 0x52,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x03, 0xd2, 0x03, 0xf5, 0x00, 0x1b, 0x00, 0x00, 0x09, 0x01, 0x33, 0x32, 0x16, 0x17,
+  0x13, 0x36, 0x37, 0x13, 0x3e, 0x01, 0x3b, 0x01, 0x09, 0x01, 0x23, 0x22, 0x26, 0x27, 0x03, 0x06, 0x07, 0x03, 0x0e, 0x01, 0x2b, 0x01, 0x01, 0x7f,
+  0xfe, 0xab, 0xab, 0x16, 0x14, 0x08, 0xf8, 0x09, 0x11, 0xda, 0x0a, 0x14, 0x0f, 0xa4, 0xfe, 0xab, 0x01, 0x63, 0xab, 0x16, 0x19, 0x08, 0xff, 0x07,
+  0x0e, 0xec, 0x0a, 0x17, 0x14, 0x9f, 0x02, 0x07, 0x01, 0xee, 0x0e, 0x0d, 0xfe, 0x84, 0x1c, 0x1c, 0x01, 0x40, 0x0e, 0x11, 0xfe, 0x1c, 0xfd, 0xef,
+  0x17, 0x0e, 0x01, 0x8d, 0x1d, 0x17, 0xfe, 0xa7, 0x0e, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0e, 0xfe, 0xa9, 0x03, 0xf0,
+  0x03, 0xf5, 0x00, 0x16, 0x00, 0x00, 0x01, 0x0e, 0x01, 0x2b, 0x01, 0x13, 0x01, 0x33, 0x32, 0x16, 0x17, 0x01, 0x1e, 0x01, 0x17, 0x3e, 0x01, 0x37,
+  0x01, 0x3e, 0x01, 0x3b, 0x01, 0x01, 0xbb, 0x09, 0x1b, 0x1c, 0x84, 0xb9, 0xfe, 0x5e, 0x9a, 0x17, 0x1a, 0x06, 0x01, 0x0f, 0x09, 0x0d, 0x05, 0x07,
+  0x0e, 0x09, 0x01, 0x07, 0x06, 0x1d, 0x11, 0x8e, 0xfe, 0xd5, 0x14, 0x18, 0x01, 0x92, 0x03, 0xba, 0x17, 0x0e, 0xfd, 0x82, 0x16, 0x2c, 0x17, 0x17,
+  0x2c, 0x17, 0x02, 0x7d, 0x10, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x03, 0x55, 0x03, 0xf5, 0x00, 0x0f,
+  0x00, 0x00, 0x01, 0x14, 0x06, 0x07, 0x01, 0x21, 0x15, 0x21, 0x35, 0x34, 0x36, 0x37, 0x01, 0x21, 0x35, 0x21, 0x03, 0x55, 0x0e, 0x0b, 0xfd, 0xdc,
+  0x02, 0x29, 0xfd, 0x05, 0x0d, 0x0c, 0x02, 0x27, 0xfd, 0xdf, 0x02, 0xf0, 0x03, 0xa9, 0x13, 0x23, 0x0e, 0xfd, 0x26, 0x8b, 0x4a, 0x0d, 0x23, 0x10,
+  0x02, 0xdf, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2c, 0xfe, 0xdf, 0x02, 0x00, 0x05, 0xfd, 0x00, 0x40, 0x00, 0x00, 0x13, 0x34,
+  0x26, 0x23, 0x35, 0x32, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x3b, 0x01, 0x15, 0x14, 0x06, 0x2b, 0x01, 0x22, 0x06, 0x15, 0x14,
+  0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x3b, 0x01, 0x32, 0x16, 0x1d, 0x01, 0x23, 0x22,
+  0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0xb5, 0x46, 0x43, 0x43, 0x46, 0x10, 0x13, 0x10, 0x29, 0x53, 0x7b, 0x52, 0x35, 0x1c, 0x0c, 0x14, 0x4d, 0x59,
+  0x0e, 0x12, 0x0e, 0x16, 0x29, 0x37, 0x21, 0x21, 0x37, 0x29, 0x16, 0x0e, 0x12, 0x0e, 0x59, 0x4d, 0x14, 0x0c, 0x1c, 0x35, 0x52, 0x7b, 0x53, 0x29,
+  0x10, 0x13, 0x10, 0x01, 0xa9, 0x3f, 0x51, 0x6b, 0x50, 0x40, 0x32, 0x62, 0x62, 0x64, 0x34, 0x45, 0x74, 0x54, 0x2e, 0x4f, 0x14, 0x12, 0x65, 0x56,
+  0x38, 0x68, 0x63, 0x62, 0x32, 0x26, 0x41, 0x33, 0x25, 0x09, 0x09, 0x25, 0x34, 0x40, 0x25, 0x32, 0x62, 0x63, 0x68, 0x38, 0x57, 0x64, 0x12, 0x14,
+  0x50, 0x2f, 0x54, 0x74, 0x45, 0x34, 0x63, 0x63, 0x62, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xe6, 0xfe, 0xa9, 0x01, 0x70, 0x05, 0xfd, 0x00, 0x03,
+  0x00, 0x00, 0x13, 0x33, 0x11, 0x23, 0xe6, 0x8a, 0x8a, 0x05, 0xfd, 0xf8, 0xac, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x58, 0xfe, 0xdf, 0x02, 0x2c,
+  0x05, 0xfd, 0x00, 0x40, 0x00, 0x00, 0x01, 0x14, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x2b, 0x01, 0x35, 0x34, 0x36, 0x3b, 0x01, 0x32, 0x36, 0x35,
+  0x34, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x2b, 0x01, 0x22, 0x26, 0x3d, 0x01, 0x33,
+  0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x15, 0x14, 0x16, 0x33, 0x15, 0x22, 0x06, 0x01, 0xa3, 0x10, 0x13, 0x10, 0x2a, 0x52, 0x7b, 0x52, 0x35,
+  0x1c, 0x0c, 0x14, 0x4d, 0x59, 0x0e, 0x12, 0x0e, 0x16, 0x29, 0x37, 0x21, 0x21, 0x37, 0x29, 0x16, 0x0e, 0x12, 0x0e, 0x59, 0x4d, 0x14, 0x0c, 0x1c,
+  0x35, 0x52, 0x7b, 0x52, 0x2a, 0x10, 0x13, 0x10, 0x46, 0x43, 0x43, 0x46, 0x01, 0xa9, 0x32, 0x62, 0x63, 0x63, 0x34, 0x45, 0x74, 0x54, 0x2f, 0x50,
+  0x14, 0x12, 0x64, 0x57, 0x38, 0x68, 0x63, 0x62, 0x32, 0x25, 0x40, 0x34, 0x25, 0x09, 0x09, 0x25, 0x33, 0x41, 0x26, 0x32, 0x62, 0x63, 0x68, 0x38,
+  0x56, 0x65, 0x12, 0x14, 0x4f, 0x2e, 0x54, 0x74, 0x45, 0x34, 0x64, 0x62, 0x62, 0x32, 0x40, 0x50, 0x6b, 0x51, 0x00, 0x00, 0x00, 0x01, 0x00, 0x74,
+  0x01, 0x9e, 0x04, 0x12, 0x03, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x32, 0x36, 0x37, 0x33, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x23, 0x22,
+  0x06, 0x07, 0x23, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x02, 0xf7, 0x41, 0x49, 0x01, 0x90, 0x25, 0x45, 0x66, 0x40, 0x34, 0x66, 0x5f, 0x56,
+  0x24, 0x41, 0x49, 0x01, 0x90, 0x25, 0x45, 0x65, 0x41, 0x34, 0x66, 0x5f, 0x56, 0x02, 0x65, 0x55, 0x46, 0x43, 0x70, 0x50, 0x2c, 0x20, 0x27, 0x21,
+  0x54, 0x47, 0x43, 0x70, 0x50, 0x2d, 0x21, 0x27, 0x21, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xda, 0xfe, 0xa9, 0x01, 0xd4, 0x04, 0x05, 0x00, 0x0d,
+  0x00, 0x21, 0x00, 0x00, 0x01, 0x11, 0x34, 0x3e, 0x02, 0x37, 0x33, 0x1e, 0x03, 0x15, 0x11, 0x03, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15,
+  0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x01, 0x06, 0x03, 0x06, 0x09, 0x06, 0x79, 0x06, 0x09, 0x06, 0x03, 0xd5, 0x13, 0x22, 0x2d, 0x1b, 0x1a,
+  0x2d, 0x22, 0x14, 0x14, 0x22, 0x2d, 0x1a, 0x1b, 0x2d, 0x22, 0x13, 0xfe, 0xa9, 0x02, 0x1d, 0x2d, 0x55, 0x57, 0x5c, 0x34, 0x34, 0x5c, 0x57, 0x55,
+  0x2d, 0xfd, 0xe3, 0x04, 0xdf, 0x1b, 0x2d, 0x22, 0x13, 0x13, 0x22, 0x2d, 0x1b, 0x1a, 0x2e, 0x22, 0x14, 0x14, 0x22, 0x2e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x8a, 0xff, 0x15, 0x04, 0x02, 0x04, 0xe6, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x00, 0x05, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x3f,
+  0x01, 0x3e, 0x01, 0x3b, 0x01, 0x07, 0x1e, 0x01, 0x17, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x03, 0x3e, 0x03, 0x33, 0x32, 0x16, 0x1f,
+  0x01, 0x0e, 0x01, 0x0f, 0x01, 0x0e, 0x01, 0x2b, 0x01, 0x03, 0x14, 0x16, 0x17, 0x13, 0x0e, 0x03, 0x02, 0x31, 0x5c, 0x9b, 0x71, 0x3f, 0x42, 0x7e,
+  0xb8, 0x77, 0x0c, 0x02, 0x1b, 0x15, 0x42, 0x10, 0x52, 0x84, 0x36, 0x2e, 0x08, 0x0f, 0x0e, 0x0c, 0x21, 0x2d, 0x3f, 0x2a, 0x34, 0x3f, 0x55, 0x3b,
+  0x26, 0x10, 0x0b, 0x12, 0x05, 0x30, 0x3c, 0xb9, 0x6b, 0x0c, 0x02, 0x1b, 0x15, 0x42, 0xe7, 0x87, 0x79, 0x34, 0x4c, 0x73, 0x4e, 0x27, 0x0b, 0x0a,
+  0x4f, 0x84, 0xb6, 0x72, 0x6f, 0xbb, 0x8a, 0x51, 0x03, 0xb3, 0x14, 0x1d, 0xe9, 0x0c, 0x3f, 0x31, 0x3e, 0x0b, 0x0b, 0x11, 0x18, 0x18, 0x07, 0xfd,
+  0x06, 0x04, 0x1f, 0x22, 0x1c, 0x09, 0x07, 0x3f, 0x48, 0x4a, 0x07, 0xaf, 0x13, 0x1d, 0x02, 0xe5, 0xa2, 0xc0, 0x17, 0x02, 0xf8, 0x06, 0x39, 0x63,
+  0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x34, 0x00, 0x00, 0x04, 0x5b, 0x05, 0xa8, 0x00, 0x3e, 0x00, 0x00, 0x13, 0x34, 0x36, 0x3b, 0x01, 0x11,
+  0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x11, 0x21,
+  0x15, 0x14, 0x06, 0x23, 0x21, 0x15, 0x14, 0x06, 0x07, 0x3e, 0x01, 0x33, 0x21, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x21, 0x35, 0x3e, 0x03, 0x35, 0x11,
+  0x23, 0x34, 0x20, 0x1d, 0x86, 0x36, 0x6e, 0xa4, 0x6e, 0x4e, 0x79, 0x5e, 0x45, 0x18, 0x48, 0x0a, 0x15, 0x0a, 0x0e, 0x19, 0x0b, 0x14, 0x29, 0x33,
+  0x42, 0x2d, 0x3f, 0x60, 0x40, 0x20, 0x01, 0xb9, 0x1e, 0x16, 0xfe, 0x7b, 0x39, 0x32, 0x1d, 0x39, 0x1e, 0x02, 0xa4, 0x0b, 0x14, 0x1c, 0x12, 0xfc,
+  0x3c, 0x22, 0x3e, 0x30, 0x1d, 0xc3, 0x02, 0xa0, 0x1a, 0x24, 0x01, 0x05, 0x5e, 0xa5, 0x7b, 0x47, 0x27, 0x44, 0x5a, 0x34, 0x2e, 0x06, 0x05, 0x0b,
+  0x0e, 0x19, 0x2f, 0x23, 0x15, 0x2a, 0x4e, 0x6e, 0x44, 0xfe, 0xf9, 0x48, 0x12, 0x1e, 0xf3, 0x4b, 0x6d, 0x2d, 0x05, 0x07, 0x4c, 0x0e, 0x1b, 0x17,
+  0x0e, 0x73, 0x0a, 0x22, 0x33, 0x45, 0x2e, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x84, 0x00, 0xe0, 0x04, 0x04, 0x04, 0x60, 0x00, 0x23,
+  0x00, 0x37, 0x00, 0x00, 0x13, 0x34, 0x36, 0x37, 0x27, 0x37, 0x17, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x37, 0x17, 0x07, 0x1e, 0x01, 0x15, 0x14,
+  0x06, 0x07, 0x17, 0x07, 0x27, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x07, 0x27, 0x37, 0x2e, 0x01, 0x37, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02,
+  0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0xdf, 0x21, 0x1d, 0x99, 0x5b, 0x97, 0x2c, 0x68, 0x3a, 0x39, 0x66, 0x2b, 0x99, 0x59, 0x97, 0x1f,
+  0x22, 0x21, 0x1d, 0x98, 0x5b, 0x98, 0x2c, 0x68, 0x39, 0x39, 0x65, 0x2c, 0x99, 0x59, 0x97, 0x1e, 0x22, 0x84, 0x23, 0x3e, 0x51, 0x2f, 0x2f, 0x53,
+  0x3d, 0x24, 0x24, 0x3d, 0x53, 0x2f, 0x2f, 0x51, 0x3e, 0x23, 0x02, 0xa0, 0x39, 0x65, 0x2c, 0x99, 0x5a, 0x98, 0x1f, 0x22, 0x21, 0x1e, 0x99, 0x5b,
+  0x98, 0x2c, 0x67, 0x3a, 0x39, 0x66, 0x2b, 0x97, 0x5c, 0x98, 0x1e, 0x22, 0x21, 0x1d, 0x99, 0x5b, 0x98, 0x2c, 0x67, 0x3a, 0x2e, 0x51, 0x3d, 0x24,
+  0x24, 0x3d, 0x51, 0x2e, 0x2f, 0x52, 0x3e, 0x23, 0x23, 0x3e, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2c, 0x00, 0x00, 0x04, 0x53,
+  0x05, 0x99, 0x00, 0x22, 0x00, 0x00, 0x13, 0x21, 0x01, 0x33, 0x32, 0x16, 0x17, 0x01, 0x1e, 0x01, 0x17, 0x3e, 0x01, 0x37, 0x01, 0x3e, 0x01, 0x3b,
+  0x01, 0x01, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x23, 0x11, 0x21, 0x35, 0x21, 0x35, 0x21, 0x92, 0x01, 0x32, 0xfe, 0x68, 0x95, 0x1a,
+  0x1f, 0x0a, 0x01, 0x14, 0x0e, 0x14, 0x07, 0x07, 0x12, 0x0e, 0x01, 0x13, 0x08, 0x21, 0x19, 0x96, 0xfe, 0x67, 0x01, 0x33, 0xfe, 0xac, 0x01, 0x54,
+  0xfe, 0xac, 0xb3, 0xfe, 0xac, 0x01, 0x54, 0xfe, 0xac, 0x02, 0x71, 0x03, 0x28, 0x19, 0x14, 0xfd, 0xca, 0x23, 0x3a, 0x1d, 0x1d, 0x3b, 0x22, 0x02,
+  0x36, 0x11, 0x1c, 0xfc, 0xd8, 0x66, 0x69, 0x67, 0xfe, 0xc5, 0x01, 0x3b, 0x67, 0x69, 0x00, 0x00, 0x00, 0x02, 0x00, 0xe6, 0xfe, 0xa9, 0x01, 0x70,
+  0x05, 0xfd, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x13, 0x33, 0x11, 0x23, 0x11, 0x33, 0x11, 0x23, 0xe6, 0x8a, 0x8a, 0x8a, 0x8a, 0x05, 0xfd, 0xfc,
+  0xe6, 0xfe, 0xe1, 0xfc, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x72, 0xff, 0x83, 0x03, 0x87, 0x05, 0xa7, 0x00, 0x48, 0x00, 0x5a, 0x00, 0x00,
+  0x01, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x06, 0x15, 0x14, 0x06, 0x07, 0x1e, 0x01, 0x15, 0x14, 0x0e, 0x02,
+  0x23, 0x22, 0x26, 0x27, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x06, 0x35, 0x34, 0x36, 0x37, 0x2e,
+  0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x01, 0x14, 0x1e, 0x02, 0x17, 0x3e, 0x01, 0x35, 0x34, 0x2e, 0x04, 0x27, 0x0e, 0x01, 0x03,
+  0x31, 0x0c, 0x19, 0x0f, 0x26, 0x37, 0x4c, 0x34, 0x30, 0x4d, 0x35, 0x1c, 0x31, 0x4f, 0x66, 0x69, 0x66, 0x4f, 0x31, 0x4e, 0x54, 0x31, 0x3e, 0x32,
+  0x61, 0x8f, 0x5c, 0x6a, 0xac, 0x3c, 0x29, 0x08, 0x17, 0x11, 0x12, 0x28, 0x3a, 0x55, 0x3f, 0x32, 0x4f, 0x36, 0x1c, 0x32, 0x52, 0x68, 0x6e, 0x68,
+  0x52, 0x32, 0x56, 0x5d, 0x32, 0x3f, 0x30, 0x5c, 0x86, 0x56, 0x64, 0x9f, 0x3a, 0xfd, 0xb7, 0x46, 0x6d, 0x84, 0x3e, 0x36, 0x30, 0x1e, 0x34, 0x46,
+  0x4f, 0x54, 0x28, 0x42, 0x36, 0x04, 0xf1, 0x16, 0x16, 0x1b, 0x17, 0x19, 0x2a, 0x38, 0x1f, 0x26, 0x39, 0x2f, 0x2b, 0x2e, 0x37, 0x47, 0x5c, 0x3d,
+  0x51, 0x7f, 0x26, 0x25, 0x62, 0x45, 0x46, 0x77, 0x57, 0x32, 0x45, 0x36, 0x44, 0x0d, 0x0e, 0x1c, 0x23, 0x1c, 0x19, 0x2d, 0x3e, 0x26, 0x2d, 0x42,
+  0x33, 0x2a, 0x2c, 0x33, 0x46, 0x5d, 0x40, 0x4e, 0x7d, 0x23, 0x26, 0x69, 0x4b, 0x3a, 0x6b, 0x50, 0x30, 0x3e, 0x37, 0xfd, 0xa4, 0x33, 0x47, 0x39,
+  0x35, 0x1f, 0x1a, 0x4b, 0x2f, 0x24, 0x38, 0x2e, 0x26, 0x23, 0x23, 0x14, 0x1e, 0x49, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0e, 0x04, 0x9a, 0x02, 0x56,
+  0x05, 0x7b, 0x00, 0x13, 0x00, 0x27, 0x00, 0x00, 0x13, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02,
+  0x05, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0xef, 0x12, 0x20, 0x29, 0x17, 0x16, 0x28, 0x1f,
+  0x12, 0x12, 0x1f, 0x28, 0x16, 0x17, 0x29, 0x20, 0x12, 0x01, 0x67, 0x12, 0x1f, 0x29, 0x17, 0x17, 0x29, 0x1e, 0x12, 0x12, 0x1e, 0x29, 0x17, 0x17,
+  0x29, 0x1f, 0x12, 0x05, 0x09, 0x17, 0x28, 0x1e, 0x12, 0x12, 0x1e, 0x28, 0x17, 0x17, 0x2a, 0x1f, 0x12, 0x12, 0x1f, 0x2a, 0x17, 0x17, 0x28, 0x1e,
+  0x12, 0x12, 0x1e, 0x28, 0x17, 0x17, 0x2a, 0x1f, 0x12, 0x12, 0x1f, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x44, 0xff, 0xf2, 0x05, 0xf9,
+  0x05, 0xa8, 0x00, 0x2e, 0x00, 0x4a, 0x00, 0x62, 0x00, 0x00, 0x01, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x1f, 0x01, 0x0e, 0x01, 0x23, 0x22, 0x2e, 0x02,
+  0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x33,
+  0x32, 0x3e, 0x02, 0x01, 0x34, 0x3e, 0x04, 0x33, 0x32, 0x1e, 0x04, 0x15, 0x14, 0x0e, 0x04, 0x23, 0x22, 0x2e, 0x04, 0x37, 0x14, 0x1e, 0x04, 0x33,
+  0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x04, 0x23, 0x22, 0x0e, 0x02, 0x04, 0x06, 0x08, 0x0b, 0x06, 0x0b, 0x08, 0x06, 0x3d, 0x39, 0xa6, 0x74, 0x62,
+  0xa1, 0x73, 0x3f, 0x45, 0x7a, 0xa7, 0x62, 0x6c, 0x98, 0x39, 0x2e, 0x05, 0x10, 0x0c, 0x0e, 0x1f, 0x32, 0x4c, 0x3b, 0x46, 0x71, 0x4f, 0x2b, 0x2b,
+  0x4c, 0x6a, 0x3e, 0x30, 0x42, 0x30, 0x25, 0xfc, 0x52, 0x34, 0x5f, 0x86, 0xa2, 0xba, 0x65, 0x65, 0xbb, 0xa2, 0x86, 0x5f, 0x34, 0x34, 0x5f, 0x86,
+  0xa2, 0xbb, 0x65, 0x65, 0xba, 0xa2, 0x86, 0x5f, 0x34, 0x64, 0x2c, 0x52, 0x72, 0x8c, 0xa2, 0x58, 0x84, 0xe7, 0xab, 0x63, 0x2d, 0x52, 0x73, 0x8c,
+  0xa3, 0x58, 0x84, 0xe6, 0xaa, 0x62, 0x01, 0xcf, 0x05, 0x07, 0x06, 0x06, 0x40, 0x42, 0x49, 0x44, 0x7a, 0xa8, 0x64, 0x65, 0xa9, 0x79, 0x43, 0x44,
+  0x37, 0x41, 0x06, 0x0c, 0x16, 0x1b, 0x17, 0x2d, 0x54, 0x78, 0x4b, 0x4d, 0x79, 0x52, 0x2b, 0x0c, 0x14, 0x18, 0x01, 0x09, 0x65, 0xbb, 0xa3, 0x85,
+  0x60, 0x34, 0x34, 0x60, 0x85, 0xa3, 0xbb, 0x65, 0x64, 0xbb, 0xa2, 0x85, 0x60, 0x34, 0x34, 0x60, 0x85, 0xa2, 0xba, 0x65, 0x59, 0xa4, 0x8f, 0x74,
+  0x53, 0x2d, 0x64, 0xad, 0xe9, 0x86, 0x59, 0xa6, 0x8f, 0x76, 0x53, 0x2e, 0x65, 0xaf, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5c,
+  0x03, 0x3f, 0x02, 0x54, 0x05, 0xaa, 0x00, 0x29, 0x00, 0x35, 0x00, 0x00, 0x01, 0x23, 0x22, 0x26, 0x2f, 0x01, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02,
+  0x35, 0x34, 0x3e, 0x02, 0x37, 0x35, 0x34, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x2f, 0x01, 0x3e, 0x01, 0x33, 0x32, 0x1e, 0x02, 0x15,
+  0x01, 0x32, 0x36, 0x37, 0x35, 0x0e, 0x03, 0x15, 0x14, 0x16, 0x02, 0x54, 0x3c, 0x12, 0x12, 0x08, 0x0c, 0x18, 0x2e, 0x32, 0x38, 0x22, 0x26, 0x41,
+  0x30, 0x1b, 0x26, 0x58, 0x91, 0x6b, 0x3a, 0x39, 0x26, 0x32, 0x25, 0x1d, 0x10, 0x0e, 0x14, 0x05, 0x16, 0x34, 0x79, 0x49, 0x36, 0x54, 0x3a, 0x1e,
+  0xfe, 0xe1, 0x33, 0x4a, 0x24, 0x46, 0x61, 0x3c, 0x1a, 0x34, 0x03, 0x48, 0x0b, 0x12, 0x31, 0x15, 0x20, 0x17, 0x0b, 0x14, 0x29, 0x3c, 0x29, 0x22,
+  0x43, 0x35, 0x23, 0x02, 0x25, 0x3f, 0x3c, 0x12, 0x15, 0x11, 0x0f, 0x0a, 0x2a, 0x31, 0x2e, 0x22, 0x3c, 0x54, 0x33, 0xfe, 0xd6, 0x26, 0x23, 0x69,
+  0x02, 0x11, 0x1b, 0x23, 0x15, 0x2a, 0x22, 0x00, 0x00, 0x02, 0x00, 0x8a, 0x00, 0x81, 0x03, 0x01, 0x03, 0xa2, 0x00, 0x14, 0x00, 0x29, 0x00, 0x00,
+  0x13, 0x35, 0x13, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x07, 0x03, 0x06, 0x07, 0x16, 0x17, 0x13, 0x1e, 0x01, 0x15, 0x14, 0x0f, 0x01, 0x13, 0x35, 0x13,
+  0x17, 0x1e, 0x01, 0x15, 0x14, 0x07, 0x03, 0x06, 0x07, 0x16, 0x17, 0x13, 0x1e, 0x01, 0x15, 0x14, 0x0f, 0x01, 0x8a, 0xf9, 0x3a, 0x0e, 0x0e, 0x0a,
+  0x9f, 0x0e, 0x0e, 0x0f, 0x0d, 0x9f, 0x05, 0x05, 0x1c, 0x3a, 0x2f, 0xf9, 0x3a, 0x0e, 0x0e, 0x0a, 0x9f, 0x0e, 0x0e, 0x0f, 0x0d, 0x9f, 0x05, 0x05,
+  0x1c, 0x3a, 0x02, 0x06, 0x17, 0x01, 0x85, 0x1c, 0x07, 0x16, 0x0d, 0x11, 0x10, 0xfe, 0xfb, 0x18, 0x0d, 0x0e, 0x16, 0xfe, 0xfb, 0x08, 0x12, 0x08,
+  0x1c, 0x0d, 0x1c, 0x01, 0x85, 0x17, 0x01, 0x85, 0x1c, 0x07, 0x16, 0x0d, 0x11, 0x10, 0xfe, 0xfb, 0x18, 0x0d, 0x0e, 0x16, 0xfe, 0xfb, 0x08, 0x12,
+  0x08, 0x1c, 0x0d, 0x1c, 0x00, 0x01, 0x00, 0x94, 0x01, 0x3b, 0x03, 0xf0, 0x02, 0xe3, 0x00, 0x05, 0x00, 0x00, 0x13, 0x21, 0x11, 0x23, 0x11, 0x21,
+  0x94, 0x03, 0x5c, 0x97, 0xfd, 0x3b, 0x02, 0xe3, 0xfe, 0x58, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x64, 0x02, 0x0c, 0x02, 0x52,
+  0x02, 0xa3, 0x00, 0x03, 0x00, 0x00, 0x13, 0x21, 0x15, 0x21, 0x64, 0x01, 0xee, 0xfe, 0x12, 0x02, 0xa3, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x44, 0xff, 0xf2, 0x05, 0xf9, 0x05, 0xa8, 0x00, 0x1b, 0x00, 0x33, 0x00, 0x49, 0x00, 0x56, 0x00, 0x00, 0x13, 0x34, 0x3e, 0x04,
+  0x33, 0x32, 0x1e, 0x04, 0x15, 0x14, 0x0e, 0x04, 0x23, 0x22, 0x2e, 0x04, 0x37, 0x14, 0x1e, 0x04, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x04,
+  0x23, 0x22, 0x0e, 0x02, 0x05, 0x11, 0x23, 0x11, 0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x1e, 0x01, 0x17, 0x13, 0x23, 0x22, 0x27, 0x03, 0x2e,
+  0x01, 0x23, 0x27, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x2b, 0x01, 0x44, 0x34, 0x5f, 0x86, 0xa2, 0xba, 0x65, 0x65, 0xbb, 0xa2, 0x86,
+  0x5f, 0x34, 0x34, 0x5f, 0x86, 0xa2, 0xbb, 0x65, 0x65, 0xba, 0xa2, 0x86, 0x5f, 0x34, 0x64, 0x2c, 0x52, 0x72, 0x8c, 0xa2, 0x58, 0x84, 0xe7, 0xab,
+  0x63, 0x2d, 0x52, 0x73, 0x8c, 0xa3, 0x58, 0x84, 0xe6, 0xaa, 0x62, 0x01, 0xe6, 0x9c, 0x01, 0x20, 0xac, 0xa6, 0x6b, 0x6a, 0x11, 0x19, 0x0b, 0xe4,
+  0x94, 0x21, 0x10, 0xc9, 0x09, 0x19, 0x1a, 0x50, 0x74, 0x37, 0x4d, 0x2f, 0x15, 0x13, 0x2b, 0x46, 0x34, 0x84, 0x02, 0xcc, 0x65, 0xbb, 0xa3, 0x85,
+  0x60, 0x34, 0x34, 0x60, 0x85, 0xa3, 0xbb, 0x65, 0x64, 0xbb, 0xa2, 0x85, 0x60, 0x34, 0x34, 0x60, 0x85, 0xa2, 0xba, 0x65, 0x59, 0xa4, 0x8f, 0x74,
+  0x53, 0x2d, 0x64, 0xad, 0xe9, 0x86, 0x59, 0xa6, 0x8f, 0x76, 0x53, 0x2e, 0x65, 0xaf, 0xeb, 0xe0, 0xfe, 0x9e, 0x03, 0x7c, 0x7d, 0x7a, 0x5e, 0x84,
+  0x19, 0x0a, 0x1e, 0x14, 0xfe, 0xb2, 0x19, 0x01, 0x2e, 0x0d, 0x0e, 0x72, 0x15, 0x28, 0x3a, 0x26, 0x25, 0x38, 0x24, 0x12, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x14, 0x04, 0xcf, 0x02, 0x52, 0x05, 0x44, 0x00, 0x03, 0x00, 0x00, 0x13, 0x21, 0x15, 0x21, 0x14, 0x02, 0x3e, 0xfd, 0xc2, 0x05,
+  0x44, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x46, 0x03, 0x27, 0x02, 0xd2, 0x05, 0xaa, 0x00, 0x13, 0x00, 0x27, 0x00, 0x00,
+  0x13, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02,
+  0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x46, 0x32, 0x58, 0x77, 0x45, 0x45, 0x77, 0x58, 0x32, 0x32, 0x58, 0x77, 0x45, 0x45, 0x77, 0x58,
+  0x32, 0x7f, 0x1e, 0x36, 0x49, 0x2a, 0x2a, 0x48, 0x36, 0x1e, 0x1e, 0x36, 0x48, 0x2a, 0x2a, 0x49, 0x36, 0x1e, 0x04, 0x68, 0x43, 0x76, 0x57, 0x32,
+  0x32, 0x57, 0x76, 0x43, 0x42, 0x75, 0x57, 0x33, 0x33, 0x57, 0x75, 0x41, 0x2a, 0x49, 0x36, 0x1f, 0x1f, 0x36, 0x49, 0x2a, 0x2a, 0x4a, 0x37, 0x1f,
+  0x1f, 0x37, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x64, 0x00, 0x50, 0x04, 0x22, 0x04, 0xb2, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00,
+  0x01, 0x11, 0x21, 0x15, 0x21, 0x11, 0x23, 0x11, 0x21, 0x35, 0x21, 0x11, 0x01, 0x21, 0x15, 0x21, 0x02, 0x8b, 0x01, 0x97, 0xfe, 0x69, 0x92, 0xfe,
+  0x6b, 0x01, 0x95, 0xfe, 0x6b, 0x03, 0xbe, 0xfc, 0x42, 0x04, 0xb2, 0xfe, 0x88, 0x88, 0xfe, 0x90, 0x01, 0x70, 0x88, 0x01, 0x78, 0xfc, 0x25, 0x87,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x52, 0x03, 0x84, 0x02, 0x51, 0x06, 0x65, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x32, 0x1e, 0x02, 0x15, 0x14,
+  0x0e, 0x02, 0x0f, 0x01, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x1d, 0x01, 0x21, 0x35, 0x34, 0x36, 0x3f, 0x01, 0x3e, 0x03, 0x35, 0x34, 0x26, 0x23,
+  0x22, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x2f, 0x01, 0x3e, 0x01, 0x01, 0x5a, 0x34, 0x55, 0x3c, 0x21, 0x19, 0x2a, 0x36, 0x1e, 0xa2, 0x17,
+  0x2f, 0x15, 0xc3, 0x15, 0x17, 0xfe, 0x01, 0x0a, 0x0c, 0xdd, 0x19, 0x2c, 0x20, 0x13, 0x3c, 0x2d, 0x2e, 0x39, 0x0e, 0x08, 0x13, 0x11, 0x04, 0x09,
+  0x05, 0x47, 0x0f, 0x8a, 0x06, 0x65, 0x1e, 0x36, 0x4d, 0x2f, 0x28, 0x45, 0x3e, 0x3a, 0x1e, 0xa5, 0x06, 0x08, 0x16, 0x14, 0x4d, 0x2b, 0x0d, 0x1c,
+  0x0c, 0xdb, 0x19, 0x34, 0x35, 0x35, 0x1b, 0x33, 0x37, 0x30, 0x2a, 0x0e, 0x10, 0x01, 0x01, 0x0c, 0x6a, 0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x54,
+  0x03, 0x7c, 0x02, 0x52, 0x06, 0x65, 0x00, 0x3d, 0x00, 0x00, 0x01, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x07, 0x1e, 0x01, 0x15, 0x14, 0x0e, 0x02, 0x23,
+  0x22, 0x2e, 0x02, 0x27, 0x37, 0x36, 0x33, 0x32, 0x17, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x35, 0x3e, 0x01, 0x35,
+  0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x2f, 0x01, 0x3e, 0x03, 0x01, 0x62, 0x33, 0x52, 0x3b, 0x20, 0x77, 0x42, 0x45,
+  0x2a, 0x45, 0x5b, 0x30, 0x39, 0x54, 0x3d, 0x2b, 0x0f, 0x37, 0x0f, 0x0e, 0x1d, 0x0b, 0x06, 0x12, 0x1e, 0x2b, 0x20, 0x1f, 0x2f, 0x20, 0x10, 0x11,
+  0x27, 0x41, 0x2f, 0x57, 0x47, 0x3a, 0x30, 0x30, 0x39, 0x0c, 0x08, 0x11, 0x0f, 0x04, 0x09, 0x05, 0x43, 0x07, 0x2c, 0x41, 0x54, 0x06, 0x65, 0x1d,
+  0x33, 0x44, 0x28, 0x80, 0x2d, 0x13, 0x4e, 0x3e, 0x37, 0x54, 0x39, 0x1d, 0x19, 0x31, 0x48, 0x2f, 0x18, 0x06, 0x17, 0x0d, 0x20, 0x1c, 0x13, 0x14,
+  0x1f, 0x28, 0x15, 0x1e, 0x2b, 0x1c, 0x0e, 0x57, 0x01, 0x3c, 0x34, 0x32, 0x34, 0x2f, 0x28, 0x10, 0x0f, 0x01, 0x01, 0x0c, 0x35, 0x4f, 0x35, 0x1b,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc4, 0x04, 0x8b, 0x02, 0x55, 0x05, 0xa9, 0x00, 0x09, 0x00, 0x00, 0x01, 0x03, 0x0e, 0x01, 0x2b, 0x01,
+  0x37, 0x3e, 0x01, 0x33, 0x02, 0x55, 0xe9, 0x0e, 0x1b, 0x15, 0x6a, 0x94, 0x0e, 0x21, 0x20, 0x05, 0xa9, 0xfe, 0xfe, 0x0f, 0x0d, 0xf2, 0x17, 0x15,
+  0x00, 0x01, 0x00, 0x7a, 0xfe, 0xa9, 0x03, 0xc5, 0x03, 0xf5, 0x00, 0x1d, 0x00, 0x00, 0x01, 0x11, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x11, 0x33,
+  0x11, 0x23, 0x22, 0x2f, 0x01, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x1e, 0x01, 0x15, 0x11, 0x23, 0x22, 0x26, 0x35, 0x11, 0x01, 0x2c, 0x6c, 0x69,
+  0x4e, 0x8a, 0x3a, 0xb2, 0x6a, 0x26, 0x0a, 0x0e, 0x43, 0x8d, 0x57, 0x4a, 0x70, 0x27, 0x07, 0x06, 0x59, 0x26, 0x29, 0x03, 0xf5, 0xfd, 0x6e, 0x6d,
+  0x78, 0x4a, 0x42, 0x02, 0xeb, 0xfc, 0x0b, 0x25, 0x6d, 0x48, 0x44, 0x33, 0x2e, 0x2a, 0x57, 0x26, 0xfe, 0xe9, 0x28, 0x24, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2a, 0xff, 0x37, 0x05, 0x16, 0x05, 0x99, 0x00, 0x13, 0x00, 0x00, 0x01, 0x15, 0x23, 0x11, 0x23, 0x11,
+  0x21, 0x11, 0x23, 0x11, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x05, 0x16, 0xdb, 0x9d, 0xfe, 0xeb, 0x9d, 0x68, 0xa6, 0x75, 0x3f, 0x3f,
+  0x75, 0xa6, 0x68, 0x05, 0x99, 0x99, 0xfa, 0x37, 0x05, 0xc9, 0xfa, 0x37, 0x03, 0x5d, 0x3d, 0x69, 0x8e, 0x51, 0x56, 0x8d, 0x65, 0x38, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x7c, 0x01, 0xbd, 0x01, 0xa7, 0x02, 0xe8, 0x00, 0x13, 0x00, 0x00, 0x13, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14,
+  0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x7c, 0x17, 0x29, 0x36, 0x1e, 0x1f, 0x38, 0x28, 0x18, 0x18, 0x28, 0x38, 0x1f, 0x1e, 0x36, 0x29, 0x17, 0x02,
+  0x51, 0x1f, 0x38, 0x28, 0x18, 0x18, 0x28, 0x38, 0x1f, 0x1e, 0x36, 0x29, 0x17, 0x17, 0x29, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x84,
+  0xfe, 0xa1, 0x01, 0xef, 0x00, 0x0a, 0x00, 0x1d, 0x00, 0x00, 0x17, 0x32, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x37, 0x33,
+  0x07, 0x1e, 0x01, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x37, 0x36, 0xac, 0x06, 0x10, 0x16, 0x20, 0x15, 0x2a, 0x2b, 0x16, 0x29, 0x3c,
+  0x26, 0x2b, 0x70, 0x18, 0x5a, 0x51, 0x20, 0x39, 0x50, 0x30, 0x29, 0x4a, 0x1f, 0x11, 0x06, 0xf7, 0x07, 0x09, 0x07, 0x21, 0x1a, 0x13, 0x1a, 0x12,
+  0x0c, 0x05, 0x8d, 0x50, 0x14, 0x45, 0x36, 0x20, 0x33, 0x24, 0x13, 0x11, 0x0e, 0x37, 0x12, 0x00, 0x00, 0x01, 0x00, 0x78, 0x03, 0x84, 0x02, 0x44,
+  0x06, 0x5f, 0x00, 0x0f, 0x00, 0x00, 0x13, 0x33, 0x11, 0x37, 0x07, 0x06, 0x23, 0x22, 0x2f, 0x01, 0x37, 0x33, 0x11, 0x33, 0x15, 0x21, 0xad, 0x93,
+  0x04, 0x6b, 0x0c, 0x0e, 0x17, 0x09, 0x27, 0xde, 0x6c, 0x82, 0xfe, 0x69, 0x03, 0xd9, 0x01, 0xb8, 0x2b, 0x58, 0x09, 0x0e, 0x38, 0xbe, 0xfd, 0x7a,
+  0x55, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x48, 0x03, 0x3c, 0x02, 0xb1, 0x05, 0xa9, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x32, 0x1e, 0x02,
+  0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x13, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16,
+  0x01, 0x7e, 0x46, 0x71, 0x50, 0x2c, 0x2c, 0x50, 0x71, 0x46, 0x47, 0x72, 0x51, 0x2c, 0x2c, 0x51, 0x72, 0x47, 0x54, 0x53, 0x53, 0x54, 0x57, 0x53,
+  0x53, 0x05, 0xa9, 0x2b, 0x50, 0x73, 0x47, 0x48, 0x74, 0x51, 0x2b, 0x2b, 0x51, 0x74, 0x48, 0x47, 0x73, 0x50, 0x2b, 0xfd, 0xfd, 0x69, 0x64, 0x64,
+  0x68, 0x68, 0x64, 0x64, 0x69, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x96, 0x00, 0x81, 0x03, 0x0d, 0x03, 0xa2, 0x00, 0x12, 0x00, 0x25, 0x00, 0x00,
+  0x37, 0x27, 0x26, 0x35, 0x34, 0x37, 0x13, 0x36, 0x37, 0x26, 0x27, 0x03, 0x26, 0x35, 0x34, 0x3f, 0x01, 0x13, 0x15, 0x25, 0x15, 0x03, 0x27, 0x26,
+  0x35, 0x34, 0x37, 0x13, 0x36, 0x37, 0x26, 0x27, 0x03, 0x26, 0x35, 0x34, 0x3f, 0x01, 0xec, 0x3a, 0x1c, 0x0a, 0x9f, 0x0d, 0x0e, 0x0c, 0x0f, 0x9f,
+  0x0a, 0x1c, 0x3a, 0xf9, 0x01, 0x28, 0xf9, 0x3a, 0x1c, 0x0a, 0x9f, 0x0d, 0x0e, 0x0c, 0x0f, 0x9f, 0x0a, 0x1c, 0x3a, 0x81, 0x1c, 0x0d, 0x1c, 0x11,
+  0x11, 0x01, 0x05, 0x18, 0x0c, 0x0b, 0x1a, 0x01, 0x05, 0x11, 0x11, 0x1c, 0x0d, 0x1c, 0xfe, 0x7b, 0x17, 0x17, 0x17, 0xfe, 0x7b, 0x1c, 0x0d, 0x1c,
+  0x11, 0x11, 0x01, 0x05, 0x18, 0x0c, 0x0b, 0x1a, 0x01, 0x05, 0x11, 0x11, 0x1c, 0x0d, 0x1c, 0x00, 0x00, 0x04, 0x00, 0x66, 0x00, 0x00, 0x05, 0x7c,
+  0x05, 0x9a, 0x00, 0x10, 0x00, 0x20, 0x00, 0x26, 0x00, 0x30, 0x00, 0x00, 0x01, 0x33, 0x15, 0x14, 0x06, 0x2b, 0x01, 0x15, 0x23, 0x35, 0x21, 0x22,
+  0x26, 0x2f, 0x01, 0x01, 0x33, 0x25, 0x33, 0x11, 0x37, 0x07, 0x06, 0x23, 0x22, 0x2f, 0x01, 0x37, 0x33, 0x11, 0x33, 0x15, 0x21, 0x05, 0x34, 0x36,
+  0x37, 0x03, 0x33, 0x05, 0x0e, 0x01, 0x2b, 0x01, 0x01, 0x3e, 0x01, 0x3b, 0x01, 0x05, 0x0f, 0x6d, 0x0e, 0x0d, 0x52, 0x6d, 0xfe, 0xce, 0x12, 0x15,
+  0x02, 0x0a, 0x01, 0x56, 0x7c, 0xfb, 0x8c, 0x93, 0x04, 0x6b, 0x0c, 0x0e, 0x17, 0x09, 0x27, 0xde, 0x6c, 0x82, 0xfe, 0x69, 0x04, 0x07, 0x02, 0x03,
+  0xf1, 0xec, 0xfd, 0x10, 0x13, 0x2c, 0x1d, 0x4c, 0x03, 0x32, 0x12, 0x2e, 0x20, 0x4d, 0x01, 0x0b, 0x41, 0x0b, 0x0f, 0xb0, 0xb0, 0x10, 0x0c, 0x39,
+  0x01, 0xd4, 0x3b, 0x01, 0xb8, 0x2b, 0x58, 0x09, 0x0e, 0x38, 0xbe, 0xfd, 0x7a, 0x55, 0xc3, 0x13, 0x2c, 0x17, 0xfe, 0xb9, 0xd6, 0x1f, 0x16, 0x05,
+  0x5c, 0x1d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x66, 0x00, 0x00, 0x05, 0x5d, 0x05, 0x9a, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x47,
+  0x00, 0x00, 0x01, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x0f, 0x01, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x1d, 0x01, 0x21, 0x35, 0x34, 0x36,
+  0x3f, 0x01, 0x3e, 0x03, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x2f, 0x01, 0x3e, 0x01, 0x25, 0x33, 0x11, 0x37,
+  0x07, 0x06, 0x23, 0x22, 0x2f, 0x01, 0x37, 0x33, 0x11, 0x33, 0x15, 0x21, 0x13, 0x0e, 0x01, 0x2b, 0x01, 0x01, 0x3e, 0x01, 0x3b, 0x01, 0x04, 0x66,
+  0x34, 0x55, 0x3c, 0x21, 0x19, 0x2a, 0x36, 0x1e, 0xa2, 0x17, 0x2f, 0x15, 0xc3, 0x15, 0x17, 0xfe, 0x01, 0x0a, 0x0c, 0xdd, 0x19, 0x2c, 0x20, 0x13,
+  0x3c, 0x2d, 0x2e, 0x39, 0x0e, 0x08, 0x13, 0x11, 0x04, 0x09, 0x05, 0x47, 0x0f, 0x8a, 0xfc, 0x9c, 0x93, 0x04, 0x6b, 0x0c, 0x0e, 0x17, 0x09, 0x27,
+  0xde, 0x6c, 0x82, 0xfe, 0x69, 0xeb, 0x13, 0x2c, 0x1d, 0x4c, 0x03, 0x32, 0x12, 0x2e, 0x20, 0x4d, 0x02, 0xe1, 0x1e, 0x36, 0x4d, 0x2f, 0x28, 0x45,
+  0x3e, 0x3a, 0x1e, 0xa5, 0x06, 0x08, 0x16, 0x14, 0x4d, 0x2b, 0x0d, 0x1c, 0x0c, 0xdb, 0x19, 0x34, 0x35, 0x35, 0x1b, 0x33, 0x37, 0x30, 0x2a, 0x0e,
+  0x10, 0x01, 0x01, 0x0c, 0x6a, 0x6a, 0x33, 0x01, 0xb8, 0x2b, 0x58, 0x09, 0x0e, 0x38, 0xbe, 0xfd, 0x7a, 0x55, 0xfd, 0x76, 0x1f, 0x16, 0x05, 0x5c,
+  0x1d, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x44, 0x00, 0x00, 0x05, 0x7d, 0x05, 0xa0, 0x00, 0x10, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x5e, 0x00, 0x00,
+  0x01, 0x33, 0x15, 0x14, 0x06, 0x2b, 0x01, 0x15, 0x23, 0x35, 0x21, 0x22, 0x26, 0x2f, 0x01, 0x01, 0x33, 0x01, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x07,
+  0x1e, 0x01, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x37, 0x36, 0x33, 0x32, 0x17, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34,
+  0x2e, 0x02, 0x23, 0x35, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x2f, 0x01, 0x3e, 0x03, 0x01, 0x34,
+  0x36, 0x37, 0x03, 0x33, 0x05, 0x0e, 0x01, 0x2b, 0x01, 0x01, 0x3e, 0x01, 0x3b, 0x01, 0x05, 0x10, 0x6d, 0x0e, 0x0d, 0x52, 0x6d, 0xfe, 0xce, 0x12,
+  0x15, 0x02, 0x0a, 0x01, 0x56, 0x7c, 0xfc, 0x42, 0x33, 0x52, 0x3b, 0x20, 0x77, 0x42, 0x45, 0x2a, 0x45, 0x5b, 0x30, 0x39, 0x54, 0x3d, 0x2b, 0x0f,
+  0x37, 0x0f, 0x0e, 0x1d, 0x0b, 0x06, 0x12, 0x1e, 0x2b, 0x20, 0x1f, 0x2f, 0x20, 0x10, 0x11, 0x27, 0x41, 0x2f, 0x57, 0x47, 0x3a, 0x30, 0x30, 0x39,
+  0x0c, 0x08, 0x11, 0x0f, 0x04, 0x09, 0x05, 0x43, 0x07, 0x2c, 0x41, 0x54, 0x03, 0x82, 0x02, 0x03, 0xf1, 0xec, 0xfd, 0x14, 0x13, 0x2c, 0x1d, 0x4c,
+  0x03, 0x32, 0x12, 0x2e, 0x20, 0x4d, 0x01, 0x0b, 0x41, 0x0b, 0x0f, 0xb0, 0xb0, 0x10, 0x0c, 0x39, 0x01, 0xd4, 0x02, 0xc7, 0x1d, 0x33, 0x44, 0x28,
+  0x80, 0x2d, 0x13, 0x4e, 0x3e, 0x37, 0x54, 0x39, 0x1d, 0x19, 0x31, 0x48, 0x2f, 0x18, 0x06, 0x17, 0x0d, 0x20, 0x1c, 0x13, 0x14, 0x1f, 0x28, 0x15,
+  0x1e, 0x2b, 0x1c, 0x0e, 0x57, 0x01, 0x3c, 0x34, 0x32, 0x34, 0x2f, 0x28, 0x10, 0x0f, 0x01, 0x01, 0x0c, 0x35, 0x4f, 0x35, 0x1b, 0xfc, 0x5c, 0x13,
+  0x2c, 0x17, 0xfe, 0xb9, 0xd6, 0x1f, 0x16, 0x05, 0x5c, 0x1d, 0x20, 0x00, 0x00, 0x02, 0x00, 0x2c, 0xfe, 0x9c, 0x03, 0x02, 0x04, 0x05, 0x00, 0x29,
+  0x00, 0x3d, 0x00, 0x00, 0x05, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x04, 0x3f, 0x01, 0x33, 0x17, 0x15, 0x14, 0x0e, 0x04, 0x15,
+  0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x01, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23,
+  0x22, 0x2e, 0x02, 0x03, 0x02, 0x1f, 0x4b, 0x58, 0x68, 0x3c, 0x4f, 0x87, 0x62, 0x38, 0x2d, 0x45, 0x52, 0x47, 0x33, 0x04, 0x12, 0x7a, 0x0c, 0x2d,
+  0x45, 0x4f, 0x45, 0x2d, 0x22, 0x3a, 0x4f, 0x2d, 0x3d, 0x57, 0x3c, 0x26, 0x0c, 0x0e, 0x11, 0x07, 0xfe, 0x71, 0x13, 0x21, 0x2e, 0x1a, 0x1a, 0x2e,
+  0x22, 0x13, 0x13, 0x22, 0x2e, 0x1a, 0x1a, 0x2e, 0x21, 0x13, 0xd4, 0x1d, 0x34, 0x28, 0x17, 0x2c, 0x52, 0x76, 0x4b, 0x4c, 0x6a, 0x4c, 0x36, 0x30,
+  0x31, 0x21, 0x9a, 0xa7, 0x0c, 0x2c, 0x3e, 0x32, 0x2f, 0x3c, 0x50, 0x3b, 0x2c, 0x45, 0x31, 0x1a, 0x1e, 0x24, 0x1e, 0x0c, 0x0b, 0x04, 0x10, 0x1a,
+  0x2e, 0x22, 0x14, 0x14, 0x22, 0x2e, 0x1a, 0x1b, 0x2d, 0x22, 0x13, 0x13, 0x22, 0x2d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0a, 0x00, 0x00, 0x05, 0x49,
+  0x06, 0xf6, 0x02, 0x26, 0x00, 0x22, 0x00, 0x00, 0x00, 0x07, 0x00, 0xcc, 0x01, 0x6b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0a, 0x00, 0x00, 0x05, 0x49,
+  0x06, 0xf6, 0x02, 0x26, 0x00, 0x22, 0x00, 0x00, 0x00, 0x07, 0x00, 0xce, 0x01, 0x6b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0a, 0x00, 0x00, 0x05, 0x49,
+  0x06, 0xdc, 0x02, 0x26, 0x00, 0x22, 0x00, 0x00, 0x00, 0x07, 0x00, 0xcf, 0x01, 0x76, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0a, 0x00, 0x00, 0x05, 0x49,
+  0x06, 0xd2, 0x02, 0x26, 0x00, 0x22, 0x00, 0x00, 0x00, 0x07, 0x00, 0xd1, 0x01, 0x76, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0a, 0x00, 0x00, 0x05, 0x49,
+  0x06, 0xf2, 0x02, 0x26, 0x00, 0x22, 0x00, 0x00, 0x00, 0x07, 0x00, 0xcd, 0x01, 0x76, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0a, 0x00, 0x00, 0x05, 0x49,
+  0x07, 0x2d, 0x02, 0x26, 0x00, 0x22, 0x00, 0x00, 0x00, 0x07, 0x00, 0xd0, 0x01, 0x73, 0x00, 0x00, 0x00, 0x02, 0xff, 0xe8, 0x00, 0x00, 0x06, 0xda,
+  0x05, 0x99, 0x00, 0x12, 0x00, 0x18, 0x00, 0x00, 0x01, 0x21, 0x15, 0x21, 0x13, 0x21, 0x15, 0x21, 0x13, 0x21, 0x15, 0x21, 0x03, 0x21, 0x03, 0x0e,
+  0x01, 0x2b, 0x01, 0x01, 0x21, 0x03, 0x0e, 0x01, 0x07, 0x02, 0xdd, 0x03, 0xfd, 0xfd, 0x13, 0x3c, 0x02, 0x2f, 0xfd, 0xe4, 0x3d, 0x02, 0x61, 0xfc,
+  0xfc, 0x31, 0xfd, 0xd4, 0xb3, 0x0b, 0x25, 0x1a, 0x94, 0x01, 0xda, 0x01, 0xd1, 0x5e, 0x0c, 0x1d, 0x0e, 0x05, 0x99, 0x9e, 0xfe, 0x24, 0x98, 0xfe,
+  0x17, 0x9e, 0x01, 0x88, 0xfe, 0xa5, 0x14, 0x19, 0x02, 0x14, 0x02, 0xf1, 0x29, 0x45, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5a,
+  0xfe, 0xa1, 0x05, 0x09, 0x05, 0xa9, 0x00, 0x4b, 0x00, 0x00, 0x05, 0x32, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x37, 0x2e,
+  0x02, 0x02, 0x35, 0x34, 0x12, 0x36, 0x24, 0x33, 0x32, 0x16, 0x17, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x2e, 0x04, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14,
+  0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x36, 0x33, 0x32, 0x1f, 0x01, 0x0e, 0x01, 0x0f, 0x01, 0x1e, 0x01, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22,
+  0x26, 0x27, 0x37, 0x36, 0x02, 0x83, 0x06, 0x10, 0x16, 0x20, 0x15, 0x2a, 0x2b, 0x16, 0x29, 0x3c, 0x26, 0x24, 0x8b, 0xe2, 0x9f, 0x56, 0x69, 0xbe,
+  0x01, 0x09, 0xa0, 0x9e, 0xe5, 0x59, 0x3f, 0x07, 0x12, 0x11, 0x0d, 0x1d, 0x28, 0x36, 0x4a, 0x62, 0x40, 0x73, 0xbf, 0x8a, 0x4d, 0x4d, 0x85, 0xb6,
+  0x69, 0x40, 0x66, 0x57, 0x4b, 0x26, 0x11, 0x10, 0x10, 0x0d, 0x4c, 0x53, 0xe9, 0xa2, 0x10, 0x5a, 0x51, 0x20, 0x39, 0x50, 0x30, 0x29, 0x4a, 0x1f,
+  0x11, 0x06, 0xf7, 0x07, 0x09, 0x07, 0x21, 0x1a, 0x13, 0x1a, 0x12, 0x0c, 0x05, 0x76, 0x0c, 0x75, 0xbf, 0x01, 0x00, 0x99, 0xa2, 0x01, 0x0e, 0xc2,
+  0x6b, 0x62, 0x54, 0x59, 0x0a, 0x0d, 0x13, 0x1c, 0x20, 0x1c, 0x13, 0x4f, 0x92, 0xd2, 0x82, 0x86, 0xd2, 0x91, 0x4c, 0x0f, 0x20, 0x31, 0x22, 0x0f,
+  0x0d, 0x53, 0x61, 0x70, 0x06, 0x37, 0x14, 0x45, 0x36, 0x20, 0x33, 0x24, 0x13, 0x11, 0x0e, 0x37, 0x12, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xae,
+  0x00, 0x00, 0x04, 0x21, 0x06, 0xf6, 0x02, 0x26, 0x00, 0x26, 0x00, 0x00, 0x00, 0x07, 0x00, 0xcc, 0x01, 0x37, 0x00, 0x00, 0xff, 0xff, 0x00, 0xae,
+  0x00, 0x00, 0x04, 0x21, 0x06, 0xf6, 0x02, 0x26, 0x00, 0x26, 0x00, 0x00, 0x00, 0x07, 0x00, 0xce, 0x01, 0x37, 0x00, 0x00, 0xff, 0xff, 0x00, 0xae,
+  0x00, 0x00, 0x04, 0x21, 0x06, 0xdc, 0x02, 0x26, 0x00, 0x26, 0x00, 0x00, 0x00, 0x07, 0x00, 0xcf, 0x01, 0x42, 0x00, 0x00, 0xff, 0xff, 0x00, 0xae,
+  0x00, 0x00, 0x04, 0x21, 0x06, 0xf2, 0x02, 0x26, 0x00, 0x26, 0x00, 0x00, 0x00, 0x07, 0x00, 0xcd, 0x01, 0x42, 0x00, 0x00, 0xff, 0xff, 0xff, 0xcc,
+  0x00, 0x00, 0x01, 0xbc, 0x06, 0xf6, 0x02, 0x26, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x06, 0x00, 0xcc, 0xf8, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x9a,
+  0x00, 0x00, 0x02, 0x8a, 0x06, 0xf6, 0x02, 0x26, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x06, 0x00, 0xce, 0xf8, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xef,
+  0x00, 0x00, 0x02, 0x7b, 0x06, 0xdc, 0x02, 0x26, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x06, 0x00, 0xcf, 0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf2,
+  0x00, 0x00, 0x02, 0x78, 0x06, 0xf2, 0x02, 0x26, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x06, 0x00, 0xcd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x32,
+  0x00, 0x00, 0x05, 0xd1, 0x05, 0x99, 0x00, 0x10, 0x00, 0x21, 0x00, 0x00, 0x13, 0x33, 0x11, 0x21, 0x32, 0x04, 0x16, 0x12, 0x15, 0x14, 0x02, 0x06,
+  0x04, 0x23, 0x21, 0x11, 0x23, 0x25, 0x34, 0x2e, 0x02, 0x23, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x32, 0x3e, 0x02, 0x32, 0xc5, 0x02, 0x17,
+  0x9e, 0x01, 0x05, 0xba, 0x66, 0x66, 0xba, 0xfe, 0xfb, 0x9e, 0xfd, 0xe9, 0xc5, 0x04, 0xd8, 0x48, 0x84, 0xbc, 0x74, 0xfe, 0xab, 0x01, 0x7d, 0xfe,
+  0x83, 0x01, 0x55, 0x74, 0xbc, 0x84, 0x48, 0x03, 0x0c, 0x02, 0x8d, 0x67, 0xbd, 0xfe, 0xf8, 0xa1, 0xa1, 0xfe, 0xf8, 0xbc, 0x67, 0x02, 0x9a, 0x32,
+  0x84, 0xd0, 0x90, 0x4c, 0xfe, 0x10, 0x72, 0xfe, 0x03, 0x4c, 0x8f, 0xd0, 0xff, 0xff, 0x00, 0xae, 0x00, 0x00, 0x05, 0x38, 0x06, 0xd2, 0x02, 0x26,
+  0x00, 0x2f, 0x00, 0x00, 0x00, 0x07, 0x00, 0xd1, 0x01, 0xda, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xf1, 0x05, 0xe1, 0x06, 0xf6, 0x02, 0x26,
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x07, 0x00, 0xcc, 0x01, 0xe3, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xf1, 0x05, 0xe1, 0x06, 0xf6, 0x02, 0x26,
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x07, 0x00, 0xce, 0x01, 0xe3, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xf1, 0x05, 0xe1, 0x06, 0xdc, 0x02, 0x26,
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x07, 0x00, 0xcf, 0x01, 0xee, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xf1, 0x05, 0xe1, 0x06, 0xd2, 0x02, 0x26,
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x07, 0x00, 0xd1, 0x01, 0xee, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xf1, 0x05, 0xe1, 0x06, 0xf2, 0x02, 0x26,
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x07, 0x00, 0xcd, 0x01, 0xee, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7e, 0x00, 0xdb, 0x04, 0x03, 0x04, 0x58, 0x00, 0x0b,
+  0x00, 0x00, 0x09, 0x02, 0x07, 0x09, 0x01, 0x27, 0x09, 0x01, 0x37, 0x09, 0x01, 0x03, 0xf9, 0xfe, 0xa8, 0x01, 0x62, 0x5f, 0xfe, 0x9e, 0xfe, 0x9b,
+  0x5f, 0x01, 0x64, 0xfe, 0xa7, 0x5f, 0x01, 0x59, 0x01, 0x58, 0x03, 0xf6, 0xfe, 0xa8, 0xfe, 0x9f, 0x60, 0x01, 0x62, 0xfe, 0x9c, 0x60, 0x01, 0x64,
+  0x01, 0x59, 0x60, 0xfe, 0xa6, 0x01, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x5c, 0xff, 0x93, 0x05, 0xe1, 0x05, 0xda, 0x00, 0x21,
+  0x00, 0x2d, 0x00, 0x38, 0x00, 0x00, 0x01, 0x14, 0x02, 0x06, 0x04, 0x23, 0x22, 0x26, 0x27, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x13, 0x26, 0x02, 0x35,
+  0x34, 0x12, 0x36, 0x24, 0x33, 0x32, 0x16, 0x17, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x07, 0x16, 0x12, 0x05, 0x14, 0x16, 0x17, 0x01, 0x2e, 0x01, 0x23,
+  0x22, 0x0e, 0x02, 0x05, 0x34, 0x26, 0x27, 0x01, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x05, 0xe1, 0x66, 0xba, 0xfe, 0xfb, 0x9e, 0x6c, 0xbc, 0x4f, 0x64,
+  0x16, 0x3a, 0x1d, 0x4e, 0xbf, 0x70, 0x7b, 0x66, 0xba, 0x01, 0x04, 0x9e, 0x73, 0xc8, 0x53, 0x52, 0x14, 0x20, 0x20, 0x64, 0xac, 0x67, 0x70, 0xfb,
+  0x41, 0x4b, 0x45, 0x02, 0x93, 0x3c, 0x94, 0x57, 0x73, 0xbc, 0x85, 0x48, 0x03, 0xf8, 0x41, 0x3c, 0xfd, 0x71, 0x74, 0x9c, 0x74, 0xbc, 0x84, 0x48,
+  0x02, 0xcc, 0xa1, 0xfe, 0xf3, 0xc2, 0x6b, 0x31, 0x30, 0x88, 0x1d, 0x1a, 0x01, 0x04, 0x62, 0x01, 0x20, 0xb3, 0xa1, 0x01, 0x0d, 0xc3, 0x6c, 0x3a,
+  0x36, 0x6f, 0x1b, 0x17, 0xeb, 0x62, 0xfe, 0xea, 0xab, 0x87, 0xd3, 0x49, 0x03, 0x83, 0x2a, 0x2b, 0x4e, 0x91, 0xd2, 0x84, 0x7e, 0xc9, 0x48, 0xfc,
+  0x84, 0x46, 0x4d, 0x91, 0xd1, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xa0, 0xff, 0xef, 0x05, 0x15, 0x06, 0xf6, 0x02, 0x26, 0x00, 0x36, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0xcc, 0x01, 0x9d, 0x00, 0x00, 0xff, 0xff, 0x00, 0xa0, 0xff, 0xef, 0x05, 0x15, 0x06, 0xf6, 0x02, 0x26, 0x00, 0x36, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0xce, 0x01, 0x9d, 0x00, 0x00, 0xff, 0xff, 0x00, 0xa0, 0xff, 0xef, 0x05, 0x15, 0x06, 0xdc, 0x02, 0x26, 0x00, 0x36, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0xcf, 0x01, 0xa8, 0x00, 0x00, 0xff, 0xff, 0x00, 0xa0, 0xff, 0xef, 0x05, 0x15, 0x06, 0xf2, 0x02, 0x26, 0x00, 0x36, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0xcd, 0x01, 0xa8, 0x00, 0x00, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x04, 0xe4, 0x06, 0xf6, 0x02, 0x26, 0x00, 0x3a, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0xce, 0x01, 0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc2, 0x00, 0x00, 0x04, 0x7f, 0x05, 0x99, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x00,
+  0x01, 0x11, 0x23, 0x11, 0x33, 0x11, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x27, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x2b,
+  0x01, 0x01, 0x83, 0xc1, 0xc1, 0xe6, 0x88, 0xc9, 0x84, 0x41, 0x46, 0x87, 0xc8, 0x81, 0xe6, 0xe6, 0x53, 0x7f, 0x56, 0x2c, 0xa9, 0xab, 0xe6, 0x01,
+  0x10, 0xfe, 0xf0, 0x05, 0x99, 0xfe, 0xf8, 0x3f, 0x74, 0xa4, 0x65, 0x64, 0xa6, 0x78, 0x43, 0x9a, 0x2c, 0x4f, 0x6e, 0x42, 0x89, 0x9a, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xba, 0xff, 0xf0, 0x04, 0x76, 0x05, 0xae, 0x00, 0x48, 0x00, 0x00, 0x01, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x04, 0x15, 0x14,
+  0x1e, 0x04, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e,
+  0x04, 0x35, 0x34, 0x3e, 0x04, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x3e, 0x02, 0x02, 0xa1, 0x67, 0x97,
+  0x62, 0x2f, 0x2b, 0x40, 0x4b, 0x40, 0x2b, 0x35, 0x50, 0x5d, 0x50, 0x35, 0x39, 0x64, 0x87, 0x4f, 0x61, 0x9e, 0x3c, 0x29, 0x08, 0x17, 0x11, 0x12,
+  0x28, 0x37, 0x4b, 0x35, 0x2c, 0x46, 0x31, 0x1a, 0x38, 0x54, 0x62, 0x54, 0x38, 0x2d, 0x43, 0x4e, 0x43, 0x2d, 0x19, 0x38, 0x59, 0x3f, 0x44, 0x6f,
+  0x4f, 0x2b, 0xb3, 0x45, 0x80, 0xb4, 0x05, 0xae, 0x3c, 0x5d, 0x6e, 0x33, 0x3c, 0x56, 0x42, 0x32, 0x30, 0x33, 0x20, 0x27, 0x34, 0x2d, 0x2f, 0x46,
+  0x66, 0x4e, 0x4e, 0x7a, 0x55, 0x2d, 0x45, 0x36, 0x44, 0x0d, 0x0e, 0x1c, 0x22, 0x1c, 0x1b, 0x2e, 0x40, 0x25, 0x38, 0x46, 0x33, 0x2a, 0x3a, 0x53,
+  0x42, 0x35, 0x4f, 0x3f, 0x36, 0x3c, 0x47, 0x30, 0x20, 0x41, 0x34, 0x21, 0x2a, 0x54, 0x7e, 0x54, 0xfc, 0x26, 0x03, 0xe0, 0x68, 0xaa, 0x7a, 0x42,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xf0, 0x03, 0x7a, 0x05, 0xa9, 0x02, 0x26, 0x00, 0x42, 0x00, 0x00, 0x00, 0x07, 0x00, 0x41,
+  0x00, 0xdd, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xf0, 0x03, 0x7a, 0x05, 0xa9, 0x02, 0x26, 0x00, 0x42, 0x00, 0x00, 0x00, 0x07, 0x00, 0x74,
+  0x00, 0xdd, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xf0, 0x03, 0x7a, 0x05, 0x99, 0x02, 0x26, 0x00, 0x42, 0x00, 0x00, 0x00, 0x07, 0x00, 0xc1,
+  0x00, 0xdd, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xf0, 0x03, 0x7a, 0x05, 0x89, 0x02, 0x26, 0x00, 0x42, 0x00, 0x00, 0x00, 0x07, 0x00, 0xc3,
+  0x00, 0xdd, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xf0, 0x03, 0x7a, 0x05, 0x7b, 0x02, 0x26, 0x00, 0x42, 0x00, 0x00, 0x00, 0x07, 0x00, 0x68,
+  0x00, 0xdd, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xf0, 0x03, 0x7a, 0x05, 0xde, 0x02, 0x26, 0x00, 0x42, 0x00, 0x00, 0x00, 0x07, 0x00, 0xc2,
+  0x00, 0xde, 0x00, 0x00, 0x00, 0x03, 0x00, 0x5c, 0xff, 0xf0, 0x06, 0x0f, 0x04, 0x07, 0x00, 0x43, 0x00, 0x51, 0x00, 0x5c, 0x00, 0x00, 0x01, 0x32,
+  0x1e, 0x02, 0x15, 0x14, 0x06, 0x23, 0x21, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x1f, 0x01, 0x0e, 0x03, 0x23, 0x22, 0x26, 0x27,
+  0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x35, 0x34, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x2f, 0x01, 0x3e,
+  0x01, 0x33, 0x32, 0x16, 0x17, 0x3e, 0x01, 0x01, 0x0e, 0x03, 0x15, 0x14, 0x16, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x01, 0x22, 0x0e, 0x02, 0x07, 0x21,
+  0x34, 0x2e, 0x02, 0x04, 0x8e, 0x52, 0x8d, 0x67, 0x3b, 0x10, 0x19, 0xfd, 0x8d, 0x04, 0x2e, 0x4d, 0x69, 0x41, 0x45, 0x5c, 0x3d, 0x26, 0x10, 0x0e,
+  0x12, 0x06, 0x2f, 0x21, 0x57, 0x63, 0x6a, 0x34, 0x75, 0xbf, 0x37, 0x1b, 0x57, 0x6a, 0x77, 0x3b, 0x45, 0x72, 0x53, 0x2d, 0x42, 0x93, 0xee, 0xac,
+  0x65, 0x63, 0x41, 0x59, 0x41, 0x2f, 0x17, 0x12, 0x1b, 0x08, 0x20, 0x54, 0xb5, 0x71, 0x78, 0x92, 0x21, 0x36, 0xad, 0xfe, 0xb6, 0x7b, 0xac, 0x6c,
+  0x31, 0x64, 0x51, 0x39, 0x63, 0x49, 0x2a, 0x01, 0xbc, 0x3d, 0x60, 0x45, 0x29, 0x07, 0x01, 0xfc, 0x1f, 0x3c, 0x57, 0x04, 0x05, 0x40, 0x7a, 0xaf,
+  0x70, 0x29, 0x1d, 0x5b, 0x87, 0x5a, 0x2c, 0x1d, 0x24, 0x1d, 0x09, 0x08, 0x3d, 0x28, 0x3b, 0x26, 0x13, 0x71, 0x74, 0x3e, 0x58, 0x38, 0x19, 0x23,
+  0x46, 0x6a, 0x48, 0x3c, 0x74, 0x5c, 0x3b, 0x04, 0x32, 0x76, 0x7e, 0x23, 0x2a, 0x23, 0x13, 0x0e, 0x39, 0x51, 0x50, 0x66, 0x5b, 0x58, 0x67, 0xfd,
+  0xe1, 0x05, 0x23, 0x38, 0x48, 0x2a, 0x57, 0x50, 0x24, 0x4a, 0x6e, 0x4a, 0x01, 0xef, 0x29, 0x4e, 0x70, 0x46, 0x41, 0x6f, 0x50, 0x2d, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x4a, 0xfe, 0xa1, 0x03, 0x7f, 0x04, 0x05, 0x00, 0x48, 0x00, 0x00, 0x05, 0x32, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x35, 0x34, 0x2e,
+  0x02, 0x27, 0x37, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02,
+  0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x1f, 0x01, 0x0e, 0x01, 0x0f, 0x01, 0x1e, 0x01, 0x15, 0x14, 0x0e, 0x02, 0x23,
+  0x22, 0x26, 0x27, 0x37, 0x36, 0x01, 0x90, 0x06, 0x10, 0x16, 0x20, 0x15, 0x2a, 0x2b, 0x16, 0x29, 0x3c, 0x26, 0x25, 0x53, 0x8d, 0x66, 0x3a, 0x3f,
+  0x79, 0xb2, 0x73, 0x6a, 0xa4, 0x3f, 0x2f, 0x08, 0x10, 0x0f, 0x0f, 0x23, 0x36, 0x4d, 0x38, 0x4a, 0x72, 0x4d, 0x27, 0x2a, 0x4c, 0x6d, 0x44, 0x41,
+  0x54, 0x38, 0x24, 0x12, 0x0b, 0x11, 0x06, 0x32, 0x3b, 0xaa, 0x61, 0x11, 0x5a, 0x51, 0x20, 0x39, 0x50, 0x30, 0x29, 0x4a, 0x1f, 0x11, 0x06, 0xf7,
+  0x07, 0x09, 0x07, 0x21, 0x1a, 0x13, 0x1a, 0x12, 0x0c, 0x05, 0x79, 0x0b, 0x4f, 0x84, 0xb6, 0x71, 0x71, 0xc0, 0x8b, 0x4e, 0x45, 0x3f, 0x40, 0x0b,
+  0x0c, 0x19, 0x1e, 0x19, 0x35, 0x64, 0x8e, 0x58, 0x5c, 0x8f, 0x61, 0x33, 0x1f, 0x26, 0x1f, 0x09, 0x08, 0x41, 0x48, 0x4a, 0x08, 0x3a, 0x14, 0x45,
+  0x36, 0x20, 0x33, 0x24, 0x13, 0x11, 0x0e, 0x37, 0x12, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xf2, 0x03, 0xc7, 0x05, 0xa9, 0x02, 0x26,
+  0x00, 0x46, 0x00, 0x00, 0x00, 0x07, 0x00, 0x41, 0x00, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xf2, 0x03, 0xc7, 0x05, 0xa9, 0x02, 0x26,
+  0x00, 0x46, 0x00, 0x00, 0x00, 0x07, 0x00, 0x74, 0x00, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xf2, 0x03, 0xc7, 0x05, 0x99, 0x02, 0x26,
+  0x00, 0x46, 0x00, 0x00, 0x00, 0x07, 0x00, 0xc1, 0x00, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x4a, 0xff, 0xf2, 0x03, 0xc7, 0x05, 0x7b, 0x02, 0x26,
+  0x00, 0x46, 0x00, 0x00, 0x00, 0x07, 0x00, 0x68, 0x00, 0xf4, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf9, 0x00, 0x00, 0x01, 0x86, 0x05, 0xa9, 0x02, 0x26,
+  0x00, 0xc0, 0x00, 0x00, 0x00, 0x06, 0x00, 0x41, 0xd3, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x97, 0x00, 0x00, 0x02, 0x28, 0x05, 0xa9, 0x02, 0x26,
+  0x00, 0xc0, 0x00, 0x00, 0x00, 0x06, 0x00, 0x74, 0xd3, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xd2, 0x00, 0x00, 0x02, 0x36, 0x05, 0x99, 0x02, 0x26,
+  0x00, 0xc0, 0x00, 0x00, 0x00, 0x06, 0x00, 0xc1, 0xd2, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xe1, 0x00, 0x00, 0x02, 0x29, 0x05, 0x7b, 0x02, 0x26,
+  0x00, 0xc0, 0x00, 0x00, 0x00, 0x06, 0x00, 0x68, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x4c, 0xff, 0xf3, 0x04, 0x05, 0x05, 0x86, 0x00, 0x34,
+  0x00, 0x48, 0x00, 0x00, 0x01, 0x2e, 0x01, 0x35, 0x34, 0x3f, 0x01, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x3f, 0x01, 0x1e, 0x01, 0x17, 0x37,
+  0x17, 0x16, 0x15, 0x14, 0x0f, 0x01, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17,
+  0x2e, 0x01, 0x27, 0x07, 0x13, 0x32, 0x3e, 0x02, 0x37, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x01, 0xa1, 0x04, 0x05, 0x17,
+  0x67, 0x2d, 0x65, 0x39, 0x12, 0x19, 0x05, 0x14, 0x60, 0xb4, 0x51, 0xa7, 0x23, 0x08, 0x16, 0x61, 0x3c, 0x63, 0x46, 0x27, 0x3e, 0x7b, 0xb7, 0x78,
+  0x62, 0xaa, 0x7d, 0x48, 0x3e, 0x74, 0xa5, 0x68, 0x64, 0xb1, 0x41, 0x14, 0x75, 0x5e, 0xb8, 0x5f, 0x47, 0x73, 0x51, 0x2e, 0x03, 0x10, 0x34, 0x4b,
+  0x63, 0x3e, 0x4b, 0x71, 0x4c, 0x27, 0x2e, 0x50, 0x69, 0x04, 0x29, 0x07, 0x0d, 0x06, 0x16, 0x0f, 0x48, 0x14, 0x22, 0x0e, 0x05, 0x1b, 0x17, 0x0f,
+  0x0e, 0x3e, 0x10, 0x3c, 0x30, 0x7a, 0x39, 0x0d, 0x0b, 0x15, 0x10, 0x43, 0x31, 0x7c, 0x9b, 0xb9, 0x6e, 0x8f, 0xe4, 0xa0, 0x56, 0x42, 0x7b, 0xb2,
+  0x70, 0x5e, 0xa7, 0x7e, 0x4a, 0x56, 0x57, 0x88, 0xbe, 0x40, 0x87, 0xfc, 0x8c, 0x36, 0x6d, 0xa5, 0x6f, 0x2b, 0x51, 0x3f, 0x25, 0x32, 0x57, 0x77,
+  0x44, 0x51, 0x7f, 0x56, 0x2d, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x92, 0x00, 0x00, 0x03, 0xdd, 0x05, 0x89, 0x02, 0x26, 0x00, 0x4f, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0xc3, 0x01, 0x02, 0x00, 0x00, 0xff, 0xff, 0x00, 0x48, 0xff, 0xf2, 0x04, 0x0e, 0x05, 0xa9, 0x02, 0x26, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x41, 0x00, 0xfb, 0x00, 0x00, 0xff, 0xff, 0x00, 0x48, 0xff, 0xf2, 0x04, 0x0e, 0x05, 0xa9, 0x02, 0x26, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x74, 0x00, 0xfb, 0x00, 0x00, 0xff, 0xff, 0x00, 0x48, 0xff, 0xf2, 0x04, 0x0e, 0x05, 0x99, 0x02, 0x26, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0xc1, 0x00, 0xfb, 0x00, 0x00, 0xff, 0xff, 0x00, 0x48, 0xff, 0xf2, 0x04, 0x0e, 0x05, 0x89, 0x02, 0x26, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0xc3, 0x00, 0xfb, 0x00, 0x00, 0xff, 0xff, 0x00, 0x48, 0xff, 0xf2, 0x04, 0x0e, 0x05, 0x7b, 0x02, 0x26, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x68, 0x00, 0xfb, 0x00, 0x00, 0x00, 0x03, 0x00, 0x64, 0x00, 0xbd, 0x04, 0x22, 0x04, 0x80, 0x00, 0x03, 0x00, 0x17, 0x00, 0x2b,
+  0x00, 0x00, 0x13, 0x21, 0x15, 0x21, 0x01, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x11, 0x34,
+  0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x64, 0x03, 0xbe, 0xfc, 0x42, 0x01, 0x62, 0x13, 0x21, 0x2d,
+  0x1b, 0x1a, 0x2d, 0x22, 0x14, 0x14, 0x22, 0x2d, 0x1a, 0x1b, 0x2d, 0x21, 0x13, 0x13, 0x21, 0x2d, 0x1b, 0x1a, 0x2d, 0x22, 0x14, 0x14, 0x22, 0x2d,
+  0x1a, 0x1b, 0x2d, 0x21, 0x13, 0x02, 0xe3, 0x87, 0x01, 0xa6, 0x1a, 0x2e, 0x22, 0x14, 0x14, 0x22, 0x2e, 0x1a, 0x1b, 0x2d, 0x22, 0x13, 0x13, 0x22,
+  0x2d, 0xfd, 0x53, 0x1a, 0x2e, 0x22, 0x14, 0x14, 0x22, 0x2e, 0x1a, 0x1b, 0x2d, 0x22, 0x13, 0x13, 0x22, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x40, 0xff, 0xb4, 0x04, 0x2d, 0x04, 0x49, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x00, 0x01, 0x1e, 0x01, 0x15, 0x14, 0x0e,
+  0x02, 0x23, 0x22, 0x26, 0x27, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x37, 0x2e, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x37, 0x3e, 0x01,
+  0x3b, 0x01, 0x01, 0x14, 0x17, 0x01, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x01, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x27, 0x01, 0x16, 0x03, 0x90, 0x3d, 0x42,
+  0x43, 0x7d, 0xb3, 0x6f, 0x4c, 0x83, 0x36, 0x37, 0x16, 0x3b, 0x1d, 0x43, 0x91, 0x42, 0x46, 0x44, 0x7e, 0xb3, 0x6f, 0x4f, 0x87, 0x38, 0x44, 0x14,
+  0x20, 0x20, 0x5a, 0xfc, 0xc9, 0x3b, 0x01, 0xb4, 0x49, 0x6f, 0x4c, 0x74, 0x4f, 0x28, 0x01, 0x37, 0x4b, 0x73, 0x4f, 0x28, 0x34, 0xfe, 0x4f, 0x46,
+  0x03, 0x74, 0x44, 0xbf, 0x76, 0x78, 0xc0, 0x88, 0x49, 0x22, 0x20, 0x4a, 0x1d, 0x19, 0xc4, 0x45, 0xc2, 0x7c, 0x77, 0xc1, 0x88, 0x4a, 0x26, 0x23,
+  0x5b, 0x1b, 0x17, 0xfd, 0xb1, 0xa0, 0x61, 0x02, 0x4e, 0x38, 0x36, 0x64, 0x91, 0xfe, 0x24, 0x35, 0x64, 0x8f, 0x5a, 0x97, 0x60, 0xfd, 0xb7, 0x30,
+  0xff, 0xff, 0x00, 0x7a, 0xff, 0xf0, 0x03, 0xc5, 0x05, 0xa9, 0x02, 0x26, 0x00, 0x56, 0x00, 0x00, 0x00, 0x07, 0x00, 0x41, 0x00, 0xf5, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x7a, 0xff, 0xf0, 0x03, 0xc5, 0x05, 0xa9, 0x02, 0x26, 0x00, 0x56, 0x00, 0x00, 0x00, 0x07, 0x00, 0x74, 0x00, 0xf5, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x7a, 0xff, 0xf0, 0x03, 0xc5, 0x05, 0x99, 0x02, 0x26, 0x00, 0x56, 0x00, 0x00, 0x00, 0x07, 0x00, 0xc1, 0x00, 0xf5, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x7a, 0xff, 0xf0, 0x03, 0xc5, 0x05, 0x7b, 0x02, 0x26, 0x00, 0x56, 0x00, 0x00, 0x00, 0x07, 0x00, 0x68, 0x00, 0xf5, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x0e, 0xfe, 0xa9, 0x03, 0xf0, 0x05, 0xa9, 0x02, 0x26, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x74, 0x00, 0xe4, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x92, 0xfe, 0xa9, 0x04, 0x0f, 0x05, 0xc1, 0x00, 0x14, 0x00, 0x23, 0x00, 0x00, 0x13, 0x11, 0x33, 0x11, 0x3e, 0x01, 0x33, 0x32,
+  0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x11, 0x01, 0x22, 0x06, 0x07, 0x11, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x35, 0x34, 0x2e,
+  0x02, 0x92, 0xb2, 0x3f, 0xa4, 0x69, 0x57, 0x8e, 0x64, 0x36, 0x3c, 0x70, 0xa3, 0x66, 0x5f, 0x84, 0x33, 0x01, 0x11, 0x57, 0x83, 0x37, 0x31, 0x75,
+  0x48, 0x8d, 0x98, 0x23, 0x42, 0x60, 0xfe, 0xa9, 0x07, 0x18, 0xfd, 0xa1, 0x4a, 0x59, 0x42, 0x83, 0xc1, 0x7e, 0x70, 0xc1, 0x8d, 0x51, 0x45, 0x3f,
+  0xfe, 0x33, 0x04, 0xce, 0x50, 0x49, 0xfe, 0x16, 0x42, 0x36, 0xca, 0xbb, 0x63, 0x8e, 0x5b, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0e,
+  0xfe, 0xa9, 0x03, 0xf0, 0x05, 0x7b, 0x02, 0x26, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x68, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa6,
+  0x00, 0x00, 0x01, 0x58, 0x03, 0xf5, 0x00, 0x03, 0x00, 0x00, 0x01, 0x11, 0x23, 0x11, 0x01, 0x58, 0xb2, 0x03, 0xf5, 0xfc, 0x0b, 0x03, 0xf5, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x04, 0x91, 0x02, 0x64, 0x05, 0x99, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x23, 0x22, 0x2f, 0x02, 0x0f, 0x01, 0x0e, 0x01, 0x2b,
+  0x01, 0x13, 0x33, 0x02, 0x64, 0x77, 0x15, 0x13, 0x80, 0x11, 0x10, 0x81, 0x06, 0x16, 0x0c, 0x7b, 0xdf, 0xa6, 0x04, 0x91, 0x0e, 0x7e, 0x11, 0x11,
+  0x7e, 0x05, 0x09, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x6a, 0x04, 0x6b, 0x01, 0xfb, 0x05, 0xde, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x00,
+  0x13, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34,
+  0x26, 0x23, 0x22, 0x06, 0x6a, 0x20, 0x37, 0x48, 0x28, 0x29, 0x49, 0x38, 0x20, 0x20, 0x38, 0x49, 0x29, 0x28, 0x48, 0x37, 0x20, 0x64, 0x36, 0x2f,
+  0x2d, 0x37, 0x37, 0x2d, 0x2f, 0x36, 0x05, 0x23, 0x2a, 0x44, 0x32, 0x1b, 0x1b, 0x32, 0x44, 0x2a, 0x29, 0x44, 0x30, 0x1b, 0x1b, 0x30, 0x44, 0x29,
+  0x2c, 0x38, 0x38, 0x2c, 0x2d, 0x38, 0x38, 0x00, 0x00, 0x01, 0x00, 0x12, 0x04, 0xae, 0x02, 0x59, 0x05, 0x89, 0x00, 0x1a, 0x00, 0x00, 0x01, 0x32,
+  0x36, 0x37, 0x33, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x23, 0x22, 0x07, 0x23, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x01, 0xa1, 0x24,
+  0x27, 0x01, 0x6c, 0x19, 0x2f, 0x41, 0x28, 0x23, 0x3d, 0x36, 0x30, 0x17, 0x48, 0x02, 0x6f, 0x1a, 0x30, 0x42, 0x27, 0x23, 0x3d, 0x36, 0x2f, 0x05,
+  0x2d, 0x2a, 0x2c, 0x2f, 0x4f, 0x38, 0x1f, 0x1d, 0x22, 0x1d, 0x58, 0x30, 0x4f, 0x39, 0x1f, 0x1d, 0x22, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x9c,
+  0x02, 0x0d, 0x03, 0xbc, 0x02, 0x8f, 0x00, 0x03, 0x00, 0x00, 0x13, 0x21, 0x15, 0x21, 0x9c, 0x03, 0x20, 0xfc, 0xe0, 0x02, 0x8f, 0x82, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x9c, 0x02, 0x0d, 0x05, 0xce, 0x02, 0x8f, 0x00, 0x03, 0x00, 0x00, 0x13, 0x21, 0x15, 0x21, 0x9c, 0x05,
+  0x32, 0xfa, 0xce, 0x02, 0x8f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3a, 0x03, 0xf4, 0x01, 0x27, 0x05, 0xf9, 0x00, 0x18,
+  0x00, 0x00, 0x13, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x07, 0x0e, 0x03, 0x15, 0x14, 0x16, 0x17, 0x16, 0x15, 0x14,
+  0x07, 0x72, 0x1d, 0x1b, 0x59, 0x50, 0x37, 0x08, 0x05, 0x0a, 0x10, 0x1e, 0x18, 0x0e, 0x13, 0x17, 0x07, 0x1b, 0x03, 0xf4, 0x30, 0x61, 0x30, 0x5a,
+  0xa5, 0x45, 0x22, 0x05, 0x0c, 0x06, 0x0e, 0x0a, 0x14, 0x2c, 0x31, 0x36, 0x1e, 0x20, 0x44, 0x26, 0x0b, 0x0c, 0x18, 0x0a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x5a, 0x03, 0xdf, 0x01, 0x46, 0x05, 0xe4, 0x00, 0x18, 0x00, 0x00, 0x01, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x27, 0x2e, 0x01,
+  0x35, 0x34, 0x37, 0x3e, 0x03, 0x35, 0x34, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x01, 0x0f, 0x1d, 0x1a, 0x59, 0x4f, 0x37, 0x08, 0x05, 0x0a, 0x10,
+  0x1e, 0x18, 0x0e, 0x13, 0x17, 0x07, 0x1b, 0x05, 0xe4, 0x30, 0x60, 0x30, 0x5b, 0xa5, 0x45, 0x22, 0x05, 0x0c, 0x06, 0x0e, 0x0a, 0x13, 0x2d, 0x31,
+  0x36, 0x1e, 0x20, 0x44, 0x26, 0x0b, 0x0b, 0x18, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3a, 0x03, 0xf4, 0x02, 0x57, 0x05, 0xf9, 0x00, 0x18,
+  0x00, 0x31, 0x00, 0x00, 0x13, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x07, 0x0e, 0x03, 0x15, 0x14, 0x16, 0x17, 0x16,
+  0x15, 0x14, 0x07, 0x17, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x07, 0x0e, 0x03, 0x15, 0x14, 0x16, 0x17, 0x16, 0x15,
+  0x14, 0x07, 0x72, 0x1d, 0x1b, 0x59, 0x50, 0x37, 0x08, 0x05, 0x0a, 0x10, 0x1e, 0x18, 0x0e, 0x13, 0x17, 0x07, 0x1b, 0xc3, 0x1d, 0x1b, 0x59, 0x50,
+  0x37, 0x08, 0x05, 0x0a, 0x10, 0x1e, 0x18, 0x0e, 0x13, 0x17, 0x07, 0x1b, 0x03, 0xf4, 0x30, 0x61, 0x30, 0x5a, 0xa5, 0x45, 0x22, 0x05, 0x0c, 0x06,
+  0x0e, 0x0a, 0x14, 0x2c, 0x31, 0x36, 0x1e, 0x20, 0x44, 0x26, 0x0b, 0x0c, 0x18, 0x0a, 0x2c, 0x30, 0x61, 0x30, 0x5a, 0xa5, 0x45, 0x22, 0x05, 0x0c,
+  0x06, 0x0e, 0x0a, 0x14, 0x2c, 0x31, 0x36, 0x1e, 0x20, 0x44, 0x26, 0x0b, 0x0c, 0x18, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x5a, 0x03, 0xdf, 0x02, 0x76,
+  0x05, 0xe4, 0x00, 0x18, 0x00, 0x31, 0x00, 0x00, 0x01, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x37, 0x3e, 0x03, 0x35,
+  0x34, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x25, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x37, 0x3e, 0x03, 0x35, 0x34,
+  0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x01, 0x0f, 0x1d, 0x1a, 0x59, 0x4f, 0x37, 0x08, 0x05, 0x0a, 0x10, 0x1e, 0x18, 0x0e, 0x13, 0x17, 0x07, 0x1b,
+  0x01, 0x9d, 0x1d, 0x1a, 0x59, 0x4f, 0x37, 0x08, 0x05, 0x0a, 0x10, 0x1e, 0x18, 0x0e, 0x13, 0x17, 0x07, 0x1b, 0x05, 0xe4, 0x30, 0x60, 0x30, 0x5b,
+  0xa5, 0x45, 0x22, 0x05, 0x0c, 0x06, 0x0e, 0x0a, 0x13, 0x2d, 0x31, 0x36, 0x1e, 0x20, 0x44, 0x26, 0x0b, 0x0b, 0x18, 0x0b, 0x2c, 0x30, 0x60, 0x30,
+  0x5b, 0xa5, 0x45, 0x22, 0x05, 0x0c, 0x06, 0x0e, 0x0a, 0x13, 0x2d, 0x31, 0x36, 0x1e, 0x20, 0x44, 0x26, 0x0b, 0x0b, 0x18, 0x0b, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xd0, 0x00, 0xe0, 0x03, 0xb7, 0x03, 0xc8, 0x00, 0x13, 0x00, 0x00, 0x13, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14,
+  0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0xd0, 0x3b, 0x64, 0x87, 0x4c, 0x4d, 0x88, 0x65, 0x3b, 0x3b, 0x65, 0x88, 0x4d, 0x4c, 0x87, 0x64, 0x3b, 0x02,
+  0x53, 0x4d, 0x88, 0x65, 0x3b, 0x3b, 0x65, 0x88, 0x4d, 0x4d, 0x87, 0x64, 0x3b, 0x3b, 0x64, 0x87, 0x00, 0x03, 0x00, 0x58, 0xff, 0xf1, 0x05, 0x56,
+  0x00, 0xec, 0x00, 0x13, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x00, 0x37, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22,
+  0x2e, 0x02, 0x25, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x25, 0x34, 0x3e, 0x02, 0x33, 0x32,
+  0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x58, 0x13, 0x21, 0x2e, 0x1a, 0x1a, 0x2e, 0x22, 0x13, 0x13, 0x22, 0x2e, 0x1a, 0x1a,
+  0x2e, 0x21, 0x13, 0x04, 0x05, 0x13, 0x21, 0x2e, 0x1a, 0x1a, 0x2e, 0x22, 0x13, 0x13, 0x22, 0x2e, 0x1a, 0x1a, 0x2e, 0x21, 0x13, 0xfd, 0xfd, 0x13,
+  0x21, 0x2e, 0x1a, 0x1a, 0x2e, 0x22, 0x13, 0x13, 0x22, 0x2e, 0x1a, 0x1a, 0x2e, 0x21, 0x13, 0x6e, 0x1a, 0x2e, 0x22, 0x14, 0x14, 0x22, 0x2e, 0x1a,
+  0x1b, 0x2d, 0x22, 0x13, 0x13, 0x22, 0x2d, 0x1b, 0x1a, 0x2e, 0x22, 0x14, 0x14, 0x22, 0x2e, 0x1a, 0x1b, 0x2d, 0x22, 0x13, 0x13, 0x22, 0x2d, 0x1b,
+  0x1a, 0x2e, 0x22, 0x14, 0x14, 0x22, 0x2e, 0x1a, 0x1b, 0x2d, 0x22, 0x13, 0x13, 0x22, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xd4,
+  0x06, 0x0a, 0x01, 0xc4, 0x06, 0xf6, 0x00, 0x09, 0x00, 0x00, 0x13, 0x32, 0x16, 0x1f, 0x01, 0x23, 0x22, 0x26, 0x27, 0x25, 0x9d, 0x20, 0x20, 0x14,
+  0xd3, 0x8b, 0x15, 0x18, 0x11, 0xfe, 0xd9, 0x06, 0xf6, 0x0d, 0x14, 0xcb, 0x07, 0x0c, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xf0,
+  0x06, 0x16, 0x02, 0x76, 0x06, 0xf2, 0x00, 0x13, 0x00, 0x27, 0x00, 0x00, 0x13, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02,
+  0x33, 0x32, 0x1e, 0x02, 0x05, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0xcc, 0x12, 0x1e, 0x29,
+  0x17, 0x15, 0x27, 0x1e, 0x12, 0x12, 0x1e, 0x27, 0x15, 0x17, 0x29, 0x1e, 0x12, 0x01, 0xaa, 0x12, 0x1e, 0x28, 0x16, 0x17, 0x28, 0x1e, 0x11, 0x11,
+  0x1e, 0x28, 0x17, 0x16, 0x28, 0x1e, 0x12, 0x06, 0x82, 0x16, 0x27, 0x1e, 0x11, 0x11, 0x1e, 0x27, 0x16, 0x17, 0x29, 0x1e, 0x12, 0x12, 0x1e, 0x29,
+  0x17, 0x16, 0x27, 0x1e, 0x11, 0x11, 0x1e, 0x27, 0x16, 0x17, 0x29, 0x1e, 0x12, 0x12, 0x1e, 0x29, 0x00, 0x01, 0x00, 0xa2, 0x06, 0x0a, 0x02, 0x92,
+  0x06, 0xf6, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x05, 0x0e, 0x01, 0x2b, 0x01, 0x37, 0x3e, 0x03, 0x33, 0x02, 0x92, 0xfe, 0xda, 0x11, 0x1a, 0x15, 0x8a,
+  0xd3, 0x0a, 0x11, 0x12, 0x16, 0x11, 0x06, 0xf6, 0xd8, 0x0c, 0x08, 0xcb, 0x0a, 0x0c, 0x08, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xec,
+  0x06, 0x0a, 0x02, 0x78, 0x06, 0xdc, 0x00, 0x10, 0x00, 0x00, 0x01, 0x23, 0x22, 0x26, 0x2f, 0x01, 0x26, 0x27, 0x06, 0x0f, 0x01, 0x0e, 0x01, 0x2b,
+  0x01, 0x37, 0x33, 0x02, 0x78, 0x87, 0x0c, 0x1c, 0x09, 0x82, 0x08, 0x04, 0x08, 0x04, 0x82, 0x09, 0x1c, 0x0c, 0x87, 0xee, 0xb0, 0x06, 0x0a, 0x07,
+  0x06, 0x5f, 0x04, 0x04, 0x06, 0x02, 0x5f, 0x06, 0x07, 0xd2, 0x00, 0x00, 0x00, 0x02, 0x00, 0x76, 0x05, 0xcd, 0x01, 0xf1, 0x07, 0x2d, 0x00, 0x13,
+  0x00, 0x1f, 0x00, 0x00, 0x13, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x37, 0x14, 0x16, 0x33,
+  0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x76, 0x1f, 0x33, 0x44, 0x26, 0x27, 0x45, 0x35, 0x1e, 0x1e, 0x35, 0x45, 0x27, 0x26, 0x44, 0x33,
+  0x1f, 0x59, 0x36, 0x2f, 0x2d, 0x37, 0x37, 0x2d, 0x2f, 0x36, 0x06, 0x7b, 0x27, 0x42, 0x2f, 0x1a, 0x1a, 0x2f, 0x42, 0x27, 0x26, 0x40, 0x2e, 0x1a,
+  0x1a, 0x2e, 0x40, 0x26, 0x2b, 0x39, 0x39, 0x2b, 0x2d, 0x38, 0x38, 0x00, 0x00, 0x01, 0x00, 0x1a, 0x06, 0x08, 0x02, 0x56, 0x06, 0xd2, 0x00, 0x1b,
+  0x00, 0x00, 0x01, 0x32, 0x36, 0x37, 0x33, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x23, 0x22, 0x06, 0x07, 0x23, 0x34, 0x3e, 0x02, 0x33, 0x32,
+  0x1e, 0x02, 0x01, 0xab, 0x23, 0x25, 0x01, 0x62, 0x16, 0x2a, 0x3e, 0x28, 0x23, 0x40, 0x3b, 0x34, 0x18, 0x22, 0x25, 0x01, 0x64, 0x17, 0x2b, 0x3f,
+  0x27, 0x23, 0x40, 0x3a, 0x34, 0x06, 0x7f, 0x29, 0x25, 0x2b, 0x48, 0x35, 0x1d, 0x1a, 0x1f, 0x1a, 0x2b, 0x24, 0x2b, 0x49, 0x34, 0x1e, 0x1a, 0x1f,
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x1a, 0xa0, 0x0e, 0x55, 0xe6, 0x27, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x19, 0x07, 0xd0,
+  0x00, 0x00, 0x00, 0x00, 0xca, 0x93, 0x5e, 0x70, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xd3, 0xa1, 0xe3, 0xff, 0x44, 0xfe, 0x93, 0x08, 0xb9, 0x07, 0x2d,
+  0x00, 0x00, 0x00, 0x09, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0xb6, 0xfe, 0x56, 0x00, 0x00, 0x09, 0x02,
+  0xff, 0x44, 0xff, 0x43, 0x08, 0xb9, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2,
+  0x04, 0x27, 0x00, 0x2d, 0x01, 0x82, 0x00, 0x00, 0x02, 0xae, 0x00, 0xda, 0x03, 0x1a, 0x00, 0x98, 0x04, 0x88, 0x00, 0x36, 0x04, 0x88, 0x00, 0x6a,
+  0x06, 0x24, 0x00, 0x48, 0x05, 0x7e, 0x00, 0x52, 0x01, 0xcc, 0x00, 0x98, 0x02, 0x58, 0x00, 0x86, 0x02, 0x58, 0x00, 0x4a, 0x03, 0x20, 0x00, 0x60,
+  0x04, 0x88, 0x00, 0x64, 0x01, 0xa8, 0x00, 0x5e, 0x02, 0xb6, 0x00, 0x64, 0x01, 0xa8, 0x00, 0x58, 0x02, 0xea, 0xff, 0xf4, 0x04, 0x88, 0x00, 0x3c,
+  0x04, 0x88, 0x00, 0xca, 0x04, 0x88, 0x00, 0x68, 0x04, 0x88, 0x00, 0x6c, 0x04, 0x88, 0x00, 0x28, 0x04, 0x88, 0x00, 0x6c, 0x04, 0x88, 0x00, 0x6c,
+  0x04, 0x88, 0x00, 0x6e, 0x04, 0x88, 0x00, 0x60, 0x04, 0x88, 0x00, 0x94, 0x01, 0xf8, 0x00, 0x80, 0x01, 0xf8, 0x00, 0x80, 0x04, 0x88, 0x00, 0x94,
+  0x04, 0x88, 0x00, 0x96, 0x04, 0x88, 0x00, 0xee, 0x03, 0x1c, 0x00, 0x22, 0x06, 0x6c, 0x00, 0x56, 0x05, 0x50, 0x00, 0x0a, 0x05, 0x0e, 0x00, 0xae,
+  0x05, 0x5a, 0x00, 0x5a, 0x05, 0xe2, 0x00, 0xae, 0x04, 0x8a, 0x00, 0xae, 0x04, 0x6c, 0x00, 0xae, 0x05, 0xbc, 0x00, 0x5a, 0x05, 0xe8, 0x00, 0xae,
+  0x02, 0x66, 0x00, 0xd2, 0x03, 0x78, 0x00, 0x3c, 0x05, 0x52, 0x00, 0xc2, 0x04, 0x04, 0x00, 0xae, 0x07, 0x30, 0x00, 0xae, 0x05, 0xe8, 0x00, 0xae,
+  0x06, 0x3c, 0x00, 0x5c, 0x04, 0xc6, 0x00, 0xc2, 0x06, 0x3c, 0x00, 0x5c, 0x05, 0x08, 0x00, 0xc2, 0x04, 0x24, 0x00, 0x3a, 0x04, 0x9c, 0x00, 0x1c,
+  0x05, 0xb4, 0x00, 0xa0, 0x05, 0x50, 0x00, 0x08, 0x07, 0xf6, 0x00, 0x0e, 0x05, 0x06, 0x00, 0x0e, 0x04, 0xea, 0x00, 0x08, 0x04, 0xe0, 0x00, 0x56,
+  0x02, 0x58, 0x00, 0x8e, 0x02, 0xee, 0xff, 0xec, 0x02, 0x58, 0x00, 0x5a, 0x04, 0x88, 0x00, 0x9e, 0x03, 0x14, 0x00, 0x00, 0x02, 0x66, 0x00, 0x26,
+  0x03, 0xf6, 0x00, 0x5c, 0x04, 0x5e, 0x00, 0x98, 0x03, 0xa6, 0x00, 0x4a, 0x04, 0x5e, 0x00, 0x48, 0x04, 0x18, 0x00, 0x4a, 0x02, 0xa2, 0x00, 0x1a,
+  0x03, 0xfe, 0x00, 0x32, 0x04, 0x58, 0x00, 0x92, 0x02, 0x00, 0x00, 0x82, 0x01, 0xfc, 0xff, 0xc8, 0x04, 0x18, 0x00, 0x98, 0x02, 0x00, 0x00, 0xa6,
+  0x06, 0x6a, 0x00, 0x92, 0x04, 0x58, 0x00, 0x92, 0x04, 0x58, 0x00, 0x48, 0x04, 0x50, 0x00, 0x92, 0x04, 0x5e, 0x00, 0x48, 0x03, 0x26, 0x00, 0x92,
+  0x03, 0x64, 0x00, 0x3e, 0x02, 0xea, 0x00, 0x2c, 0x04, 0x58, 0x00, 0x7a, 0x04, 0x00, 0x00, 0x12, 0x05, 0xfc, 0x00, 0x0e, 0x03, 0xf0, 0x00, 0x1c,
+  0x04, 0x00, 0x00, 0x0e, 0x03, 0x9c, 0x00, 0x46, 0x02, 0x58, 0x00, 0x2c, 0x02, 0x58, 0x00, 0xe6, 0x02, 0x58, 0x00, 0x58, 0x04, 0x88, 0x00, 0x74,
+  0x01, 0x82, 0x00, 0x00, 0x02, 0xae, 0x00, 0xda, 0x04, 0x88, 0x00, 0x8a, 0x04, 0x88, 0x00, 0x34, 0x04, 0x88, 0x00, 0x84, 0x04, 0x88, 0x00, 0x2c,
+  0x02, 0x58, 0x00, 0xe6, 0x03, 0xee, 0x00, 0x72, 0x02, 0x66, 0x00, 0x0e, 0x06, 0x3c, 0x00, 0x44, 0x02, 0xac, 0x00, 0x5c, 0x03, 0x9e, 0x00, 0x8a,
+  0x04, 0x88, 0x00, 0x94, 0x02, 0xb6, 0x00, 0x64, 0x06, 0x3c, 0x00, 0x44, 0x02, 0x66, 0x00, 0x14, 0x03, 0x1a, 0x00, 0x46, 0x04, 0x88, 0x00, 0x64,
+  0x02, 0x98, 0x00, 0x52, 0x02, 0x98, 0x00, 0x54, 0x02, 0x66, 0x00, 0xc4, 0x04, 0x58, 0x00, 0x7a, 0x05, 0x3a, 0x00, 0x2a, 0x02, 0x22, 0x00, 0x7c,
+  0x02, 0x66, 0x00, 0x84, 0x02, 0x98, 0x00, 0x78, 0x02, 0xfa, 0x00, 0x48, 0x03, 0x9e, 0x00, 0x96, 0x05, 0x90, 0x00, 0x66, 0x05, 0x90, 0x00, 0x66,
+  0x05, 0x92, 0x00, 0x44, 0x03, 0x1c, 0x00, 0x2c, 0x05, 0x50, 0x00, 0x0a, 0x05, 0x50, 0x00, 0x0a, 0x05, 0x50, 0x00, 0x0a, 0x05, 0x50, 0x00, 0x0a,
+  0x05, 0x50, 0x00, 0x0a, 0x05, 0x50, 0x00, 0x0a, 0x07, 0x42, 0xff, 0xe8, 0x05, 0x5a, 0x00, 0x5a, 0x04, 0x8a, 0x00, 0xae, 0x04, 0x8a, 0x00, 0xae,
+  0x04, 0x8a, 0x00, 0xae, 0x04, 0x8a, 0x00, 0xae, 0x02, 0x66, 0xff, 0xcc, 0x02, 0x66, 0x00, 0x9a, 0x02, 0x66, 0xff, 0xef, 0x02, 0x66, 0xff, 0xf2,
+  0x06, 0x2a, 0x00, 0x32, 0x05, 0xe8, 0x00, 0xae, 0x06, 0x3c, 0x00, 0x5c, 0x06, 0x3c, 0x00, 0x5c, 0x06, 0x3c, 0x00, 0x5c, 0x06, 0x3c, 0x00, 0x5c,
+  0x06, 0x3c, 0x00, 0x5c, 0x04, 0x88, 0x00, 0x7e, 0x06, 0x3c, 0x00, 0x5c, 0x05, 0xb4, 0x00, 0xa0, 0x05, 0xb4, 0x00, 0xa0, 0x05, 0xb4, 0x00, 0xa0,
+  0x05, 0xb4, 0x00, 0xa0, 0x04, 0xea, 0x00, 0x08, 0x04, 0xc6, 0x00, 0xc2, 0x04, 0xc2, 0x00, 0xba, 0x03, 0xf6, 0x00, 0x5c, 0x03, 0xf6, 0x00, 0x5c,
+  0x03, 0xf6, 0x00, 0x5c, 0x03, 0xf6, 0x00, 0x5c, 0x03, 0xf6, 0x00, 0x5c, 0x03, 0xf6, 0x00, 0x5c, 0x06, 0x60, 0x00, 0x5c, 0x03, 0xa6, 0x00, 0x4a,
+  0x04, 0x18, 0x00, 0x4a, 0x04, 0x18, 0x00, 0x4a, 0x04, 0x18, 0x00, 0x4a, 0x04, 0x18, 0x00, 0x4a, 0x02, 0x00, 0xff, 0xf9, 0x02, 0x00, 0x00, 0x97,
+  0x02, 0x00, 0xff, 0xd2, 0x02, 0x00, 0xff, 0xe1, 0x04, 0x52, 0x00, 0x4c, 0x04, 0x58, 0x00, 0x92, 0x04, 0x58, 0x00, 0x48, 0x04, 0x58, 0x00, 0x48,
+  0x04, 0x58, 0x00, 0x48, 0x04, 0x58, 0x00, 0x48, 0x04, 0x58, 0x00, 0x48, 0x04, 0x88, 0x00, 0x64, 0x04, 0x58, 0x00, 0x40, 0x04, 0x58, 0x00, 0x7a,
+  0x04, 0x58, 0x00, 0x7a, 0x04, 0x58, 0x00, 0x7a, 0x04, 0x58, 0x00, 0x7a, 0x04, 0x00, 0x00, 0x0e, 0x04, 0x50, 0x00, 0x92, 0x04, 0x00, 0x00, 0x0e,
+  0x02, 0x00, 0x00, 0xa6, 0x02, 0x66, 0x00, 0x00, 0x02, 0x66, 0x00, 0x6a, 0x02, 0x66, 0x00, 0x12, 0x04, 0x58, 0x00, 0x9c, 0x06, 0x6a, 0x00, 0x9c,
+  0x01, 0xa8, 0x00, 0x3a, 0x01, 0xa8, 0x00, 0x5a, 0x02, 0xd8, 0x00, 0x3a, 0x02, 0xd8, 0x00, 0x5a, 0x04, 0x88, 0x00, 0xd0, 0x05, 0xae, 0x00, 0x58,
+  0x02, 0x66, 0xff, 0xd4, 0x02, 0x66, 0xff, 0xf0, 0x02, 0x66, 0x00, 0xa2, 0x02, 0x66, 0xff, 0xec, 0x02, 0x66, 0x00, 0x76, 0x02, 0x66, 0x00, 0x1a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x01, 0x24, 0x00, 0x00, 0x01, 0x74, 0x00, 0x00, 0x02, 0x3c,
+  0x00, 0x00, 0x03, 0x2c, 0x00, 0x00, 0x04, 0x2c, 0x00, 0x00, 0x05, 0x10, 0x00, 0x00, 0x05, 0x44, 0x00, 0x00, 0x05, 0xa8, 0x00, 0x00, 0x06, 0x0c,
+  0x00, 0x00, 0x06, 0xa8, 0x00, 0x00, 0x06, 0xdc, 0x00, 0x00, 0x07, 0x3c, 0x00, 0x00, 0x07, 0x5c, 0x00, 0x00, 0x07, 0xa0, 0x00, 0x00, 0x07, 0xcc,
+  0x00, 0x00, 0x08, 0x4c, 0x00, 0x00, 0x08, 0x94, 0x00, 0x00, 0x09, 0x30, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x58, 0x00, 0x00, 0x0a, 0xe4,
+  0x00, 0x00, 0x0b, 0x74, 0x00, 0x00, 0x0b, 0xbc, 0x00, 0x00, 0x0c, 0x84, 0x00, 0x00, 0x0d, 0x24, 0x00, 0x00, 0x0d, 0x9c, 0x00, 0x00, 0x0e, 0x2c,
+  0x00, 0x00, 0x0e, 0x78, 0x00, 0x00, 0x0e, 0xa0, 0x00, 0x00, 0x0e, 0xe8, 0x00, 0x00, 0x0f, 0x90, 0x00, 0x00, 0x10, 0xa0, 0x00, 0x00, 0x10, 0xf4,
+  0x00, 0x00, 0x11, 0x78, 0x00, 0x00, 0x12, 0x04, 0x00, 0x00, 0x12, 0x64, 0x00, 0x00, 0x12, 0x98, 0x00, 0x00, 0x12, 0xc4, 0x00, 0x00, 0x13, 0x60,
+  0x00, 0x00, 0x13, 0x90, 0x00, 0x00, 0x13, 0xac, 0x00, 0x00, 0x13, 0xfc, 0x00, 0x00, 0x14, 0x74, 0x00, 0x00, 0x14, 0x94, 0x00, 0x00, 0x15, 0x10,
+  0x00, 0x00, 0x15, 0x64, 0x00, 0x00, 0x15, 0xe8, 0x00, 0x00, 0x16, 0x3c, 0x00, 0x00, 0x16, 0xd8, 0x00, 0x00, 0x17, 0x4c, 0x00, 0x00, 0x17, 0xf4,
+  0x00, 0x00, 0x18, 0x1c, 0x00, 0x00, 0x18, 0x70, 0x00, 0x00, 0x18, 0xbc, 0x00, 0x00, 0x19, 0x4c, 0x00, 0x00, 0x19, 0xb8, 0x00, 0x00, 0x1a, 0x08,
+  0x00, 0x00, 0x1a, 0x40, 0x00, 0x00, 0x1a, 0x74, 0x00, 0x00, 0x1a, 0xa4, 0x00, 0x00, 0x1a, 0xd8, 0x00, 0x00, 0x1b, 0x20, 0x00, 0x00, 0x1b, 0x3c,
+  0x00, 0x00, 0x1b, 0x68, 0x00, 0x00, 0x1c, 0x0c, 0x00, 0x00, 0x1c, 0x80, 0x00, 0x00, 0x1c, 0xfc, 0x00, 0x00, 0x1d, 0x70, 0x00, 0x00, 0x1d, 0xf8,
+  0x00, 0x00, 0x1e, 0x54, 0x00, 0x00, 0x1f, 0x5c, 0x00, 0x00, 0x1f, 0xa4, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x00, 0x20, 0x74, 0x00, 0x00, 0x20, 0xe0,
+  0x00, 0x00, 0x20, 0xfc, 0x00, 0x00, 0x21, 0x78, 0x00, 0x00, 0x21, 0xc4, 0x00, 0x00, 0x22, 0x34, 0x00, 0x00, 0x22, 0xac, 0x00, 0x00, 0x23, 0x24,
+  0x00, 0x00, 0x23, 0x70, 0x00, 0x00, 0x24, 0x14, 0x00, 0x00, 0x24, 0x7c, 0x00, 0x00, 0x24, 0xcc, 0x00, 0x00, 0x25, 0x18, 0x00, 0x00, 0x25, 0xb4,
+  0x00, 0x00, 0x26, 0x20, 0x00, 0x00, 0x26, 0x7c, 0x00, 0x00, 0x26, 0xc0, 0x00, 0x00, 0x27, 0x6c, 0x00, 0x00, 0x27, 0x88, 0x00, 0x00, 0x28, 0x34,
+  0x00, 0x00, 0x28, 0x8c, 0x00, 0x00, 0x28, 0x8c, 0x00, 0x00, 0x28, 0xf8, 0x00, 0x00, 0x29, 0xa4, 0x00, 0x00, 0x2a, 0x54, 0x00, 0x00, 0x2b, 0x00,
+  0x00, 0x00, 0x2b, 0x78, 0x00, 0x00, 0x2b, 0xa0, 0x00, 0x00, 0x2c, 0x98, 0x00, 0x00, 0x2d, 0x10, 0x00, 0x00, 0x2e, 0x1c, 0x00, 0x00, 0x2e, 0xb8,
+  0x00, 0x00, 0x2f, 0x44, 0x00, 0x00, 0x2f, 0x68, 0x00, 0x00, 0x2f, 0x88, 0x00, 0x00, 0x30, 0x78, 0x00, 0x00, 0x30, 0x98, 0x00, 0x00, 0x31, 0x10,
+  0x00, 0x00, 0x31, 0x54, 0x00, 0x00, 0x31, 0xdc, 0x00, 0x00, 0x32, 0x8c, 0x00, 0x00, 0x32, 0xb8, 0x00, 0x00, 0x33, 0x1c, 0x00, 0x00, 0x33, 0x60,
+  0x00, 0x00, 0x33, 0xa4, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x3c, 0x00, 0x00, 0x34, 0xa0, 0x00, 0x00, 0x35, 0x20, 0x00, 0x00, 0x35, 0xc0,
+  0x00, 0x00, 0x36, 0x94, 0x00, 0x00, 0x37, 0xa4, 0x00, 0x00, 0x38, 0x50, 0x00, 0x00, 0x38, 0x68, 0x00, 0x00, 0x38, 0x80, 0x00, 0x00, 0x38, 0x98,
+  0x00, 0x00, 0x38, 0xb0, 0x00, 0x00, 0x38, 0xc8, 0x00, 0x00, 0x38, 0xe0, 0x00, 0x00, 0x39, 0x44, 0x00, 0x00, 0x3a, 0x1c, 0x00, 0x00, 0x3a, 0x34,
+  0x00, 0x00, 0x3a, 0x4c, 0x00, 0x00, 0x3a, 0x64, 0x00, 0x00, 0x3a, 0x7c, 0x00, 0x00, 0x3a, 0x94, 0x00, 0x00, 0x3a, 0xac, 0x00, 0x00, 0x3a, 0xc4,
+  0x00, 0x00, 0x3a, 0xdc, 0x00, 0x00, 0x3b, 0x4c, 0x00, 0x00, 0x3b, 0x64, 0x00, 0x00, 0x3b, 0x7c, 0x00, 0x00, 0x3b, 0x94, 0x00, 0x00, 0x3b, 0xac,
+  0x00, 0x00, 0x3b, 0xc4, 0x00, 0x00, 0x3b, 0xdc, 0x00, 0x00, 0x3c, 0x24, 0x00, 0x00, 0x3c, 0xe0, 0x00, 0x00, 0x3c, 0xf8, 0x00, 0x00, 0x3d, 0x10,
+  0x00, 0x00, 0x3d, 0x28, 0x00, 0x00, 0x3d, 0x40, 0x00, 0x00, 0x3d, 0x58, 0x00, 0x00, 0x3d, 0xb0, 0x00, 0x00, 0x3e, 0x74, 0x00, 0x00, 0x3e, 0x8c,
+  0x00, 0x00, 0x3e, 0xa4, 0x00, 0x00, 0x3e, 0xbc, 0x00, 0x00, 0x3e, 0xd4, 0x00, 0x00, 0x3e, 0xec, 0x00, 0x00, 0x3f, 0x04, 0x00, 0x00, 0x40, 0x08,
+  0x00, 0x00, 0x40, 0xd4, 0x00, 0x00, 0x40, 0xec, 0x00, 0x00, 0x41, 0x04, 0x00, 0x00, 0x41, 0x1c, 0x00, 0x00, 0x41, 0x34, 0x00, 0x00, 0x41, 0x4c,
+  0x00, 0x00, 0x41, 0x64, 0x00, 0x00, 0x41, 0x7c, 0x00, 0x00, 0x41, 0x94, 0x00, 0x00, 0x42, 0x68, 0x00, 0x00, 0x42, 0x80, 0x00, 0x00, 0x42, 0x98,
+  0x00, 0x00, 0x42, 0xb0, 0x00, 0x00, 0x42, 0xc8, 0x00, 0x00, 0x42, 0xe0, 0x00, 0x00, 0x42, 0xf8, 0x00, 0x00, 0x43, 0x80, 0x00, 0x00, 0x44, 0x28,
+  0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x44, 0x58, 0x00, 0x00, 0x44, 0x70, 0x00, 0x00, 0x44, 0x88, 0x00, 0x00, 0x44, 0xa0, 0x00, 0x00, 0x45, 0x14,
+  0x00, 0x00, 0x45, 0x2c, 0x00, 0x00, 0x45, 0x48, 0x00, 0x00, 0x45, 0x80, 0x00, 0x00, 0x45, 0xe0, 0x00, 0x00, 0x46, 0x34, 0x00, 0x00, 0x46, 0x54,
+  0x00, 0x00, 0x46, 0x74, 0x00, 0x00, 0x46, 0xc8, 0x00, 0x00, 0x47, 0x1c, 0x00, 0x00, 0x47, 0xb0, 0x00, 0x00, 0x48, 0x48, 0x00, 0x00, 0x48, 0x88,
+  0x00, 0x00, 0x49, 0x34, 0x00, 0x00, 0x49, 0x64, 0x00, 0x00, 0x49, 0xd8, 0x00, 0x00, 0x4a, 0x0c, 0x00, 0x00, 0x4a, 0x4c, 0x00, 0x00, 0x4a, 0xac,
+  0x00, 0x00, 0x4b, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x82, 0x00, 0x07, 0x00, 0x62, 0x00, 0x04, 0x00, 0x02, 0x00, 0x22, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1e, 0x01, 0x6e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x8a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x07, 0x00, 0x8e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2a, 0x00, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x0c, 0x00, 0xbf, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x28, 0x00, 0xcb, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0x00, 0x0c, 0x00, 0xf3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x30, 0x00, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x00, 0x18, 0x01, 0x2f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0f, 0x01, 0x47, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0a, 0x02, 0xdc, 0x01, 0x56, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x18, 0x04, 0x32, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0c, 0x00, 0x32, 0x04, 0x4a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0xc2, 0x04, 0x7c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0e, 0x00, 0x1a, 0x05, 0x3e, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x00, 0x01, 0x14, 0x05, 0x58, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+  0x00, 0x01, 0x00, 0x08, 0x06, 0x6c, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00, 0x0e, 0x06, 0x74, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+  0x00, 0x03, 0x00, 0x54, 0x06, 0x82, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x04, 0x00, 0x18, 0x06, 0xd6, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+  0x00, 0x05, 0x00, 0x50, 0x06, 0xee, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x18, 0x06, 0xd6, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+  0x00, 0x07, 0x00, 0x60, 0x07, 0x3e, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x08, 0x00, 0x30, 0x07, 0x9e, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+  0x00, 0x09, 0x00, 0x1e, 0x07, 0xce, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0a, 0x05, 0xb8, 0x07, 0xec, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+  0x00, 0x0b, 0x00, 0x30, 0x0d, 0xa4, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0c, 0x00, 0x64, 0x0d, 0xd4, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+  0x00, 0x0d, 0x01, 0x84, 0x0e, 0x38, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0e, 0x00, 0x34, 0x0f, 0xbc, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69,
+  0x67, 0x68, 0x74, 0x20, 0x28, 0x63, 0x29, 0x20, 0x32, 0x30, 0x31, 0x30, 0x2d, 0x32, 0x30, 0x31, 0x33, 0x20, 0x62, 0x79, 0x20, 0x74, 0x79, 0x50,
+  0x6f, 0x6c, 0x61, 0x6e, 0x64, 0x20, 0x4c, 0x75, 0x6b, 0x61, 0x73, 0x7a, 0x20, 0x44, 0x7a, 0x69, 0x65, 0x64, 0x7a, 0x69, 0x63, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x52, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x4e, 0x61, 0x6d, 0x65, 0x20, 0x22, 0x4c,
+  0x61, 0x74, 0x6f, 0x22, 0x2e, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x53, 0x49, 0x4c, 0x20, 0x4f, 0x70, 0x65, 0x6e, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20,
+  0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x2e, 0x31, 0x2e, 0x4c, 0x61, 0x74, 0x6f, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x74,
+  0x79, 0x50, 0x6f, 0x6c, 0x61, 0x6e, 0x64, 0x4c, 0x75, 0x6b, 0x61, 0x73, 0x7a, 0x44, 0x7a, 0x69, 0x65, 0x64, 0x7a, 0x69, 0x63, 0x3a, 0x20, 0x4c,
+  0x61, 0x74, 0x6f, 0x20, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x3a, 0x20, 0x32, 0x30, 0x31, 0x33, 0x4c, 0x61, 0x74, 0x6f, 0x20, 0x52, 0x65,
+  0x67, 0x75, 0x6c, 0x61, 0x72, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x2e, 0x31, 0x30, 0x35, 0x3b, 0x20, 0x57, 0x65, 0x73, 0x74,
+  0x65, 0x72, 0x6e, 0x2b, 0x50, 0x6f, 0x6c, 0x69, 0x73, 0x68, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x4c, 0x61, 0x74,
+  0x6f, 0x2d, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x4c, 0x61, 0x74, 0x6f, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65,
+  0x6d, 0x61, 0x72, 0x6b, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x79, 0x50, 0x6f, 0x6c, 0x61, 0x6e, 0x64, 0x20, 0x4c, 0x75, 0x6b, 0x61, 0x73, 0x7a, 0x20,
+  0x44, 0x7a, 0x69, 0x65, 0x64, 0x7a, 0x69, 0x63, 0x2e, 0x74, 0x79, 0x50, 0x6f, 0x6c, 0x61, 0x6e, 0x64, 0x20, 0x4c, 0x75, 0x6b, 0x61, 0x73, 0x7a,
+  0x20, 0x44, 0x7a, 0x69, 0x65, 0x64, 0x7a, 0x69, 0x63, 0x4c, 0x75, 0x6b, 0x61, 0x73, 0x7a, 0x20, 0x44, 0x7a, 0x69, 0x65, 0x64, 0x7a, 0x69, 0x63,
+  0x4c, 0x61, 0x74, 0x6f, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x61, 0x6e, 0x73, 0x65, 0x72, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x66,
+  0x61, 0x63, 0x65, 0x20, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x20, 0x64, 0x65, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x53, 0x75, 0x6d, 0x6d, 0x65, 0x72, 0x20, 0x32, 0x30, 0x31, 0x30, 0x20, 0x62, 0x79, 0x20, 0x57, 0x61, 0x72, 0x73, 0x61, 0x77,
+  0x2d, 0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x64, 0x65, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x72, 0x20, 0x4c, 0x75, 0x6b, 0x61, 0x73, 0x7a, 0x20, 0x44,
+  0x7a, 0x69, 0x65, 0x64, 0x7a, 0x69, 0x63, 0x20, 0x28, 0x22, 0x4c, 0x61, 0x74, 0x6f, 0x22, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x22, 0x53,
+  0x75, 0x6d, 0x6d, 0x65, 0x72, 0x22, 0x20, 0x69, 0x6e, 0x20, 0x50, 0x6f, 0x6c, 0x69, 0x73, 0x68, 0x29, 0x2e, 0x20, 0x49, 0x74, 0x20, 0x74, 0x72,
+  0x69, 0x65, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x61, 0x72, 0x65, 0x66, 0x75, 0x6c, 0x6c, 0x79, 0x20, 0x62, 0x61, 0x6c, 0x61, 0x6e, 0x63, 0x65,
+  0x20, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x70, 0x6f, 0x74, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x6c, 0x69,
+  0x63, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x70, 0x72, 0x69, 0x6f, 0x72, 0x69, 0x74, 0x69, 0x65, 0x73, 0x3a, 0x20, 0x69, 0x74, 0x20, 0x73, 0x68, 0x6f,
+  0x75, 0x6c, 0x64, 0x20, 0x73, 0x65, 0x65, 0x6d, 0x20, 0x71, 0x75, 0x69, 0x74, 0x65, 0x20, 0x22, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x61, 0x72,
+  0x65, 0x6e, 0x74, 0x22, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x74,
+  0x65, 0x78, 0x74, 0x20, 0x62, 0x75, 0x74, 0x20, 0x77, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x20, 0x73, 0x6f,
+  0x6d, 0x65, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x74, 0x72, 0x61, 0x69, 0x74, 0x73, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20,
+  0x75, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x6c, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x2e, 0x20, 0x54, 0x68,
+  0x65, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x70, 0x72, 0x6f, 0x70, 0x6f, 0x72, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c,
+  0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x75, 0x6c, 0x61, 0x72, 0x6c, 0x79, 0x20, 0x76, 0x69, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x20, 0x69, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x70, 0x70, 0x65, 0x72, 0x63, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x67, 0x69, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x66, 0x6f, 0x72, 0x6d, 0x73, 0x20, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x69, 0x61, 0x72, 0x20, 0x68, 0x61,
+  0x72, 0x6d, 0x6f, 0x6e, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x65, 0x6c, 0x65, 0x67, 0x61, 0x6e, 0x63, 0x65, 0x2e, 0x20, 0x41, 0x74, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x2c, 0x20, 0x69, 0x74, 0x73, 0x20, 0x73, 0x6c, 0x65, 0x65, 0x6b, 0x20,
+  0x73, 0x61, 0x6e, 0x73, 0x65, 0x72, 0x69, 0x66, 0x20, 0x6c, 0x6f, 0x6f, 0x6b, 0x20, 0x6d, 0x61, 0x6b, 0x65, 0x73, 0x20, 0x65, 0x76, 0x69, 0x64,
+  0x65, 0x6e, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x63, 0x74, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x4c, 0x61, 0x74, 0x6f, 0x20, 0x77,
+  0x61, 0x73, 0x20, 0x64, 0x65, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x32, 0x30, 0x31, 0x30, 0x2c, 0x20, 0x65, 0x76, 0x65,
+  0x6e, 0x20, 0x74, 0x68, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x69, 0x74, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x66, 0x6f, 0x6c,
+  0x6c, 0x6f, 0x77, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x74, 0x72, 0x65, 0x6e, 0x64, 0x2e, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x73, 0x65, 0x6d, 0x69, 0x2d, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x64, 0x65, 0x74, 0x61, 0x69, 0x6c, 0x73, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x73, 0x20, 0x67, 0x69, 0x76, 0x65, 0x20, 0x4c, 0x61, 0x74, 0x6f,
+  0x20, 0x61, 0x20, 0x66, 0x65, 0x65, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x66, 0x20, 0x77, 0x61, 0x72, 0x6d, 0x74, 0x68, 0x2c, 0x20, 0x77, 0x68,
+  0x69, 0x6c, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+  0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x73, 0x20, 0x73, 0x74, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x73, 0x65, 0x72, 0x69, 0x6f, 0x75, 0x73, 0x6e, 0x65, 0x73, 0x73, 0x2e, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x74,
+  0x79, 0x70, 0x6f, 0x6c, 0x61, 0x6e, 0x64, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x74,
+  0x79, 0x70, 0x6f, 0x6c, 0x61, 0x6e, 0x64, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x64, 0x65, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x72, 0x73, 0x2f, 0x4c, 0x75,
+  0x6b, 0x61, 0x73, 0x7a, 0x5f, 0x44, 0x7a, 0x69, 0x65, 0x64, 0x7a, 0x69, 0x63, 0x2f, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20,
+  0x28, 0x63, 0x29, 0x20, 0x32, 0x30, 0x31, 0x30, 0x2d, 0x32, 0x30, 0x31, 0x33, 0x20, 0x62, 0x79, 0x20, 0x74, 0x79, 0x50, 0x6f, 0x6c, 0x61, 0x6e,
+  0x64, 0x20, 0x4c, 0x75, 0x6b, 0x61, 0x73, 0x7a, 0x20, 0x44, 0x7a, 0x69, 0x65, 0x64, 0x7a, 0x69, 0x63, 0x20, 0x28, 0x68, 0x74, 0x74, 0x70, 0x3a,
+  0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x74, 0x79, 0x70, 0x6f, 0x6c, 0x61, 0x6e, 0x64, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x29, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x20, 0x52, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x4e, 0x61, 0x6d, 0x65, 0x20, 0x22, 0x4c, 0x61,
+  0x74, 0x6f, 0x22, 0x2e, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x53, 0x49, 0x4c, 0x20, 0x4f, 0x70, 0x65, 0x6e, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x56,
+  0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x28, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x73, 0x2e, 0x73, 0x69, 0x6c, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x4f, 0x46, 0x4c, 0x29, 0x2e, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x73, 0x2e, 0x73, 0x69, 0x6c, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x4f, 0x46, 0x4c, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x70,
+  0x00, 0x79, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x28, 0x00, 0x63, 0x00, 0x29, 0x00, 0x20, 0x00, 0x32,
+  0x00, 0x30, 0x00, 0x31, 0x00, 0x30, 0x00, 0x2d, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x33, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20,
+  0x00, 0x74, 0x00, 0x79, 0x00, 0x50, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x75, 0x00, 0x6b,
+  0x00, 0x61, 0x00, 0x73, 0x00, 0x7a, 0x00, 0x20, 0x00, 0x44, 0x00, 0x7a, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00, 0x7a, 0x00, 0x69, 0x00, 0x63,
+  0x00, 0x20, 0x00, 0x77, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x20, 0x00, 0x52, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x76,
+  0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x4e, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x65,
+  0x00, 0x20, 0x00, 0x22, 0x00, 0x4c, 0x00, 0x61, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x63,
+  0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20,
+  0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x53, 0x00, 0x49, 0x00, 0x4c, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x70, 0x00, 0x65, 0x00, 0x6e,
+  0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73,
+  0x00, 0x65, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x31,
+  0x00, 0x2e, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x4c, 0x00, 0x61, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c,
+  0x00, 0x61, 0x00, 0x72, 0x00, 0x74, 0x00, 0x79, 0x00, 0x50, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x4c, 0x00, 0x75,
+  0x00, 0x6b, 0x00, 0x61, 0x00, 0x73, 0x00, 0x7a, 0x00, 0x44, 0x00, 0x7a, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00, 0x7a, 0x00, 0x69, 0x00, 0x63,
+  0x00, 0x3a, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x61, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c,
+  0x00, 0x61, 0x00, 0x72, 0x00, 0x3a, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x33, 0x00, 0x4c, 0x00, 0x61, 0x00, 0x74, 0x00, 0x6f,
+  0x00, 0x2d, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73,
+  0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x31, 0x00, 0x30, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x20, 0x00, 0x57,
+  0x00, 0x65, 0x00, 0x73, 0x00, 0x74, 0x00, 0x65, 0x00, 0x72, 0x00, 0x6e, 0x00, 0x2b, 0x00, 0x50, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x73,
+  0x00, 0x68, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x75, 0x00, 0x72, 0x00, 0x63, 0x00, 0x65,
+  0x00, 0x4c, 0x00, 0x61, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x20, 0x00, 0x74, 0x00, 0x72,
+  0x00, 0x61, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x72, 0x00, 0x6b, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x74,
+  0x00, 0x79, 0x00, 0x50, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x75, 0x00, 0x6b, 0x00, 0x61,
+  0x00, 0x73, 0x00, 0x7a, 0x00, 0x20, 0x00, 0x44, 0x00, 0x7a, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00, 0x7a, 0x00, 0x69, 0x00, 0x63, 0x00, 0x2e,
+  0x00, 0x74, 0x00, 0x79, 0x00, 0x50, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x75, 0x00, 0x6b,
+  0x00, 0x61, 0x00, 0x73, 0x00, 0x7a, 0x00, 0x20, 0x00, 0x44, 0x00, 0x7a, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00, 0x7a, 0x00, 0x69, 0x00, 0x63,
+  0x00, 0x4c, 0x00, 0x75, 0x00, 0x6b, 0x00, 0x61, 0x00, 0x73, 0x00, 0x7a, 0x00, 0x20, 0x00, 0x44, 0x00, 0x7a, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64,
+  0x00, 0x7a, 0x00, 0x69, 0x00, 0x63, 0x00, 0x4c, 0x00, 0x61, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61,
+  0x00, 0x20, 0x00, 0x73, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x69, 0x00, 0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x79,
+  0x00, 0x70, 0x00, 0x65, 0x00, 0x66, 0x00, 0x61, 0x00, 0x63, 0x00, 0x65, 0x00, 0x20, 0x00, 0x66, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x69, 0x00, 0x6c,
+  0x00, 0x79, 0x00, 0x20, 0x00, 0x64, 0x00, 0x65, 0x00, 0x73, 0x00, 0x69, 0x00, 0x67, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x69,
+  0x00, 0x6e, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x53, 0x00, 0x75, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x72,
+  0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x30, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x57, 0x00, 0x61, 0x00, 0x72,
+  0x00, 0x73, 0x00, 0x61, 0x00, 0x77, 0x00, 0x2d, 0x00, 0x62, 0x00, 0x61, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x64, 0x00, 0x65,
+  0x00, 0x73, 0x00, 0x69, 0x00, 0x67, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x75, 0x00, 0x6b, 0x00, 0x61, 0x00, 0x73,
+  0x00, 0x7a, 0x00, 0x20, 0x00, 0x44, 0x00, 0x7a, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00, 0x7a, 0x00, 0x69, 0x00, 0x63, 0x00, 0x20, 0x00, 0x28,
+  0x00, 0x22, 0x00, 0x4c, 0x00, 0x61, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x22, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x73,
+  0x00, 0x20, 0x00, 0x22, 0x00, 0x53, 0x00, 0x75, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x72, 0x00, 0x22, 0x00, 0x20, 0x00, 0x69, 0x00, 0x6e,
+  0x00, 0x20, 0x00, 0x50, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x73, 0x00, 0x68, 0x00, 0x29, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x49, 0x00, 0x74,
+  0x00, 0x20, 0x00, 0x74, 0x00, 0x72, 0x00, 0x69, 0x00, 0x65, 0x00, 0x73, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x63, 0x00, 0x61,
+  0x00, 0x72, 0x00, 0x65, 0x00, 0x66, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x20, 0x00, 0x62, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x61,
+  0x00, 0x6e, 0x00, 0x63, 0x00, 0x65, 0x00, 0x20, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x20, 0x00, 0x70, 0x00, 0x6f, 0x00, 0x74,
+  0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x69, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6e,
+  0x00, 0x66, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x70, 0x00, 0x72, 0x00, 0x69,
+  0x00, 0x6f, 0x00, 0x72, 0x00, 0x69, 0x00, 0x74, 0x00, 0x69, 0x00, 0x65, 0x00, 0x73, 0x00, 0x3a, 0x00, 0x20, 0x00, 0x69, 0x00, 0x74, 0x00, 0x20,
+  0x00, 0x73, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x20, 0x00, 0x73, 0x00, 0x65, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x20,
+  0x00, 0x71, 0x00, 0x75, 0x00, 0x69, 0x00, 0x74, 0x00, 0x65, 0x00, 0x20, 0x00, 0x22, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x73,
+  0x00, 0x70, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x22, 0x00, 0x20, 0x00, 0x77, 0x00, 0x68, 0x00, 0x65, 0x00, 0x6e,
+  0x00, 0x20, 0x00, 0x75, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x64,
+  0x00, 0x79, 0x00, 0x20, 0x00, 0x74, 0x00, 0x65, 0x00, 0x78, 0x00, 0x74, 0x00, 0x20, 0x00, 0x62, 0x00, 0x75, 0x00, 0x74, 0x00, 0x20, 0x00, 0x77,
+  0x00, 0x6f, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x20, 0x00, 0x64, 0x00, 0x69, 0x00, 0x73, 0x00, 0x70, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x79,
+  0x00, 0x20, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x69, 0x00, 0x6e,
+  0x00, 0x61, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x69, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x77, 0x00, 0x68,
+  0x00, 0x65, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x75, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x6c,
+  0x00, 0x61, 0x00, 0x72, 0x00, 0x67, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x73, 0x00, 0x69, 0x00, 0x7a, 0x00, 0x65, 0x00, 0x73, 0x00, 0x2e,
+  0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x73, 0x00, 0x73, 0x00, 0x69, 0x00, 0x63,
+  0x00, 0x61, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x70, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6f,
+  0x00, 0x6e, 0x00, 0x73, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x70, 0x00, 0x61, 0x00, 0x72, 0x00, 0x74, 0x00, 0x69, 0x00, 0x63, 0x00, 0x75, 0x00, 0x6c,
+  0x00, 0x61, 0x00, 0x72, 0x00, 0x6c, 0x00, 0x79, 0x00, 0x20, 0x00, 0x76, 0x00, 0x69, 0x00, 0x73, 0x00, 0x69, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x65,
+  0x00, 0x20, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x75, 0x00, 0x70, 0x00, 0x70, 0x00, 0x65,
+  0x00, 0x72, 0x00, 0x63, 0x00, 0x61, 0x00, 0x73, 0x00, 0x65, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x67, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x20,
+  0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x74, 0x00, 0x74, 0x00, 0x65, 0x00, 0x72, 0x00, 0x66, 0x00, 0x6f,
+  0x00, 0x72, 0x00, 0x6d, 0x00, 0x73, 0x00, 0x20, 0x00, 0x66, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x69, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x61, 0x00, 0x72,
+  0x00, 0x20, 0x00, 0x68, 0x00, 0x61, 0x00, 0x72, 0x00, 0x6d, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64,
+  0x00, 0x20, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x67, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x63, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x41,
+  0x00, 0x74, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x73, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x20, 0x00, 0x74,
+  0x00, 0x69, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x69, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x73, 0x00, 0x6c, 0x00, 0x65,
+  0x00, 0x65, 0x00, 0x6b, 0x00, 0x20, 0x00, 0x73, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x69, 0x00, 0x66, 0x00, 0x20,
+  0x00, 0x6c, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x6b, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x65, 0x00, 0x73, 0x00, 0x20, 0x00, 0x65,
+  0x00, 0x76, 0x00, 0x69, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x66,
+  0x00, 0x61, 0x00, 0x63, 0x00, 0x74, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x61, 0x00, 0x74, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x61, 0x00, 0x74,
+  0x00, 0x6f, 0x00, 0x20, 0x00, 0x77, 0x00, 0x61, 0x00, 0x73, 0x00, 0x20, 0x00, 0x64, 0x00, 0x65, 0x00, 0x73, 0x00, 0x69, 0x00, 0x67, 0x00, 0x6e,
+  0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x30, 0x00, 0x2c, 0x00, 0x20,
+  0x00, 0x65, 0x00, 0x76, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x75, 0x00, 0x67, 0x00, 0x68, 0x00, 0x20,
+  0x00, 0x69, 0x00, 0x74, 0x00, 0x20, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x65, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x20,
+  0x00, 0x66, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x6f, 0x00, 0x77, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x20, 0x00, 0x63,
+  0x00, 0x75, 0x00, 0x72, 0x00, 0x72, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x74, 0x00, 0x72, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x64,
+  0x00, 0x2e, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x73, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x69, 0x00, 0x2d, 0x00, 0x72,
+  0x00, 0x6f, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x64, 0x00, 0x65, 0x00, 0x74, 0x00, 0x61, 0x00, 0x69,
+  0x00, 0x6c, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x65,
+  0x00, 0x74, 0x00, 0x74, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x20, 0x00, 0x67, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x20, 0x00, 0x4c,
+  0x00, 0x61, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x61, 0x00, 0x20, 0x00, 0x66, 0x00, 0x65, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x6e,
+  0x00, 0x67, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x6d, 0x00, 0x74, 0x00, 0x68, 0x00, 0x2c,
+  0x00, 0x20, 0x00, 0x77, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x73,
+  0x00, 0x74, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00, 0x75, 0x00, 0x63, 0x00, 0x74,
+  0x00, 0x75, 0x00, 0x72, 0x00, 0x65, 0x00, 0x20, 0x00, 0x70, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x76, 0x00, 0x69, 0x00, 0x64, 0x00, 0x65, 0x00, 0x73,
+  0x00, 0x20, 0x00, 0x73, 0x00, 0x74, 0x00, 0x61, 0x00, 0x62, 0x00, 0x69, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x74, 0x00, 0x79, 0x00, 0x20, 0x00, 0x61,
+  0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x75, 0x00, 0x73, 0x00, 0x6e, 0x00, 0x65,
+  0x00, 0x73, 0x00, 0x73, 0x00, 0x2e, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x77, 0x00, 0x77,
+  0x00, 0x77, 0x00, 0x2e, 0x00, 0x74, 0x00, 0x79, 0x00, 0x70, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x2e, 0x00, 0x63,
+  0x00, 0x6f, 0x00, 0x6d, 0x00, 0x2f, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x77, 0x00, 0x77,
+  0x00, 0x77, 0x00, 0x2e, 0x00, 0x74, 0x00, 0x79, 0x00, 0x70, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x2e, 0x00, 0x63,
+  0x00, 0x6f, 0x00, 0x6d, 0x00, 0x2f, 0x00, 0x64, 0x00, 0x65, 0x00, 0x73, 0x00, 0x69, 0x00, 0x67, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73,
+  0x00, 0x2f, 0x00, 0x4c, 0x00, 0x75, 0x00, 0x6b, 0x00, 0x61, 0x00, 0x73, 0x00, 0x7a, 0x00, 0x5f, 0x00, 0x44, 0x00, 0x7a, 0x00, 0x69, 0x00, 0x65,
+  0x00, 0x64, 0x00, 0x7a, 0x00, 0x69, 0x00, 0x63, 0x00, 0x2f, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67,
+  0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x28, 0x00, 0x63, 0x00, 0x29, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x30, 0x00, 0x2d,
+  0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x33, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x74, 0x00, 0x79, 0x00, 0x50, 0x00, 0x6f,
+  0x00, 0x6c, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x75, 0x00, 0x6b, 0x00, 0x61, 0x00, 0x73, 0x00, 0x7a, 0x00, 0x20,
+  0x00, 0x44, 0x00, 0x7a, 0x00, 0x69, 0x00, 0x65, 0x00, 0x64, 0x00, 0x7a, 0x00, 0x69, 0x00, 0x63, 0x00, 0x20, 0x00, 0x28, 0x00, 0x68, 0x00, 0x74,
+  0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x2e, 0x00, 0x74, 0x00, 0x79, 0x00, 0x70,
+  0x00, 0x6f, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x2e, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x2f, 0x00, 0x29, 0x00, 0x20,
+  0x00, 0x77, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x20, 0x00, 0x52, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x76, 0x00, 0x65,
+  0x00, 0x64, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x4e, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x20,
+  0x00, 0x22, 0x00, 0x4c, 0x00, 0x61, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65,
+  0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x74,
+  0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x53, 0x00, 0x49, 0x00, 0x4c, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x70, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x20,
+  0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65,
+  0x00, 0x2c, 0x00, 0x20, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2e,
+  0x00, 0x31, 0x00, 0x20, 0x00, 0x28, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x73, 0x00, 0x63,
+  0x00, 0x72, 0x00, 0x69, 0x00, 0x70, 0x00, 0x74, 0x00, 0x73, 0x00, 0x2e, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6c, 0x00, 0x2e, 0x00, 0x6f, 0x00, 0x72,
+  0x00, 0x67, 0x00, 0x2f, 0x00, 0x4f, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x29, 0x00, 0x2e, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a,
+  0x00, 0x2f, 0x00, 0x2f, 0x00, 0x73, 0x00, 0x63, 0x00, 0x72, 0x00, 0x69, 0x00, 0x70, 0x00, 0x74, 0x00, 0x73, 0x00, 0x2e, 0x00, 0x73, 0x00, 0x69,
+  0x00, 0x6c, 0x00, 0x2e, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x67, 0x00, 0x2f, 0x00, 0x4f, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x74, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+};
+// clang-format on
+}
+
+namespace utils {
+FontData embedded_font() {
+    return {.family = "lottie_splash_embedded",
+            .data   = reinterpret_cast<const char *>(EMBEDDED_FONT_DATA),
+            .size   = sizeof(EMBEDDED_FONT_DATA)};
+}
+}
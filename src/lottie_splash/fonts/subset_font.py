@@ -0,0 +1,268 @@
+#!/usr/bin/env python3
+"""Generates embedded_font.cpp: a TrueType font subsetted to the characters a status line needs.
+
+Keeps only the tables thorvg's TTF loader reads, drops hinting and renumbers glyphs, so the result is a few KB.
+Usage: subset_font.py <input.ttf> <output.cpp>
+"""
+import struct
+import sys
+
+CODEPOINTS = (
+    list(range(0x20, 0x7F)) + list(range(0xA0, 0x100)) + [0x2013, 0x2014, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2026]
+)
+
+ARG_1_AND_2_ARE_WORDS = 0x0001
+WE_HAVE_A_SCALE = 0x0008
+MORE_COMPONENTS = 0x0020
+WE_HAVE_AN_X_AND_Y_SCALE = 0x0040
+WE_HAVE_A_TWO_BY_TWO = 0x0080
+WE_HAVE_INSTRUCTIONS = 0x0100
+
+
+def read_tables(font):
+    num_tables = struct.unpack_from(">H", font, 4)[0]
+    tables = {}
+    for i in range(num_tables):
+        tag, _, offset, length = struct.unpack_from(">4sIII", font, 12 + 16 * i)
+        tables[tag.decode("latin-1")] = font[offset:offset + length]
+    return tables
+
+
+def read_cmap(cmap):
+    num_subtables = struct.unpack_from(">H", cmap, 2)[0]
+    best = None
+    for i in range(num_subtables):
+        platform, encoding, offset = struct.unpack_from(">HHI", cmap, 4 + 8 * i)
+        fmt = struct.unpack_from(">H", cmap, offset)[0]
+        if (platform, encoding) in ((3, 10), (0, 4)) and fmt == 12:
+            best = (fmt, offset)
+            break
+        if (platform, encoding) in ((3, 1), (0, 3)) and fmt == 4:
+            best = (fmt, offset)
+
+    fmt, offset = best
+    mapping = {}
+    if fmt == 4:
+        seg_count = struct.unpack_from(">H", cmap, offset + 6)[0] // 2
+        ends = offset + 14
+        starts = ends + 2 * seg_count + 2
+        deltas = starts + 2 * seg_count
+        range_offsets = deltas + 2 * seg_count
+        for s in range(seg_count):
+            end = struct.unpack_from(">H", cmap, ends + 2 * s)[0]
+            start = struct.unpack_from(">H", cmap, starts + 2 * s)[0]
+            delta = struct.unpack_from(">h", cmap, deltas + 2 * s)[0]
+            range_offset = struct.unpack_from(">H", cmap, range_offsets + 2 * s)[0]
+            for c in range(start, end + 1):
+                if c == 0xFFFF:
+                    continue
+                if range_offset == 0:
+                    glyph = (c + delta) & 0xFFFF
+                else:
+                    at = range_offsets + 2 * s + range_offset + 2 * (c - start)
+                    glyph = struct.unpack_from(">H", cmap, at)[0]
+                    if glyph:
+                        glyph = (glyph + delta) & 0xFFFF
+                if glyph:
+                    mapping[c] = glyph
+    else:
+        num_groups = struct.unpack_from(">I", cmap, offset + 12)[0]
+        for g in range(num_groups):
+            start, end, glyph = struct.unpack_from(">III", cmap, offset + 16 + 12 * g)
+            for c in range(start, end + 1):
+                mapping[c] = glyph + c - start
+    return mapping
+
+
+def glyph_data(tables, glyph):
+    long_loca = struct.unpack_from(">h", tables["head"], 50)[0] == 1
+    if long_loca:
+        start, end = struct.unpack_from(">II", tables["loca"], 4 * glyph)
+    else:
+        start, end = (2 * v for v in struct.unpack_from(">HH", tables["loca"], 2 * glyph))
+    return tables["glyf"][start:end]
+
+
+def components(data):
+    """Yields (offset of glyph index, glyph index) for each component of a composite glyph, plus the flags end."""
+    at = 10
+    while True:
+        flags, glyph = struct.unpack_from(">HH", data, at)
+        yield at + 2, glyph, flags
+        at += 4 + (4 if flags & ARG_1_AND_2_ARE_WORDS else 2)
+        if flags & WE_HAVE_A_SCALE:
+            at += 2
+        elif flags & WE_HAVE_AN_X_AND_Y_SCALE:
+            at += 4
+        elif flags & WE_HAVE_A_TWO_BY_TWO:
+            at += 8
+        if not flags & MORE_COMPONENTS:
+            yield at, None, flags
+            return
+
+
+def strip_and_remap(data, remap):
+    if not data:
+        return b""
+    num_contours = struct.unpack_from(">h", data, 0)[0]
+    if num_contours >= 0:
+        instructions_at = 10 + 2 * num_contours
+        instruction_length = struct.unpack_from(">H", data, instructions_at)[0]
+        stripped = data[:instructions_at] + b"\0\0" + data[instructions_at + 2 + instruction_length:]
+    else:
+        stripped = bytearray(data)
+        flag_offsets = []
+        for at, glyph, flags in components(data):
+            if glyph is None:
+                stripped = stripped[:at]
+                break
+            struct.pack_into(">H", stripped, at, remap[glyph])
+            flag_offsets.append(at - 2)
+        for at in flag_offsets:
+            flags = struct.unpack_from(">H", stripped, at)[0]
+            struct.pack_into(">H", stripped, at, flags & ~WE_HAVE_INSTRUCTIONS)
+        stripped = bytes(stripped)
+    return stripped + b"\0" * (-len(stripped) % 4)
+
+
+def build_cmap(mapping):
+    codes = sorted(mapping)
+    segments = []
+    for c in codes:
+        if segments and segments[-1][1] == c - 1 and mapping[c] - c == mapping[segments[-1][0]] - segments[-1][0]:
+            segments[-1][1] = c
+        else:
+            segments.append([c, c])
+    segments.append([0xFFFF, 0xFFFF])
+
+    seg_count = len(segments)
+    search_range = 2 * (1 << (seg_count.bit_length() - 1))
+    entry_selector = search_range.bit_length() - 2
+    range_shift = 2 * seg_count - search_range
+
+    ends = b"".join(struct.pack(">H", end) for _, end in segments)
+    starts = b"".join(struct.pack(">H", start) for start, _ in segments)
+    deltas = b"".join(
+        struct.pack(">H", ((mapping[start] - start) if start != 0xFFFF else 1) & 0xFFFF) for start, _ in segments
+    )
+    range_offsets = b"\0\0" * seg_count
+    body = struct.pack(">HHHH", 2 * seg_count, search_range, entry_selector, range_shift)
+    body += ends + b"\0\0" + starts + deltas + range_offsets
+    subtable = struct.pack(">HHH", 4, 6 + len(body), 0) + body
+    return struct.pack(">HHHHI", 0, 1, 3, 1, 12) + subtable
+
+
+def checksum(data):
+    data += b"\0" * (-len(data) % 4)
+    return sum(struct.unpack(">%dI" % (len(data) // 4), data)) & 0xFFFFFFFF
+
+
+def subset(font):
+    tables = read_tables(font)
+    cmap = {c: g for c, g in read_cmap(tables["cmap"]).items() if c in CODEPOINTS}
+
+    keep = {0}
+    pending = list(cmap.values())
+    while pending:
+        glyph = pending.pop()
+        if glyph in keep:
+            continue
+        keep.add(glyph)
+        data = glyph_data(tables, glyph)
+        if data and struct.unpack_from(">h", data, 0)[0] < 0:
+            pending.extend(g for _, g, _ in components(data) if g is not None)
+
+    order = sorted(keep)
+    remap = {old: new for new, old in enumerate(order)}
+
+    num_metrics = struct.unpack_from(">H", tables["hhea"], 34)[0]
+
+    def metric(glyph):
+        if glyph < num_metrics:
+            return tables["hmtx"][4 * glyph:4 * glyph + 4]
+        advance = tables["hmtx"][4 * (num_metrics - 1):4 * num_metrics - 2]
+        lsb_at = 4 * num_metrics + 2 * (glyph - num_metrics)
+        return advance + tables["hmtx"][lsb_at:lsb_at + 2]
+
+    glyf = b""
+    loca = []
+    for glyph in order:
+        loca.append(len(glyf))
+        glyf += strip_and_remap(glyph_data(tables, glyph), remap)
+    loca.append(len(glyf))
+
+    head = bytearray(tables["head"])
+    struct.pack_into(">I", head, 8, 0)
+    struct.pack_into(">h", head, 50, 1)
+    hhea = bytearray(tables["hhea"])
+    struct.pack_into(">H", hhea, 34, len(order))
+    maxp = bytearray(tables["maxp"])
+    struct.pack_into(">H", maxp, 4, len(order))
+    if len(maxp) >= 32:
+        struct.pack_into(">HHHHH", maxp, 18, 0, 0, 0, 0, 0)
+        struct.pack_into(">H", maxp, 26, 0)
+    post = bytearray(tables["post"][:32])
+    struct.pack_into(">I", post, 0, 0x00030000)
+
+    out_tables = {
+        "OS/2": tables["OS/2"],
+        "cmap": build_cmap({c: remap[g] for c, g in cmap.items()}),
+        "glyf": glyf,
+        "head": bytes(head),
+        "hhea": bytes(hhea),
+        "hmtx": b"".join(metric(g) for g in order),
+        "loca": b"".join(struct.pack(">I", v) for v in loca),
+        "maxp": bytes(maxp),
+        "name": tables["name"],
+        "post": bytes(post),
+    }
+
+    num_tables = len(out_tables)
+    search_range = 16 * (1 << (num_tables.bit_length() - 1))
+    entry_selector = num_tables.bit_length() - 1
+    out = struct.pack(">IHHHH", 0x00010000, num_tables, search_range, entry_selector, 16 * num_tables - search_range)
+    offset = 12 + 16 * num_tables
+    directory = b""
+    body = b""
+    for tag in sorted(out_tables):
+        data = out_tables[tag]
+        directory += struct.pack(">4sIII", tag.encode("latin-1"), checksum(data), offset + len(body), len(data))
+        body += data + b"\0" * (-len(data) % 4)
+    result = bytearray(out + directory + body)
+
+    head_offset = offset + sum(len(out_tables[t]) + (-len(out_tables[t]) % 4) for t in sorted(out_tables) if t < "head")
+    struct.pack_into(">I", result, head_offset + 8, (0xB1B0AFBA - checksum(bytes(result))) & 0xFFFFFFFF)
+    return bytes(result)
+
+
+def main():
+    with open(sys.argv[1], "rb") as f:
+        font = f.read()
+    data = subset(font)
+
+    lines = []
+    for i in range(0, len(data), 24):
+        lines.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 24]) + ",")
+
+    with open(sys.argv[2], "w", newline="\n") as f:
+        f.write("// Generated by subset_font.py from Lato Regular, licensed under the SIL Open Font License 1.1.\n")
+        f.write("// Do not edit by hand.\n")
+        f.write('#include "../utils/font_provider.hpp"\n\n')
+        f.write("namespace {\n")
+        f.write("// clang-format off\n")
+        f.write("constexpr unsigned char EMBEDDED_FONT_DATA[%d] = {\n" % len(data))
+        f.write("\n".join(lines) + "\n")
+        f.write("};\n")
+        f.write("// clang-format on\n")
+        f.write("}\n\n")
+        f.write("namespace utils {\n")
+        f.write("FontData embedded_font() {\n")
+        f.write("    return {.family = \"lottie_splash_embedded\",\n")
+        f.write("            .data   = reinterpret_cast<const char *>(EMBEDDED_FONT_DATA),\n")
+        f.write("            .size   = sizeof(EMBEDDED_FONT_DATA)};\n")
+        f.write("}\n")
+        f.write("}\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -1,10 +1,18 @@
 #include "lottie_splash.h"
 #include "splash_window.hpp"
 #include "utils/display.hpp"
+#include "utils/memory.hpp"
 #include "utils/unicode.hpp"
+#include <cstdio>
 #include <memory>
 #include <thread>
 #include <optional>
+#include <vector>
+#include <filesystem>
+
+static_assert(LOTTIE_SPLASH_MAX_COUNTERS == utils::MessageTemplate::MAX_COUNTERS);
+static_assert(LOTTIE_SPLASH_QUALITY_FROZEN == static_cast<int>(utils::QualityGovernor::Level::Frozen));
+static_assert(LOTTIE_SPLASH_MEMORY_SUBSYSTEM_COUNT == static_cast<int>(utils::memory::Subsystem::Count));
 
 namespace {
 lottie_splash_error convert_init_error(SplashWindow::InitError err) {
@@ -27,6 +35,23 @@ lottie_splash_error convert_init_error(SplashWindow::InitError err) {
         return LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
     }
 }
+
+// Some system APIs (e.g. setting the DPI awareness) fail when called from multiple threads. This mutex is used to ensure
+// that only one thread calls them. It also guards the number of contexts, which decides whether the allocator may
+// change.
+std::mutex context_mutex;
+size_t     context_count = 0;
+
+std::vector<std::filesystem::path> split_font_search_paths(const std::u8string_view paths) {
+    std::vector<std::filesystem::path> result;
+    for(size_t start = 0; start <= paths.size();) {
+        const size_t end = std::min(paths.find(u8';', start), paths.size());
+        if(end > start)
+            result.emplace_back(paths.substr(start, end - start));
+        start = end + 1;
+    }
+    return result;
+}
 }
 
 struct lottie_splash_context {
@@ -41,6 +66,17 @@ LOTTIE_SPLASH_API lottie_splash_context * lottie_splash_create(const char *
                                                                const unsigned        window_width,
                                                                const unsigned        window_height,
                                                                lottie_splash_error * out_error) {
+    return lottie_splash_create_ex(
+      lottie_animation_buf, buf_size, utf8_window_title, window_width, window_height, nullptr, out_error);
+}
+
+LOTTIE_SPLASH_API lottie_splash_context * lottie_splash_create_ex(const char *                         lottie_animation_buf,
+                                                                  size_t                               buf_size,
+                                                                  const char8_t *                      utf8_window_title,
+                                                                  const unsigned                       window_width,
+                                                                  const unsigned                       window_height,
+                                                                  const lottie_splash_create_options * options,
+                                                                  lottie_splash_error *                out_error) {
     auto set_error = [&](lottie_splash_error err) {
         if(out_error)
             *out_error = err;
@@ -51,9 +87,14 @@ LOTTIE_SPLASH_API lottie_splash_context * lottie_splash_create(const char *
         return nullptr;
     }
 
-    // Some system APIs (e.g. setting the DPI awareness) fail when called from multiple threads. This mutex is used to ensure that only one thread calls them.
-    static std::mutex create_mutex;
-    std::lock_guard   lock{create_mutex};
+#ifndef LOTTIE_SPLASH_VIRTUAL_CLOCK
+    if(options && options->virtual_clock) {
+        set_error(LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT);
+        return nullptr;
+    }
+#endif
+
+    std::lock_guard lock{context_mutex};
 
     if(!utils::enable_dpi_awareness()) {
         set_error(LOTTIE_SPLASH_ERROR_DISPLAY_INIT_FAILED);
@@ -71,12 +112,31 @@ LOTTIE_SPLASH_API lottie_splash_context * lottie_splash_create(const char *
 
     ctx->window = std::make_unique<SplashWindow>(std::make_pair(final_window_width, final_window_height));
 
-    if(!ctx->window->init(lottie_animation_buf, buf_size, utils::utf8_to_wide(utf8_window_title).c_str())) {
+    SplashWindow::InitOptions init_options;
+    if(options) {
+        init_options.poster_pixels = options->poster_pixels;
+        init_options.poster_width  = static_cast<int>(options->poster_width);
+        init_options.poster_height = static_cast<int>(options->poster_height);
+        if(options->utf8_poster_cache_path)
+            init_options.poster_cache_path = utils::utf8_to_wide(options->utf8_poster_cache_path);
+
+        init_options.font_data      = options->font_data;
+        init_options.font_data_size = options->font_data_size;
+        if(options->utf8_font_search_paths)
+            init_options.font_search_paths = split_font_search_paths(options->utf8_font_search_paths);
+
+        init_options.virtual_clock   = options->virtual_clock != 0;
+        init_options.quantize_frames = options->quantize_frames != 0;
+    }
+
+    if(!ctx->window->init(
+         lottie_animation_buf, buf_size, utils::utf8_to_wide(utf8_window_title).c_str(), init_options)) {
         set_error(convert_init_error(ctx->window->_last_error));
         return nullptr;
     }
 
     ctx->window_message_loop_thread_id = std::this_thread::get_id();
+    ++context_count;
     set_error(LOTTIE_SPLASH_SUCCESS);
     return ctx.release();
 }
@@ -103,6 +163,9 @@ LOTTIE_SPLASH_API lottie_splash_error lottie_splash_destroy(lottie_splash_contex
         return LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
 
     delete ctx;
+
+    std::lock_guard lock{context_mutex};
+    --context_count;
     return LOTTIE_SPLASH_SUCCESS;
 }
 
@@ -130,6 +193,41 @@ LOTTIE_SPLASH_API lottie_splash_error lottie_splash_set_status_message(lottie_sp
     return LOTTIE_SPLASH_SUCCESS;
 }
 
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_register_message(lottie_splash_context * ctx,
+                                                                     const char8_t *         utf8_string,
+                                                                     unsigned *              out_message_id) {
+    if(!ctx || !ctx->window || !utf8_string || !out_message_id)
+        return LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
+
+    const auto id = ctx->window->register_message(utf8_string);
+    if(!id)
+        return LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
+
+    *out_message_id = *id;
+    return LOTTIE_SPLASH_SUCCESS;
+}
+
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_set_status_message_id(lottie_splash_context * ctx,
+                                                                          unsigned                message_id) {
+    if(!ctx || !ctx->window)
+        return LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
+
+    if(!ctx->window->is_initialized())
+        return LOTTIE_SPLASH_WINDOW_CLOSED_BY_USER;
+
+    return ctx->window->set_status_message_id(message_id) ? LOTTIE_SPLASH_SUCCESS
+                                                           : LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
+}
+
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_set_counter(lottie_splash_context * ctx,
+                                                                unsigned                slot,
+                                                                uint64_t                value) {
+    if(!ctx || !ctx->window)
+        return LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
+
+    return ctx->window->set_counter(slot, value) ? LOTTIE_SPLASH_SUCCESS : LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
+}
+
 LOTTIE_SPLASH_API lottie_splash_error lottie_splash_set_progress(lottie_splash_context * ctx,
                                                                  float                   normalized_progress_value) {
     if(normalized_progress_value < 0.0f || normalized_progress_value > 1.0f)
@@ -144,4 +242,162 @@ LOTTIE_SPLASH_API lottie_splash_error lottie_splash_set_progress(lottie_splash_c
     ctx->window->set_progress(normalized_progress_value);
     return LOTTIE_SPLASH_SUCCESS;
 }
-}
\ No newline at end of file
+
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_add_task(lottie_splash_context * ctx,
+                                                             float                   weight,
+                                                             lottie_splash_task **   out_task) {
+    if(!ctx || !ctx->window || !out_task)
+        return LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
+
+    auto * task = ctx->window->add_task(weight);
+    if(!task)
+        return LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
+
+    *out_task = reinterpret_cast<lottie_splash_task *>(task);
+    return LOTTIE_SPLASH_SUCCESS;
+}
+
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_task_advance(lottie_splash_task * task,
+                                                                 uint64_t             done,
+                                                                 uint64_t             total) {
+    if(!task)
+        return LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
+
+    utils::ProgressTasks::advance(*reinterpret_cast<utils::ProgressTasks::Task *>(task), done, total);
+    return LOTTIE_SPLASH_SUCCESS;
+}
+
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_get_stats(const lottie_splash_context * ctx,
+                                                              lottie_splash_stats *         out_stats) {
+    if(!ctx || !ctx->window || !out_stats)
+        return LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
+
+    using ms = std::chrono::duration<double, std::milli>;
+
+    const auto stats                         = ctx->window->stats();
+    out_stats->time_to_first_pixel_ms        = ms{stats.time_to_first_pixel}.count();
+    out_stats->time_to_first_frame_ms        = ms{stats.time_to_first_frame}.count();
+    out_stats->frames_rendered               = stats.frames_rendered;
+    out_stats->progress_bar_updates          = stats.progress_bar_updates;
+    out_stats->dropped_frames                = stats.dropped_frames;
+    out_stats->max_frame_lateness_ms         = ms{stats.max_frame_lateness}.count();
+    out_stats->repeated_source_frames        = stats.repeated_source_frames;
+    out_stats->skipped_source_frames         = stats.skipped_source_frames;
+    out_stats->quality_level                 = static_cast<lottie_splash_quality_level>(stats.quality_level);
+    out_stats->quality_level_changes         = stats.quality_level_changes;
+    out_stats->cpu_usage_percent             = stats.cpu_usage * 100.0;
+    out_stats->times_hidden                  = stats.times_hidden;
+    out_stats->hidden_time_ms                = ms{stats.hidden_time}.count();
+    out_stats->steady_frame_heap_allocations = stats.steady_frame_heap_allocations;
+    out_stats->engine_frame_heap_allocations = stats.engine_frame_heap_allocations;
+    out_stats->uses_expressions              = stats.uses_expressions;
+    out_stats->animation_load_ms             = ms{stats.animation_load_time}.count();
+    out_stats->expression_heap_bytes         = stats.expression_heap_bytes;
+    out_stats->overdraw_pixel_writes         = stats.overdraw_pixel_writes;
+    out_stats->overdraw_canvas_pixels        = stats.overdraw_canvas_pixels;
+    out_stats->cached_static_layers          = stats.cached_static_layers;
+    out_stats->overlay_redraws               = stats.overlay_redraws;
+    out_stats->progress_target               = stats.progress_target;
+    out_stats->displayed_progress            = stats.displayed_progress;
+    return LOTTIE_SPLASH_SUCCESS;
+}
+
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_get_layer_profile(const lottie_splash_context * ctx,
+                                                                      lottie_splash_layer_profile * out_layers,
+                                                                      uint32_t                      capacity,
+                                                                      uint32_t *                    out_count) {
+    if(!ctx || !ctx->window || !out_count || (capacity && !out_layers))
+        return LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
+
+#ifdef LOTTIE_SPLASH_PROFILING
+    // The names point into the profiler, which keeps them for the window's lifetime.
+    const auto layers = ctx->window->layer_profiler().sorted();
+    *out_count        = static_cast<uint32_t>(layers.size());
+    for(size_t i = 0; i < layers.size() && i < capacity; ++i) {
+        out_layers[i].utf8_name = layers[i].name.data();
+        out_layers[i].samples   = layers[i].samples;
+        out_layers[i].update_ms = layers[i].update_ms;
+        out_layers[i].draw_ms   = layers[i].draw_ms;
+    }
+    return LOTTIE_SPLASH_SUCCESS;
+#else
+    *out_count = 0;
+    return LOTTIE_SPLASH_ERROR_NOT_SUPPORTED;
+#endif
+}
+
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_write_layer_profile(const lottie_splash_context * ctx,
+                                                                        const char8_t *               utf8_path) {
+    if(!ctx || !ctx->window || !utf8_path)
+        return LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
+
+#ifdef LOTTIE_SPLASH_PROFILING
+    const std::string json = ctx->window->layer_profiler().to_json();
+    std::FILE *       file = _wfopen(utils::utf8_to_wide(utf8_path).c_str(), L"wb");
+    if(!file)
+        return LOTTIE_SPLASH_ERROR_FILE_WRITE_FAILED;
+
+    const bool written = std::fwrite(json.data(), 1, json.size(), file) == json.size();
+    // Closing flushes, so it can fail as well.
+    return std::fclose(file) == 0 && written ? LOTTIE_SPLASH_SUCCESS : LOTTIE_SPLASH_ERROR_FILE_WRITE_FAILED;
+#else
+    return LOTTIE_SPLASH_ERROR_NOT_SUPPORTED;
+#endif
+}
+
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_set_overdraw_heat_map(lottie_splash_context * ctx, int enabled) {
+    if(!ctx || !ctx->window)
+        return LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
+
+    return ctx->window->set_overdraw_heat_map(enabled != 0) ? LOTTIE_SPLASH_SUCCESS : LOTTIE_SPLASH_ERROR_NOT_SUPPORTED;
+}
+
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_set_cpu_budget(lottie_splash_context * ctx,
+                                                                   float                   percent_of_one_core) {
+    if(!ctx || !ctx->window || !ctx->window->set_cpu_budget(percent_of_one_core / 100.0))
+        return LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
+
+    return LOTTIE_SPLASH_SUCCESS;
+}
+
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_advance_clock(lottie_splash_context * ctx, uint64_t nanoseconds) {
+    if(!ctx || !ctx->window || nanoseconds > static_cast<uint64_t>(std::chrono::nanoseconds::max().count()))
+        return LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
+
+    if(!ctx->window->advance_clock(std::chrono::nanoseconds{static_cast<int64_t>(nanoseconds)}))
+        return LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
+
+    return LOTTIE_SPLASH_SUCCESS;
+}
+
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_set_allocator(lottie_splash_malloc_fn  malloc_fn,
+                                                                  lottie_splash_realloc_fn realloc_fn,
+                                                                  lottie_splash_free_fn    free_fn,
+                                                                  void *                   user) {
+    if(!utils::memory::CUSTOM_ALLOCATOR)
+        return LOTTIE_SPLASH_ERROR_NOT_SUPPORTED;
+    if(!malloc_fn != !realloc_fn || !malloc_fn != !free_fn)
+        return LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
+
+    std::lock_guard lock{context_mutex};
+    if(context_count)
+        return LOTTIE_SPLASH_ERROR_ALREADY_INITIALIZED;
+
+    const utils::memory::Allocator allocator{
+      .malloc_fn = malloc_fn, .realloc_fn = realloc_fn, .free_fn = free_fn, .user = user};
+    return utils::memory::set_allocator(allocator) ? LOTTIE_SPLASH_SUCCESS : LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
+}
+
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_get_memory_usage(lottie_splash_memory_subsystem subsystem,
+                                                                     lottie_splash_memory_usage *   out_usage) {
+    if(subsystem < 0 || subsystem >= LOTTIE_SPLASH_MEMORY_SUBSYSTEM_COUNT || !out_usage)
+        return LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT;
+    if(!utils::memory::CUSTOM_ALLOCATOR)
+        return LOTTIE_SPLASH_ERROR_NOT_SUPPORTED;
+
+    const auto usage         = utils::memory::usage(static_cast<utils::memory::Subsystem>(subsystem));
+    out_usage->current_bytes = usage.current_bytes;
+    out_usage->peak_bytes    = usage.peak_bytes;
+    return LOTTIE_SPLASH_SUCCESS;
+}
+}
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <stddef.h>
+#include <stdint.h>
+
 #ifdef LOTTIE_SPLASH_EXPORTS
 #define LOTTIE_SPLASH_API __declspec(dllexport)
 #else
@@ -7,6 +10,9 @@
 #endif
 
 typedef struct lottie_splash_context lottie_splash_context;
+typedef struct lottie_splash_task    lottie_splash_task;
+
+#define LOTTIE_SPLASH_MAX_COUNTERS 16
 
 typedef enum lottie_splash_error {
     LOTTIE_SPLASH_SUCCESS = 0,
@@ -21,8 +27,118 @@ typedef enum lottie_splash_error {
     LOTTIE_SPLASH_ERROR_FONT_LOAD_FAILED,
     LOTTIE_SPLASH_ERROR_DISPLAY_INIT_FAILED,
     LOTTIE_SPLASH_ERROR_RENDER_FAILED,
+    LOTTIE_SPLASH_ERROR_ALREADY_INITIALIZED,
+    LOTTIE_SPLASH_ERROR_NOT_SUPPORTED,
+    LOTTIE_SPLASH_ERROR_FILE_WRITE_FAILED,
 } lottie_splash_error;
 
+typedef enum lottie_splash_quality_level {
+    LOTTIE_SPLASH_QUALITY_FULL = 0,
+    LOTTIE_SPLASH_QUALITY_REDUCED_FRAME_RATE,
+    LOTTIE_SPLASH_QUALITY_REDUCED_RESOLUTION,
+    LOTTIE_SPLASH_QUALITY_FROZEN,
+} lottie_splash_quality_level;
+
+/// Memory is accounted to what the library was doing on the allocating thread. Allocations on thorvg's worker threads are charged to what the library was doing when it handed them work, usually rasterizing a frame.
+typedef enum lottie_splash_memory_subsystem {
+    LOTTIE_SPLASH_MEMORY_OTHER = 0,
+    /// Loading the animation, including building its model.
+    LOTTIE_SPLASH_MEMORY_PARSER,
+    /// Updating the animation's scene for each frame.
+    LOTTIE_SPLASH_MEMORY_MODEL,
+    /// Engine, canvas and font setup, and rasterizing frames.
+    LOTTIE_SPLASH_MEMORY_RASTERIZER,
+    /// Poster, rasterized text, reduced resolution frames and per-frame scratch memory.
+    LOTTIE_SPLASH_MEMORY_FRAME_CACHE,
+    LOTTIE_SPLASH_MEMORY_SUBSYSTEM_COUNT,
+} lottie_splash_memory_subsystem;
+
+typedef struct lottie_splash_memory_usage {
+    unsigned long long current_bytes;
+    unsigned long long peak_bytes;
+} lottie_splash_memory_usage;
+
+/// Must return memory aligned to at least 16 bytes on 64 bit targets, like malloc. Returning NULL ends the process, since the renderer can't recover from failed allocations.
+typedef void * (*lottie_splash_malloc_fn)(size_t size, void * user);
+/// Resizes a block returned by lottie_splash_malloc_fn like realloc, keeping its contents. Never called with a NULL pointer or a size of 0.
+typedef void * (*lottie_splash_realloc_fn)(void * pointer, size_t size, void * user);
+typedef void (*lottie_splash_free_fn)(void * pointer, void * user);
+
+typedef struct lottie_splash_create_options {
+    /// Optional premultiplied ARGB8888 image which is shown immediately after the window is created, before the animation is parsed. It's crossfaded into the live animation once it's ready.
+    const uint32_t * poster_pixels;
+    unsigned         poster_width;
+    unsigned         poster_height;
+    /// Optional zero-terminated UTF-8 path to a poster cache file. If no poster_pixels are given, the poster is loaded from it. If it's missing or stale, the first live frame is saved there for the next run.
+    const char8_t * utf8_poster_cache_path;
+    /// Optional TrueType font data used for the status text. The data is copied, so it can be freed after the call.
+    const char * font_data;
+    size_t       font_data_size;
+    /// Optional zero-terminated UTF-8 list of font file paths separated by ';', tried in order before falling back to the embedded font. Replaces the platform defaults.
+    const char8_t * utf8_font_search_paths;
+    /// When non-zero, animation time starts at zero and only moves with lottie_splash_advance_clock, so every frame is reproducible. Only supported by libraries built with --with-virtual-clock, otherwise creation fails with LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT.
+    int virtual_clock;
+    /// When non-zero, the animation is only shown at whole frames instead of in between them when the display refreshes faster than its frame rate. Meant for animations rewritten by lottie_baker or lottie_optimizer, which are only verified at whole frames.
+    int quantize_frames;
+} lottie_splash_create_options;
+
+typedef struct lottie_splash_stats {
+    /// Time from lottie_splash_create to the first pixels presented in the window, i.e. the poster or the first frame.
+    double             time_to_first_pixel_ms;
+    /// Time from lottie_splash_create to the first live animation frame presented in the window.
+    double             time_to_first_frame_ms;
+    unsigned long long frames_rendered;
+    /// Frames in which the progress bar moved. Stops growing once the bar has settled on its target.
+    unsigned long long progress_bar_updates;
+    /// Frame deadlines which were skipped because rendering fell behind.
+    unsigned long long dropped_frames;
+    /// The longest delay between a frame deadline and the start of that frame.
+    double max_frame_lateness_ms;
+    /// Animation frames which were presented again in the following window frame, i.e. the window refreshed faster than the animation frame rate.
+    unsigned long long repeated_source_frames;
+    /// Animation frames which were never presented, because rendering fell behind the animation frame rate.
+    unsigned long long skipped_source_frames;
+    /// Quality level currently picked by the governor. It steps down when rendering takes too much CPU time and back up once there's headroom again.
+    lottie_splash_quality_level quality_level;
+    unsigned long long          quality_level_changes;
+    /// CPU time used by the render thread and the rendering worker threads over the last half second, in percent of one core.
+    double cpu_usage_percent;
+    /// How often and for how long rendering was suspended, because the window was minimized, cloaked, off-screen or the session was locked.
+    unsigned long long times_hidden;
+    double             hidden_time_ms;
+    /// Heap allocations made by lottie_splash in frames that didn't change the scene, which should stay 0, and by the renderer on the render thread in the last frame.
+    /// Both stay 0 unless the library was built with --with-allocation-counter.
+    unsigned long long steady_frame_heap_allocations;
+    unsigned long long engine_frame_heap_allocations;
+    /// Non-zero when the animation contains expressions. Builds with --without-expressions render those animations without evaluating them.
+    int uses_expressions;
+    /// Time spent loading the animation, including starting the expression engine unless the library was built with --without-expressions.
+    double animation_load_ms;
+    /// Heap reserved by the expression engine, 0 in builds with --without-expressions.
+    unsigned long long expression_heap_bytes;
+    /// Pixel writes summed over the last frame drawn as an overdraw heat map, and the canvas area in pixels. Their ratio is the average overdraw. Both stay 0 until the heat map is shown.
+    unsigned long long overdraw_pixel_writes;
+    unsigned long long overdraw_canvas_pixels;
+    /// Top level layers of the animation which never change, drawn from bitmaps rendered once instead of being rasterized in the last frame. Only the ones below or above all animated layers qualify.
+    unsigned long long cached_static_layers;
+    /// Frames which rasterized the progress bar and the messages. The software renderer draws them into a surface of their own only when they changed and blends it onto every frame, the OpenGL renderer draws them with every frame.
+    unsigned long long overlay_redraws;
+    /// Progress the bar was moving towards in the last frame, either the value passed to lottie_splash_set_progress or the weighted mean of the tasks.
+    float progress_target;
+    /// Progress the bar was drawn at in the last frame. It follows the target on a spring, so it lags behind and only reaches it once the bar settled.
+    float displayed_progress;
+} lottie_splash_stats;
+
+typedef struct lottie_splash_layer_profile {
+    /// Name of the layer in the animation, valid until the context is destroyed.
+    const char * utf8_name;
+    /// Number of frames the layer was measured in.
+    unsigned long long samples;
+    /// Average time per frame the layer adds to preparing the frame's paths and to rasterizing them. Noise can make layers which cost next to nothing slightly negative.
+    double update_ms;
+    double draw_ms;
+} lottie_splash_layer_profile;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -45,6 +161,18 @@ LOTTIE_SPLASH_API lottie_splash_context * lottie_splash_create(const char *
                                                                const unsigned        window_height,
                                                                lottie_splash_error * out_error);
 
+/// <summary>
+/// Same as lottie_splash_create, but accepts additional options.
+/// </summary>
+/// <param name="options">Optional pointer to creation options. Passing nullptr is equivalent to calling lottie_splash_create.</param>
+LOTTIE_SPLASH_API lottie_splash_context * lottie_splash_create_ex(const char *                         lottie_animation_buf,
+                                                                  size_t                               buf_size,
+                                                                  const char8_t *                      utf8_window_title,
+                                                                  const unsigned                       window_width,
+                                                                  const unsigned                       window_height,
+                                                                  const lottie_splash_create_options * options,
+                                                                  lottie_splash_error *                out_error);
+
 /// <summary>
 /// Destroys the lottie splash context and releases all resources. It's the caller's responsibility to close the window before calling this function.
 /// </summary>
@@ -75,6 +203,38 @@ LOTTIE_SPLASH_API lottie_splash_error lottie_splash_close_window(const lottie_sp
 LOTTIE_SPLASH_API lottie_splash_error lottie_splash_set_status_message(lottie_splash_context * ctx,
                                                                        const char8_t *         utf8_string);
 
+/// <summary>
+/// Registers an immutable status message, which can later be shown with lottie_splash_set_status_message_id. Registered messages are laid out and rasterized only once, and switching between them doesn't allocate or lock.
+/// The message may contain "{N}" placeholders, which are replaced with the value of counter N (see lottie_splash_set_counter) each time a frame is drawn. Use "{{" and "}}" for literal braces.
+/// </summary>
+/// <param name="ctx">Lottie context object obtained from lottie_splash_create.</param>
+/// <param name="utf8_string">Zero-terminated message string encoded in UTF-8.</param>
+/// <param name="out_message_id">Receives the message id.</param>
+/// <returns>LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT is returned if the registry is full.</returns>
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_register_message(lottie_splash_context * ctx,
+                                                                     const char8_t *         utf8_string,
+                                                                     unsigned *              out_message_id);
+
+/// <summary>
+/// Sets the status message to a message registered with lottie_splash_register_message. Can be called from any thread.
+/// </summary>
+/// <param name="ctx">Lottie context object obtained from lottie_splash_create.</param>
+/// <param name="message_id">Message id obtained from lottie_splash_register_message.</param>
+/// <returns></returns>
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_set_status_message_id(lottie_splash_context * ctx,
+                                                                          unsigned                message_id);
+
+/// <summary>
+/// Sets the value of a counter referenced by registered message placeholders. This is a single relaxed atomic store, so it's cheap enough to call from hot loops on any thread.
+/// </summary>
+/// <param name="ctx">Lottie context object obtained from lottie_splash_create.</param>
+/// <param name="slot">Counter index, less than LOTTIE_SPLASH_MAX_COUNTERS.</param>
+/// <param name="value">New counter value.</param>
+/// <returns></returns>
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_set_counter(lottie_splash_context * ctx,
+                                                                unsigned                slot,
+                                                                uint64_t                value);
+
 /// <summary>
 /// Sets the progress value for the progress bar.
 /// </summary>
@@ -84,6 +244,112 @@ LOTTIE_SPLASH_API lottie_splash_error lottie_splash_set_status_message(lottie_sp
 LOTTIE_SPLASH_API lottie_splash_error lottie_splash_set_progress(lottie_splash_context * ctx,
                                                                  float                   normalized_progress_value);
 
+/// <summary>
+/// Debug mode which replaces the splash with a heat map of how often each pixel is written per frame: once blue, twice green, three times yellow, four times orange and five or more times red.
+/// Counts the background, the poster, each top level layer of the animation including the offscreen buffers of its mattes and masks, and each part of the overlay. Every part is drawn separately, so frames get a lot slower while it's shown.
+/// </summary>
+/// <param name="ctx">Lottie context object obtained from lottie_splash_create.</param>
+/// <param name="enabled">Non-zero to show the heat map, zero to go back to the splash.</param>
+/// <returns>LOTTIE_SPLASH_ERROR_NOT_SUPPORTED is returned by libraries built with --with-opengl.</returns>
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_set_overdraw_heat_map(lottie_splash_context * ctx, int enabled);
+
+/// <summary>
+/// Limits the CPU time rendering may take, so the splash doesn't slow down the work it's waiting for. When rendering exceeds the budget, the frame rate and then the quality are lowered until it fits. The default budget is 50% of one core. Can be called from any thread.
+/// Rendering's CPU time includes thorvg's worker threads, which are found among the threads started while the first context initializes thorvg by their common entry point. If the host starts a std::thread at that moment, the workers can't be told apart from it and only the render thread's time is counted.
+/// </summary>
+/// <param name="ctx">Lottie context object obtained from lottie_splash_create.</param>
+/// <param name="percent_of_one_core">CPU budget in percent of one core, e.g. 25 for a quarter of a core. Must be positive.</param>
+/// <returns></returns>
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_set_cpu_budget(lottie_splash_context * ctx,
+                                                                   float                   percent_of_one_core);
+
+/// <summary>
+/// Retrieves rendering statistics. Can be called from any thread.
+/// </summary>
+/// <param name="ctx">Lottie context object obtained from lottie_splash_create.</param>
+/// <param name="out_stats">A pointer to the stats structure to fill.</param>
+/// <returns></returns>
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_get_stats(const lottie_splash_context * ctx,
+                                                              lottie_splash_stats *         out_stats);
+
+/// <summary>
+/// Advances the virtual clock of a context created with the virtual_clock option. Can be called from any thread, the next frame is drawn at the new time.
+/// </summary>
+/// <param name="ctx">Lottie context object obtained from lottie_splash_create_ex.</param>
+/// <param name="nanoseconds">Time to advance the clock by.</param>
+/// <returns>LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT is returned if the context doesn't use a virtual clock.</returns>
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_advance_clock(lottie_splash_context * ctx, uint64_t nanoseconds);
+
+/// <summary>
+/// Adds a weighted task to the overall progress. Once a task is added, the progress bar shows the weighted mean of all task progress values instead of the value passed to lottie_splash_set_progress.
+/// </summary>
+/// <param name="ctx">Lottie context object obtained from lottie_splash_create.</param>
+/// <param name="weight">Relative task weight, must be positive and finite.</param>
+/// <param name="out_task">Receives the task handle. It stays valid until the context is destroyed.</param>
+/// <returns>LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT is returned if the weight isn't positive and finite or too many tasks were added.</returns>
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_add_task(lottie_splash_context * ctx,
+                                                             float                   weight,
+                                                             lottie_splash_task **   out_task);
+
+/// <summary>
+/// Reports task progress. Each task may be advanced from its own thread without any locking.
+/// </summary>
+/// <param name="task">Task handle obtained from lottie_splash_add_task.</param>
+/// <param name="done">Amount of work done. Values above total are clamped.</param>
+/// <param name="total">Total amount of work. Zero means the task is complete.</param>
+/// <returns></returns>
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_task_advance(lottie_splash_task * task,
+                                                                 uint64_t             done,
+                                                                 uint64_t             total);
+
+/// <summary>
+/// Routes the library's heap allocations to the given functions, so a host can track them or enforce a memory cap. This covers operator new in the library and in thorvg, and thorvg's malloc, calloc, realloc and free.
+/// JerryScript, the expression engine, never uses the heap: it works in a static block of JERRY_GLOBAL_HEAP_SIZE bytes, see expression_heap_bytes in the stats.
+/// Allocations made before the call are still freed by the allocator they came from. Must be called while no context exists, i.e. before the engine is initialized.
+/// Only available in builds with --with-custom-allocator, which replace the global operator new and delete of the process.
+/// </summary>
+/// <param name="malloc_fn">Allocation function.</param>
+/// <param name="realloc_fn">Resizes blocks returned by malloc_fn.</param>
+/// <param name="free_fn">Frees blocks returned by malloc_fn and realloc_fn.</param>
+/// <param name="user">Passed to every call of the functions.</param>
+/// <returns>LOTTIE_SPLASH_ERROR_INVALID_ARGUMENT is returned unless either all or none of the functions are given, none restores the C runtime allocator. LOTTIE_SPLASH_ERROR_ALREADY_INITIALIZED is returned while a context exists, LOTTIE_SPLASH_ERROR_NOT_SUPPORTED without --with-custom-allocator.</returns>
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_set_allocator(lottie_splash_malloc_fn  malloc_fn,
+                                                                  lottie_splash_realloc_fn realloc_fn,
+                                                                  lottie_splash_free_fn    free_fn,
+                                                                  void *                   user);
+
+/// <summary>
+/// Retrieves the heap memory currently held and the most ever held by a subsystem, across all contexts. Counts the bytes requested, not the allocator's overhead. Can be called from any thread.
+/// </summary>
+/// <param name="subsystem">Subsystem to query.</param>
+/// <param name="out_usage">A pointer to the usage structure to fill.</param>
+/// <returns>LOTTIE_SPLASH_ERROR_NOT_SUPPORTED is returned without --with-custom-allocator.</returns>
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_get_memory_usage(lottie_splash_memory_subsystem subsystem,
+                                                                     lottie_splash_memory_usage *   out_usage);
+
+/// <summary>
+/// Retrieves what each layer of the animation costs to render, most expensive first. Each frame is rendered once more without one of the layers, taking turns, and the difference is that layer's cost including its children.
+/// Only supported by libraries built with --with-profiling. Frames drawn at reduced resolution aren't measured.
+/// </summary>
+/// <param name="ctx">Lottie context object obtained from lottie_splash_create.</param>
+/// <param name="out_layers">Receives up to capacity entries. May be NULL when capacity is 0.</param>
+/// <param name="capacity">Number of entries out_layers can hold.</param>
+/// <param name="out_count">Receives the number of profiled layers, which may be more than capacity.</param>
+/// <returns>LOTTIE_SPLASH_ERROR_NOT_SUPPORTED is returned unless the library was built with --with-profiling.</returns>
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_get_layer_profile(const lottie_splash_context * ctx,
+                                                                      lottie_splash_layer_profile * out_layers,
+                                                                      uint32_t                      capacity,
+                                                                      uint32_t *                    out_count);
+
+/// <summary>
+/// Writes the layer profile as JSON, an object with a "layers" array of entries with "name", "samples", "update_ms" and "draw_ms", most expensive first.
+/// </summary>
+/// <param name="ctx">Lottie context object obtained from lottie_splash_create.</param>
+/// <param name="utf8_path">File to write, replaced if it exists.</param>
+/// <returns>LOTTIE_SPLASH_ERROR_NOT_SUPPORTED is returned unless the library was built with --with-profiling, LOTTIE_SPLASH_ERROR_FILE_WRITE_FAILED if the file can't be written.</returns>
+LOTTIE_SPLASH_API lottie_splash_error lottie_splash_write_layer_profile(const lottie_splash_context * ctx,
+                                                                        const char8_t *               utf8_path);
+
 #ifdef __cplusplus
 }
 #endif
@@ -2,16 +2,65 @@
 
 #include <glad/glad.h>
 #include <algorithm>
-#include <array>
+#include <cmath>
+#include <iterator>
 
-#include "utils/unicode.hpp"
+#include "utils/allocation_counter.hpp"
+#include "utils/blend.hpp"
 #include "utils/display.hpp"
+#include "utils/poster_cache.hpp"
+#include "utils/font_provider.hpp"
+#include "utils/frame_scheduler.hpp"
+#include "utils/lottie_scan.hpp"
+#include "utils/memory.hpp"
+#include "utils/thread_cpu.hpp"
+#include "utils/upscale.hpp"
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
 
 namespace {
-static constexpr std::chrono::milliseconds PROGRESS_INTERPOLATION_DURATION{500LL};
+static constexpr std::chrono::milliseconds POSTER_CROSSFADE_DURATION{250LL};
 
 inline float px_to_pt(const float font_size_px) { return font_size_px * (72.0f / 96.0f); }
 
+// Overlay layout at 96 DPI.
+constexpr float BASE_BAR_WIDTH         = 245.f;
+constexpr float BASE_BAR_HEIGHT        = 6.f;
+constexpr float BASE_BAR_CORNER_RADIUS = 3.f;
+constexpr float BASE_BAR_Y             = 243.f;
+constexpr float BASE_STATUS_MESSAGE_Y  = 257.f;
+constexpr float BASE_GETTING_READY_Y   = 200.f;
+constexpr float BASE_X                 = 110.f;
+
+// JerryScript's heap is a static array, and thorvg starts the engine for every animation when it's built in.
+#ifdef LOTTIE_SPLASH_WITHOUT_EXPRESSIONS
+constexpr uint64_t EXPRESSION_HEAP_BYTES = 0;
+#else
+constexpr uint64_t EXPRESSION_HEAP_BYTES = JERRY_GLOBAL_HEAP_SIZE * 1024ull;
+#endif
+
+constexpr uint8_t            STATUS_MESSAGE_OPACITY = 182;
+constexpr std::u8string_view GETTING_READY_MESSAGE  = u8"Getting Ready...";
+
+struct BarLayout {
+    float x;
+    float y;
+    float width;
+    float height;
+    float corner_radius;
+};
+
+BarLayout bar_layout(const int window_width, const float dpi_scale) {
+    const float width = BASE_BAR_WIDTH * dpi_scale;
+    return {.x             = (window_width * dpi_scale - width) * .5f,
+            .y             = BASE_BAR_Y * dpi_scale,
+            .width         = width,
+            .height        = BASE_BAR_HEIGHT * dpi_scale,
+            .corner_radius = BASE_BAR_CORNER_RADIUS * dpi_scale};
+}
+
 #ifdef THORVG_GL_RASTER_SUPPORT
 constexpr tvg::CanvasEngine ENGINE = tvg::CanvasEngine::Gl;
 #else
@@ -19,6 +68,45 @@ constexpr tvg::CanvasEngine ENGINE = tvg::CanvasEngine::Sw;
 #endif
 constexpr int NUM_THREADS = 2;
 
+constexpr int                      TARGET_FPS = 120;
+constexpr std::chrono::nanoseconds FRAME_INTERVAL{1'000'000'000 / TARGET_FPS};
+
+// Thread CPU times only advance on scheduler ticks, so usage is measured over windows of many ticks.
+constexpr std::chrono::milliseconds CPU_USAGE_WINDOW{500};
+
+// Cloaking and leaving the screen don't send messages, so a hidden window checks on them this often.
+constexpr DWORD HIDDEN_POLL_INTERVAL_MS = 250;
+
+// thorvg's worker threads are shared by all windows and only started by the first Initializer::init call, so the ids
+// found then are remembered for the windows created after it.
+std::mutex         thorvg_worker_ids_mutex;
+std::vector<DWORD> thorvg_worker_ids;
+
+// Picks thorvg's workers out of the threads started during its initialization. They're started with std::thread, so
+// they all begin at the same entry point, while threads the host or the system start meanwhile, e.g. thread pool
+// workers, mostly begin elsewhere. Returns nothing when no group of exactly NUM_THREADS threads stands out, e.g. because
+// thorvg was running already or the host started a std::thread at the same time.
+std::vector<DWORD> find_thorvg_workers(const std::vector<DWORD> & started_threads) {
+    std::vector<std::pair<void *, DWORD>> by_start;
+    for(const DWORD thread_id : started_threads)
+        by_start.emplace_back(utils::thread_start_address(thread_id), thread_id);
+    std::sort(by_start.begin(), by_start.end());
+
+    std::vector<DWORD> workers;
+    for(auto group = by_start.begin(); group != by_start.end();) {
+        const auto end =
+          std::find_if(group, by_start.end(), [&](const auto & thread) { return thread.first != group->first; });
+        if(end - group == NUM_THREADS) {
+            if(!workers.empty())
+                return {};
+            for(auto thread = group; thread != end; ++thread)
+                workers.push_back(thread->second);
+        }
+        group = end;
+    }
+    return workers;
+}
+
 bool process_messages() {
     MSG msg;
     while(PeekMessageW(&msg, nullptr, 0, 0, PM_REMOVE)) {
@@ -32,14 +120,43 @@ bool process_messages() {
 }
 
 DWORD wait_for_messages(DWORD timeout_ms) {
-    const DWORD start_time = GetTickCount();
+    const utils::SteadyClock clock;
+    const auto               start_time = clock.now();
     if(const DWORD result = MsgWaitForMultipleObjects(0, nullptr, FALSE, timeout_ms, QS_ALLINPUT);
        result == WAIT_TIMEOUT)
         return 0;
 
-    const DWORD elapsed = GetTickCount() - start_time;
+    const auto elapsed = static_cast<DWORD>(duration_cast<std::chrono::milliseconds>(clock.now() - start_time).count());
     return elapsed < timeout_ms ? timeout_ms - elapsed : 0;
 }
+
+std::unique_ptr<void, HandleDeleter> create_frame_timer() {
+    // High resolution timers need Windows 10 1803+, older systems get a regular one, bound by the system timer period.
+    if(HANDLE timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS))
+        return std::unique_ptr<void, HandleDeleter>{timer};
+    return std::unique_ptr<void, HandleDeleter>{CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS)};
+}
+
+// Sleeps until the deadline while still dispatching window messages. Returns true if WM_QUIT was received.
+bool wait_until(const utils::Clock & clock, HANDLE timer, const std::chrono::nanoseconds deadline) {
+    while(clock.now() < deadline) {
+        const auto remaining = deadline - clock.now();
+
+        LARGE_INTEGER due_time;
+        // Negative due times are relative, in 100 ns units.
+        due_time.QuadPart = -std::max<LONGLONG>(remaining.count() / 100, 1);
+        if(timer && SetWaitableTimer(timer, &due_time, 0, nullptr, nullptr, FALSE))
+            MsgWaitForMultipleObjects(1, &timer, FALSE, INFINITE, QS_ALLINPUT);
+        else {
+            const auto timeout_ms = std::chrono::ceil<std::chrono::milliseconds>(remaining).count();
+            MsgWaitForMultipleObjects(0, nullptr, FALSE, static_cast<DWORD>(timeout_ms), QS_ALLINPUT);
+        }
+
+        if(process_messages())
+            return true;
+    }
+    return false;
+}
 }
 
 SplashWindow::SplashWindow(std::pair<int, int> dimensions) noexcept
@@ -47,8 +164,8 @@ SplashWindow::SplashWindow(std::pair<int, int> dimensions) noexcept
 
 SplashWindow::~SplashWindow() noexcept { cleanup(); }
 
-bool SplashWindow::init_thorvg(const char * lottie_data, size_t data_size) noexcept {
-    if(!init_fonts())
+bool SplashWindow::init_thorvg(const char * lottie_data, size_t data_size, const InitOptions & options) noexcept {
+    if(!init_fonts(options))
         return false;
 
     const int scaled_width  = static_cast<int>(_window_width * _dpi_scale);
@@ -91,23 +208,79 @@ bool SplashWindow::init_thorvg(const char * lottie_data, size_t data_size) noexc
          static_cast<uint32_t *>(bits), scaled_width, scaled_width, scaled_height, tvg::ColorSpace::ARGB8888) !=
        tvg::Result::Success)
         return false;
+    _canvas_pixels = static_cast<uint32_t *>(bits);
 #endif
 
-    return init_thorvg_common(lottie_data, data_size);
+    return init_thorvg_common(lottie_data, data_size, options.quantize_frames);
 }
 
 
-bool SplashWindow::init_thorvg_common(const char * lottie_data, size_t data_size) noexcept {
+bool SplashWindow::init_thorvg_common(const char * lottie_data,
+                                      size_t       data_size,
+                                      const bool   quantize_frames) noexcept {
+    // Parsing that thorvg finishes on its workers after load returns counts as Other.
+    const utils::memory::Phase phase{utils::memory::Subsystem::Parser};
+
     _logo_animation.reset(tvg::Animation::gen());
     if(!_logo_animation)
         return false;
 
+    // Measured in real time even with a virtual clock, it's a cost and not a point on the animation's timeline.
+    const bool uses_expressions = utils::uses_expressions({lottie_data, data_size});
+    const auto load_start       = std::chrono::steady_clock::now();
+
     auto * logo_picture = _logo_animation->picture();
     if(!logo_picture ||
        logo_picture->load(lottie_data, static_cast<uint32_t>(data_size), "application/json", "", true) !=
          tvg::Result::Success)
         return false;
 
+    {
+        std::lock_guard lock{_stats_mutex};
+        _stats.uses_expressions      = uses_expressions;
+        _stats.animation_load_time   = std::chrono::steady_clock::now() - load_start;
+        _stats.expression_heap_bytes = EXPRESSION_HEAP_BYTES;
+    }
+#ifndef THORVG_GL_RASTER_SUPPORT
+    _overdraw.layers.clear();
+    _overdraw.layers_complete = true;
+    _static_layers            = {};
+    for(const auto & layer : utils::scan_layers({lottie_data, data_size})) {
+        if(!layer.top_level || layer.hidden || layer.matte_source)
+            continue;
+        if(layer.name.empty()) {
+            _overdraw.layers_complete = false;
+            continue;
+        }
+        const uint32_t id = tvg::Accessor::id(layer.name.c_str());
+        _overdraw.layers.push_back({id, layer.matted || layer.masked});
+        _static_layers.layers.push_back({id, layer.constant});
+    }
+
+    // Layers are drawn into the bitmaps by hiding all others, which takes being able to look up every one of them.
+    auto &     static_layers = _static_layers.layers;
+    const auto constant      = [](const StaticLayer & layer) { return layer.constant; };
+    if(_overdraw.layers_complete) {
+        const auto above_end       = std::find_if_not(static_layers.begin(), static_layers.end(), constant);
+        _static_layers.above.first = 0;
+        _static_layers.above.count = static_cast<size_t>(above_end - static_layers.begin());
+        if(above_end != static_layers.end()) {
+            const auto below_begin = std::find_if_not(static_layers.rbegin(), static_layers.rend(), constant).base();
+            _static_layers.below.first = static_cast<size_t>(below_begin - static_layers.begin());
+            _static_layers.below.count = static_layers.size() - _static_layers.below.first;
+        }
+    }
+    if(!_static_layers.above.count && !_static_layers.below.count)
+        static_layers.clear();
+#endif
+#ifdef LOTTIE_SPLASH_PROFILING
+    auto layer_names = utils::layer_names({lottie_data, data_size});
+    _profiled_layer_ids.clear();
+    for(const auto & name : layer_names)
+        _profiled_layer_ids.push_back(tvg::Accessor::id(name.c_str()));
+    _layer_profiler.set_layers(std::move(layer_names));
+#endif
+
     float w;
     float h;
     logo_picture->size(&w, &h);
@@ -117,16 +290,33 @@ bool SplashWindow::init_thorvg_common(const char * lottie_data, size_t data_size
     const float shiftY = 56.f * _dpi_scale;
     logo_picture->translate(shiftX, shiftY);
 
-    _canvas->push(logo_picture);
-
-    _start_time = std::chrono::steady_clock::now();
+    _timeline = utils::AnimationTimeline{_logo_animation->totalFrame(), _logo_animation->duration(), quantize_frames};
+    _timeline.reset(_clock->now());
 
     return true;
 }
 
-bool SplashWindow::init(const char * lottie_data, size_t data_size, const wchar_t * window_title) noexcept {
+bool SplashWindow::init(const char *        lottie_data,
+                        size_t              data_size,
+                        const wchar_t *     window_title,
+                        const InitOptions & options) noexcept {
     cleanup();
 
+    if(options.virtual_clock) {
+        auto virtual_clock = std::make_unique<utils::VirtualClock>();
+        _virtual_clock     = virtual_clock.get();
+        _clock             = std::move(virtual_clock);
+    } else {
+        _virtual_clock = nullptr;
+        _clock         = std::make_unique<utils::SteadyClock>();
+    }
+
+    _init_time = _clock->now();
+    {
+        std::lock_guard lock{_stats_mutex};
+        _stats = {};
+    }
+
     _dpi_scale = utils::get_dpi_scale();
     if(!init_window(window_title)) {
         _last_error = InitError::WindowCreationFailed;
@@ -134,6 +324,14 @@ bool SplashWindow::init(const char * lottie_data, size_t data_size, const wchar_
         return false;
     }
     _init_state.window_initialized = true;
+    _visibility_source.attach(_hwnd.get());
+
+    // Show the poster right away, so the user has something to look at while the animation is being parsed.
+    {
+        const utils::memory::Phase phase{utils::memory::Subsystem::FrameCache};
+        init_poster(options, lottie_data, data_size);
+    }
+    present_poster();
 
 #ifdef THORVG_GL_RASTER_SUPPORT
     if(!init_opengl()) {
@@ -144,6 +342,9 @@ bool SplashWindow::init(const char * lottie_data, size_t data_size, const wchar_
     _init_state.opengl_initialized = true;
 #endif
 
+    const auto threads_before_init = utils::current_process_thread_ids();
+    // Engine, font and canvas setup count towards the rasterizer, the animation itself towards the parser.
+    const utils::memory::Phase rasterizer_phase{utils::memory::Subsystem::Rasterizer};
     if(tvg::Initializer::init(NUM_THREADS, ENGINE) != tvg::Result::Success) {
         _last_error = InitError::ThorVGInitFailed;
         cleanup();
@@ -151,7 +352,25 @@ bool SplashWindow::init(const char * lottie_data, size_t data_size, const wchar_
     }
     _init_state.thorvg_initialized = true;
 
-    if(!init_thorvg(lottie_data, data_size)) {
+    {
+        std::vector<DWORD> started_threads;
+        const auto         threads_after_init = utils::current_process_thread_ids();
+        std::set_difference(threads_after_init.begin(),
+                            threads_after_init.end(),
+                            threads_before_init.begin(),
+                            threads_before_init.end(),
+                            std::back_inserter(started_threads));
+        auto workers = find_thorvg_workers(started_threads);
+
+        std::lock_guard lock{thorvg_worker_ids_mutex};
+        if(!workers.empty()) {
+            thorvg_worker_ids = std::move(workers);
+            utils::memory::set_worker_threads(thorvg_worker_ids);
+        }
+        _worker_thread_ids = thorvg_worker_ids;
+    }
+
+    if(!init_thorvg(lottie_data, data_size, options)) {
         _last_error = InitError::AnimationLoadFailed;
         cleanup();
         return false;
@@ -213,40 +432,205 @@ bool SplashWindow::init_window(const wchar_t * window_title) noexcept {
     return true;
 }
 
+void SplashWindow::init_poster(const InitOptions & options,
+                               const char *        lottie_data,
+                               const size_t        data_size) noexcept {
+    const int scaled_width  = static_cast<int>(_window_width * _dpi_scale);
+    const int scaled_height = static_cast<int>(_window_height * _dpi_scale);
+
+    _poster            = {};
+    _poster.cache_path = options.poster_cache_path;
+
+    if(options.poster_pixels && options.poster_width > 0 && options.poster_height > 0) {
+        _poster.width  = options.poster_width;
+        _poster.height = options.poster_height;
+        _poster.pixels.assign(options.poster_pixels,
+                              options.poster_pixels + static_cast<size_t>(_poster.width) * _poster.height);
+    } else if(!_poster.cache_path.empty()) {
+        // Hashing reads the whole animation before the first pixel, so it's only done when there's a cache to use.
+        _poster.content_hash = utils::poster_content_hash(lottie_data, data_size);
+        if(utils::load_poster(_poster.cache_path, scaled_width, scaled_height, _poster.content_hash, _poster.pixels)) {
+            _poster.width  = scaled_width;
+            _poster.height = scaled_height;
+        }
+    }
+
+    _poster.needs_caching = !_poster.cache_path.empty() && _poster.pixels.empty();
+}
+
+void SplashWindow::present_poster() noexcept {
+    if(_poster.pixels.empty())
+        return;
+
+    const std::unique_ptr<HDC__, DCDeleter> hdc{GetDC(_hwnd.get()), {_hwnd.get()}};
+    if(!hdc)
+        return;
+
+    const BITMAPINFO bmi{.bmiHeader = {
+                           .biSize        = sizeof(bmi),
+                           .biWidth       = _poster.width,
+                           .biHeight      = -_poster.height,
+                           .biPlanes      = 1,
+                           .biBitCount    = 32,
+                           .biCompression = BI_RGB,
+                         }};
+
+    if(!StretchDIBits(hdc.get(),
+                      0,
+                      0,
+                      static_cast<int>(_window_width * _dpi_scale),
+                      static_cast<int>(_window_height * _dpi_scale),
+                      0,
+                      0,
+                      _poster.width,
+                      _poster.height,
+                      _poster.pixels.data(),
+                      &bmi,
+                      DIB_RGB_COLORS,
+                      SRCCOPY))
+        return;
+    GdiFlush();
+
+    std::lock_guard lock{_stats_mutex};
+    _stats.time_to_first_pixel = _clock->now() - _init_time;
+}
+
+bool SplashWindow::update_poster_crossfade(FrameInfo & frame) noexcept {
+    if(!_scene.poster)
+        return false;
+
+    const auto now = _clock->now();
+    if(!_poster.crossfade_start)
+        _poster.crossfade_start = now;
+
+    const auto elapsed = now - *_poster.crossfade_start;
+    if(elapsed >= POSTER_CROSSFADE_DURATION) {
+        // Removing the picture deletes it, and the last frame was synced already, so nothing references the pixels.
+        _canvas->remove(_scene.poster);
+        _scene.poster       = nullptr;
+        _poster.pixels      = {};
+        frame.scene_changed = true;
+        return false;
+    }
+
+    const float t = std::chrono::duration<float>(elapsed) / std::chrono::duration<float>(POSTER_CROSSFADE_DURATION);
+    _scene.poster->opacity(static_cast<uint8_t>(255 * (1.0f - t)));
+    return true;
+}
+
+void SplashWindow::on_frame_presented(const FrameInfo & frame) noexcept {
+    {
+        std::lock_guard lock{_stats_mutex};
+        _stats.progress_bar_updates += frame.progress_bar_moved;
+        _stats.overlay_redraws += frame.overlay_redrawn;
+        _stats.repeated_source_frames        = _timeline.stats().repeated_frames;
+        _stats.skipped_source_frames         = _timeline.stats().skipped_frames;
+        _stats.engine_frame_heap_allocations = frame.engine_heap_allocations;
+        if(!frame.scene_changed)
+            _stats.steady_frame_heap_allocations += frame.heap_allocations;
+        _stats.cached_static_layers          = frame.cached_static_layers;
+        _stats.progress_target               = _current_state.progress;
+        _stats.displayed_progress            = std::max(_last_drawn_progress, 0.0f);
+        if(frame.overdraw_canvas_pixels) {
+            _stats.overdraw_pixel_writes  = frame.overdraw_pixel_writes;
+            _stats.overdraw_canvas_pixels = frame.overdraw_canvas_pixels;
+        }
+        if(!_stats.frames_rendered++) {
+            _stats.time_to_first_frame = _clock->now() - _init_time;
+            if(_stats.time_to_first_pixel == std::chrono::nanoseconds::zero())
+                _stats.time_to_first_pixel = _stats.time_to_first_frame;
+        }
+    }
+
+    // Only a clean logo frame makes a good poster for the next run.
+    if(!_poster.needs_caching || frame.overlay_drawn || frame.poster_drawn || frame.overdraw_canvas_pixels ||
+       !_canvas_pixels)
+        return;
+
+    _poster.needs_caching = false;
+    utils::save_poster(_poster.cache_path,
+                       _canvas_pixels,
+                       static_cast<int>(_window_width * _dpi_scale),
+                       static_cast<int>(_window_height * _dpi_scale),
+                       _poster.content_hash);
+}
+
+SplashWindow::Stats SplashWindow::stats() const noexcept {
+    std::lock_guard lock{_stats_mutex};
+    return _stats;
+}
+
 void SplashWindow::set_status_message(const char8_t * message) noexcept {
     std::lock_guard lock{_state_mutex};
     _pending_state.status_message = message ? message : u8"";
     _needs_update                 = true;
+    _status_message_id.store(NO_MESSAGE_ID, std::memory_order_release);
 }
 
-float SplashWindow::get_interpolated_progress() noexcept {
-    if(!_progress_state.is_interpolating)
-        return _current_state.progress;
+std::optional<uint32_t> SplashWindow::register_message(const char8_t * message) noexcept {
+    std::lock_guard lock{_registry_mutex};
 
-    const auto now     = std::chrono::steady_clock::now();
-    const auto elapsed = duration_cast<std::chrono::milliseconds>(now - _progress_state.start_time);
+    const uint32_t id = _registered_message_count.load(std::memory_order_relaxed);
+    if(id >= MAX_REGISTERED_MESSAGES)
+        return std::nullopt;
 
-    if(elapsed >= PROGRESS_INTERPOLATION_DURATION) {
-        _progress_state.is_interpolating = false;
-        return _progress_state.target_value;
-    }
+    _registered_messages[id] = std::make_unique<const utils::MessageTemplate>(
+      message ? std::u8string_view{message} : std::u8string_view{});
+    // Anyone who sees the new count, including the render thread through an id set after it, sees the slot filled.
+    _registered_message_count.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+bool SplashWindow::set_status_message_id(const uint32_t id) noexcept {
+    if(id >= _registered_message_count.load(std::memory_order_acquire))
+        return false;
+
+    _status_message_id.store(id, std::memory_order_release);
+    return true;
+}
+
+bool SplashWindow::set_counter(const uint32_t slot, const uint64_t value) noexcept {
+    if(slot >= _counters.size())
+        return false;
+
+    _counters[slot].store(value, std::memory_order_relaxed);
+    return true;
+}
+
+bool SplashWindow::advance_clock(const std::chrono::nanoseconds delta) noexcept {
+    if(!_virtual_clock || delta < std::chrono::nanoseconds::zero())
+        return false;
 
-    const float t = elapsed.count() / static_cast<float>(PROGRESS_INTERPOLATION_DURATION.count());
-    const float progress =
-      _progress_state.start_value + (_progress_state.target_value - _progress_state.start_value) * t;
+    _virtual_clock->advance(delta);
+    return true;
+}
 
-    return progress;
+bool SplashWindow::set_overdraw_heat_map(const bool enabled) noexcept {
+#ifdef THORVG_GL_RASTER_SUPPORT
+    return !enabled;
+#else
+    _overdraw.enabled = enabled;
+    return true;
+#endif
 }
 
+bool SplashWindow::set_cpu_budget(const double share_of_one_core) noexcept {
+    if(!std::isfinite(share_of_one_core) || share_of_one_core <= 0.0)
+        return false;
+
+    _cpu_budget.store(share_of_one_core, std::memory_order_relaxed);
+    return true;
+}
 
 void SplashWindow::set_progress(float progress) noexcept {
+    std::lock_guard lock{_state_mutex};
+    retarget_progress_locked(progress);
+}
+
+void SplashWindow::retarget_progress_locked(float progress) noexcept {
     const float clamped_progress = std::clamp(progress, 0.0f, 1.0f);
 
-    std::lock_guard lock{_state_mutex};
-    _progress_state.start_value      = _current_state.progress;
-    _progress_state.target_value     = clamped_progress;
-    _progress_state.start_time       = std::chrono::steady_clock::now();
-    _progress_state.is_interpolating = true;
+    _progress_spring.retarget(clamped_progress, _clock->now());
 
     _pending_state.progress = clamped_progress;
     _needs_update           = true;
@@ -301,63 +685,176 @@ LRESULT SplashWindow::HandleMessage(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM
 
     case WM_DESTROY:
         return 0;
+
+    case WM_SIZE:
+    case WM_WTSSESSION_CHANGE:
+        _visibility_source.on_message(uMsg, wParam);
+        break;
     }
 
     return DefWindowProcW(hwnd, uMsg, wParam, lParam);
 }
 
 bool SplashWindow::run_message_loop() noexcept {
-    constexpr int   TARGET_FPS    = 120;
-    constexpr DWORD FRAME_TIME_MS = 1000 / TARGET_FPS;
-
+    using seconds = std::chrono::duration<double>;
+    using Level   = utils::QualityGovernor::Level;
+
+    // Pacing follows wall time even with a virtual clock, which only decides what the frames show.
+    const utils::SteadyClock pacing_clock;
+    const auto               frame_timer = create_frame_timer();
+    utils::FrameScheduler    scheduler{FRAME_INTERVAL};
+
+    utils::ThreadCpuMeter cpu_meter;
+    cpu_meter.track(GetCurrentThreadId());
+    for(const DWORD worker_id : _worker_thread_ids)
+        cpu_meter.track(worker_id);
+
+    // Render time is measured precisely per frame on this thread, while the CPU time of all threads is only known per
+    // window. Their ratio scales the former to account for the workers.
+    struct {
+        std::chrono::nanoseconds start;
+        std::chrono::nanoseconds cpu_start;
+        std::chrono::nanoseconds render_time{};
+        double                   cpu_per_render_time = 1.0;
+    } usage_window{.start = pacing_clock.now(), .cpu_start = cpu_meter.total()};
+
+    utils::VisibilityState visibility;
+
+    scheduler.reset(pacing_clock.now());
     for(; !_close_requested && IsWindow(_hwnd.get());) {
-        const DWORD start_time = GetTickCount();
-
         if(process_messages())
             break;
 
+        const auto transition = visibility.update(_visibility_source, pacing_clock.now());
+        if(transition != utils::VisibilityState::Transition::None) {
+            std::lock_guard lock{_stats_mutex};
+            _stats.times_hidden = visibility.times_hidden();
+            _stats.hidden_time  = visibility.hidden_time();
+        }
+
+        if(!visibility.visible()) {
+            wait_for_messages(HIDDEN_POLL_INTERVAL_MS);
+            continue;
+        }
+
+        if(transition == utils::VisibilityState::Transition::Shown) {
+            // The animation time kept running while nothing was drawn, so it continues from where it would be by now.
+            // Neither the pause nor the idle CPU time in it should count against pacing and the budget.
+            _timeline.resync(_clock->now());
+            scheduler.reset(pacing_clock.now());
+            usage_window = {.start               = pacing_clock.now(),
+                            .cpu_start           = cpu_meter.total(),
+                            .cpu_per_render_time = usage_window.cpu_per_render_time};
+        }
+
+        const auto render_start = pacing_clock.now();
+        scheduler.begin_frame(render_start);
         render();
+        const auto render_end  = pacing_clock.now();
+        const auto render_time = render_end - render_start;
+
+        std::optional<double> cpu_usage;
+        usage_window.render_time += render_time;
+        if(render_end - usage_window.start >= CPU_USAGE_WINDOW) {
+            const auto cpu_total = cpu_meter.total();
+            const auto cpu_time  = cpu_total - usage_window.cpu_start;
+            cpu_usage            = seconds{cpu_time} / seconds{render_end - usage_window.start};
+            if(usage_window.render_time > std::chrono::nanoseconds::zero())
+                usage_window.cpu_per_render_time = std::max(1.0, seconds{cpu_time} / seconds{usage_window.render_time});
+
+            usage_window.start       = render_end;
+            usage_window.cpu_start   = cpu_total;
+            usage_window.render_time = {};
+        }
+
+        // The profiler's extra render still counts towards the CPU usage, but lowering the quality for it would skew
+        // what's being profiled.
+        std::chrono::nanoseconds frame_time = render_time;
+#ifdef LOTTIE_SPLASH_PROFILING
+        frame_time -= std::min(_profiling_render_time, frame_time);
+        _profiling_render_time = {};
+#endif
+
+        const double cpu_budget = _cpu_budget.load(std::memory_order_relaxed);
+        _quality_governor.set_cpu_share(cpu_budget);
+        _quality_governor.report(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(frame_time * usage_window.cpu_per_render_time),
+          scheduler.interval());
+
+        const Level level          = _quality_governor.level();
+        auto        frame_interval = FRAME_INTERVAL * utils::QualityGovernor::frame_interval_multiplier(level);
+        if(level == Level::Frozen && _quality_governor.load() > 0.0) {
+            // Even frozen frames can exceed a tiny budget, so they're spaced out until their cost fits.
+            const double frame_cost = _quality_governor.load() * seconds{scheduler.interval()}.count();
+            const double frames     = std::ceil(frame_cost / cpu_budget / seconds{FRAME_INTERVAL}.count());
+            frame_interval          = std::max(frame_interval, FRAME_INTERVAL * static_cast<int64_t>(frames));
+        }
+        if(frame_interval != scheduler.interval())
+            scheduler.set_interval(frame_interval);
+        const auto deadline = scheduler.end_frame(render_end);
+
+        {
+            const auto &    pacing = scheduler.stats();
+            std::lock_guard lock{_stats_mutex};
+            _stats.dropped_frames        = pacing.dropped_frames;
+            _stats.max_frame_lateness    = pacing.max_lateness;
+            _stats.quality_level         = _quality_governor.level();
+            _stats.quality_level_changes = _quality_governor.level_changes();
+            if(cpu_usage)
+                _stats.cpu_usage = *cpu_usage;
+        }
 
-        const DWORD elapsed = GetTickCount() - start_time;
-        if(elapsed < FRAME_TIME_MS)
-            wait_for_messages(FRAME_TIME_MS - elapsed);
+        if(wait_until(pacing_clock, frame_timer.get(), deadline))
+            break;
     }
 
     CloseWindow(_hwnd.get());
+    _visibility_source.detach();
     _hwnd.reset();
 
     return _close_requested;
 }
 
-bool SplashWindow::init_fonts() noexcept {
-    struct FontInfo {
-        std::wstring filename;
-        std::string  family_name;
+bool SplashWindow::init_fonts(const InitOptions & options) noexcept {
+    const auto try_load = [&](const utils::FontData & font, const bool copy) {
+        if(tvg::Text::load(font.family.c_str(), font.data, static_cast<uint32_t>(font.size), "ttf", copy) !=
+           tvg::Result::Success)
+            return false;
+        _loaded_font_family = font.family;
+        return true;
     };
 
-    const std::array<FontInfo, 3> fonts = {
-      {{L"\\Fonts\\segoeui.ttf", "segoeui"}, {L"\\Fonts\\arial.ttf", "arial"}, {L"\\Fonts\\tahoma.ttf", "tahoma"}}};
-
-    std::array<wchar_t, MAX_PATH> windows_dir;
-    if(!GetWindowsDirectoryW(windows_dir.data(), MAX_PATH)) {
-        _last_error = InitError::FontLoadFailed;
-        return false;
+    if(options.font_data && options.font_data_size) {
+        const std::string_view data{options.font_data, options.font_data_size};
+        const std::string      family = "lottie_splash_custom_" + std::to_string(std::hash<std::string_view>{}(data));
+        const utils::FontData  font{.family = family, .data = options.font_data, .size = options.font_data_size};
+        if(try_load(font, true))
+            return true;
     }
 
-    for(const auto & font : fonts) {
-        std::wstring full_path = std::wstring(windows_dir.data()) + font.filename;
-        if(tvg::Text::load(utils::wide_to_utf8(full_path).c_str()) == tvg::Result::Success) {
-            _loaded_font_family = font.family_name;
+    // Mapped fonts outlive thorvg, so it doesn't need its own copy.
+    const auto & paths = options.font_search_paths.empty() ? utils::default_font_paths() : options.font_search_paths;
+    for(const auto & path : paths) {
+        if(const auto font = utils::map_font_file(path); font && try_load(*font, false))
             return true;
-        }
     }
 
+    if(try_load(utils::embedded_font(), false))
+        return true;
+
     _last_error = InitError::FontLoadFailed;
     return false;
 }
 
 void SplashWindow::cleanup() noexcept {
     _canvas.reset();
+    _text_runs.clear();
+    _canvas_pixels = nullptr;
+    _scene         = {};
+    _reduced_logo  = {};
+#ifndef THORVG_GL_RASTER_SUPPORT
+    _overlay = {};
+#endif
     _logo_animation.reset();
 
     if(_init_state.thorvg_initialized) {
@@ -376,6 +873,7 @@ void SplashWindow::cleanup() noexcept {
     }
 
     if(_init_state.window_initialized) {
+        _visibility_source.detach();
         _hwnd.reset();
         _init_state.window_initialized = false;
     }
@@ -396,144 +894,705 @@ bool SplashWindow::render() noexcept {
         ~RenderGuard() { flag = false; }
     } render_guard{_is_rendering};
 
+    if(!_timeline.valid())
+        return false;
+
+    {
+        const utils::memory::Phase phase{utils::memory::Subsystem::FrameCache};
+        _frame_arena.reset();
+    }
+    const utils::AllocationScope allocations;
+    FrameInfo                    frame;
 
+    // Tasks are summed once per frame, and the bar is only retargeted when the sum actually moved.
+    const auto            task_progress = _tasks.aggregate();
+    utils::ProgressSpring progress_spring;
     {
         std::lock_guard lock{_state_mutex};
+        if(task_progress && *task_progress != _pending_state.progress)
+            retarget_progress_locked(*task_progress);
+
         if(_needs_update) {
             _current_state = _pending_state;
             _needs_update  = false;
         }
+        progress_spring = _progress_spring;
     }
 
-    _canvas->remove();
-#ifndef THORVG_GL_RASTER_SUPPORT
-    // Create a solid black brush with 75% transparency
-    const HBRUSH        brush = CreateSolidBrush(RGB(0, 0, 0));
-    const BLENDFUNCTION blend = {.BlendOp = AC_SRC_OVER};
-
-    // Fill the background
-    RECT rect = {0, 0, static_cast<LONG>(_window_width * _dpi_scale), static_cast<LONG>(_window_height * _dpi_scale)};
-    FillRect(_memdc.get(), &rect, brush);
-    DeleteObject(brush);
+    if(!_scene.logo_layer) {
+        if(!build_scene()) {
+            _canvas->remove();
+            _scene = {};
+            return false;
+        }
+        frame.scene_changed = true;
+    }
+
+    const auto now     = _clock->now();
+    const auto quality = _quality_governor.level();
+    const bool animate = quality != utils::QualityGovernor::Level::Frozen;
+
+    // InsufficientCondition means the frame didn't change since the last call, e.g. while the clock stands still or
+    // with quantized frames.
+    if(animate) {
+        const float                  position = static_cast<float>(_timeline.advance(now));
+        const utils::memory::Phase   phase{utils::memory::Subsystem::Model};
+        const utils::AllocationScope engine_allocations;
+        const auto                   result = _logo_animation->frame(position);
+        frame.engine_heap_allocations += engine_allocations.count();
+        if(result != tvg::Result::Success && result != tvg::Result::InsufficientCondition)
+            return false;
+    }
+
+    if(!update_logo(quality >= utils::QualityGovernor::Level::ReducedResolution, animate, frame))
+        return false;
+
+    const uint32_t                 status_message_id  = _status_message_id.load(std::memory_order_acquire);
+    const utils::MessageTemplate * registered_message =
+      status_message_id != NO_MESSAGE_ID ? _registered_messages[status_message_id].get() : nullptr;
+    std::u8string_view             status_message = _current_state.status_message;
+    std::pmr::u8string             formatted_status_message{&_frame_arena};
+    if(registered_message) {
+        if(registered_message->has_placeholders()) {
+            registered_message->format(_counters.data(), formatted_status_message);
+            status_message = formatted_status_message;
+        } else
+            status_message = registered_message->text();
+    }
+
+    frame.poster_drawn  = update_poster_crossfade(frame);
+    frame.overlay_drawn = _current_state.progress > 0.0f || !status_message.empty();
+    _scene.overlay->opacity(frame.overlay_drawn ? 255 : 0);
+    if(frame.overlay_drawn) {
+        const auto bar = bar_layout(_window_width, _dpi_scale);
+
+        // Registered messages keep their own slot, so cycling through them never rasterizes one twice, and their
+        // counters changing only redraws the digits from cached glyphs.
+        const auto &              status_style = _scene.status_message_style;
+        const TextRunCache::Run * status_run   = nullptr;
+        if(!status_message.empty() && registered_message)
+            status_run = _text_runs.get_pinned(status_message_id, status_style, *registered_message, _counters.data());
+        else if(!status_message.empty())
+            status_run = _text_runs.get(status_style, status_message);
+        if(!update_text(_scene.status_message,
+                        status_run,
+                        status_style,
+                        status_message,
+                        bar.x,
+                        BASE_STATUS_MESSAGE_Y * _dpi_scale,
+                        STATUS_MESSAGE_OPACITY,
+                        frame))
+            return false;
+
+        const float progress_bar_progress = static_cast<float>(progress_spring.value(now));
+        frame.progress_bar_moved = progress_bar_progress != _last_drawn_progress;
+        _last_drawn_progress     = progress_bar_progress;
+
+        // Resetting keeps the path's storage, so redrawing the same shape doesn't allocate.
+        if(frame.progress_bar_moved) {
+            _scene.bar_fill->reset();
+            _scene.bar_fill->appendRect(
+              bar.x, bar.y, bar.width * progress_bar_progress, bar.height, bar.corner_radius, bar.corner_radius);
+        }
+
+        const auto & getting_ready_style = _scene.getting_ready_style;
+        update_text(_scene.getting_ready,
+                    _text_runs.get(getting_ready_style, GETTING_READY_MESSAGE),
+                    getting_ready_style,
+                    GETTING_READY_MESSAGE,
+                    BASE_X * _dpi_scale,
+                    BASE_GETTING_READY_Y * _dpi_scale,
+                    255,
+                    frame);
+    }
+#ifdef THORVG_GL_RASTER_SUPPORT
+    frame.overlay_redrawn = frame.overlay_drawn;
+#else
+    if(!update_overlay_surface(frame))
+        return false;
+#endif
+
+    {
+        const utils::memory::Phase   phase{utils::memory::Subsystem::Rasterizer};
+        const utils::AllocationScope engine_allocations;
+        draw_canvas(frame);
+        frame.engine_heap_allocations += engine_allocations.count();
+    }
+
+#ifdef THORVG_GL_RASTER_SUPPORT
+    SwapBuffers(_hdc.get());
+#else
+    BitBlt(_hdc.get(),
+           0,
+           0,
+           static_cast<int>(_window_width * _dpi_scale),
+           static_cast<int>(_window_height * _dpi_scale),
+           _memdc.get(),
+           0,
+           0,
+           SRCCOPY);
 #endif
 
-    auto scene = tvg::Scene::gen();
-    if(!scene)
+    frame.heap_allocations = allocations.count() - frame.engine_heap_allocations;
+    on_frame_presented(frame);
+    return true;
+}
+
+bool SplashWindow::build_scene() noexcept {
+    auto * logo_picture = _logo_animation->picture();
+    auto   logo_layer   = tvg::Scene::gen();
+    if(!logo_picture || !logo_layer || _canvas->push(logo_layer) != tvg::Result::Success ||
+       logo_layer->push(logo_picture) != tvg::Result::Success)
+        return false;
+    _scene.logo_layer   = logo_layer;
+    _scene.logo_reduced = false;
+
+    if(!_poster.pixels.empty()) {
+        auto poster = tvg::Picture::gen();
+        if(!poster || _canvas->push(poster) != tvg::Result::Success)
+            return false;
+
+        if(poster->load(_poster.pixels.data(),
+                        static_cast<uint32_t>(_poster.width),
+                        static_cast<uint32_t>(_poster.height),
+                        tvg::ColorSpace::ARGB8888,
+                        false) != tvg::Result::Success)
+            return false;
+
+        poster->size(_window_width * _dpi_scale, _window_height * _dpi_scale);
+        _scene.poster = poster;
+    }
+
+    // The software renderer draws the overlay on a canvas of its own, which is pointed at the surface once its bounds
+    // are known.
+#ifdef THORVG_GL_RASTER_SUPPORT
+    auto * overlay_canvas = _canvas.get();
+#else
+    _overlay.canvas.reset(tvg::SwCanvas::gen());
+    _overlay.drawn.reset();
+    auto * overlay_canvas = _overlay.canvas.get();
+#endif
+    auto overlay        = tvg::Scene::gen();
+    auto bar_background = tvg::Shape::gen();
+    auto bar_fill       = tvg::Shape::gen();
+    if(!overlay_canvas || !overlay || overlay_canvas->push(overlay) != tvg::Result::Success || !bar_background ||
+       overlay->push(bar_background) != tvg::Result::Success || !bar_fill ||
+       overlay->push(bar_fill) != tvg::Result::Success)
         return false;
 
-    const auto now     = std::chrono::steady_clock::now();
-    const auto elapsed = duration_cast<std::chrono::milliseconds>(now - _start_time).count();
+    const auto bar = bar_layout(_window_width, _dpi_scale);
+    bar_background->appendRect(bar.x, bar.y, bar.width, bar.height, bar.corner_radius, bar.corner_radius);
+    bar_background->fill(128, 128, 128, static_cast<uint8_t>(255 * 0.18f));
+    bar_fill->fill(255, 255, 255);
+    _scene.overlay  = overlay;
+    _scene.bar_fill = bar_fill;
+    // The bar is filled on the first frame that draws it.
+    _last_drawn_progress = -1.0f;
+
+    // Copying the family into the styles once keeps the lookups in the text run cache from allocating every frame.
+    _scene.status_message_style = {.family = _loaded_font_family, .size_pt = px_to_pt(12.f * _dpi_scale)};
+    _scene.getting_ready_style  = {.family = _loaded_font_family, .size_pt = px_to_pt(15.f * _dpi_scale)};
+    return true;
+}
+
+void SplashWindow::draw_canvas(FrameInfo & frame) noexcept {
+#ifndef THORVG_GL_RASTER_SUPPORT
+    if(_overdraw.enabled && draw_overdraw_heat_map(frame))
+        return;
+#endif
+    bool drawn = false;
+#ifdef LOTTIE_SPLASH_PROFILING
+    drawn = draw_canvas_profiled();
+#endif
+    if(!drawn) {
+        _canvas->update();
+        _canvas->draw(true);
+        _canvas->sync();
+    }
+#ifndef THORVG_GL_RASTER_SUPPORT
+    composite_overlay();
+#endif
+}
 
-    if(_logo_animation->duration() <= 0.0f)
+#ifndef THORVG_GL_RASTER_SUPPORT
+bool SplashWindow::draw_overdraw_heat_map(FrameInfo & frame) noexcept {
+    if(!_canvas_pixels)
         return false;
 
-    const float animation_progress =
-      (elapsed % static_cast<int>(_logo_animation->duration() * 1000)) / (_logo_animation->duration() * 1000.0f);
+    const auto width  = static_cast<size_t>(_window_width * _dpi_scale);
+    const auto height = static_cast<size_t>(_window_height * _dpi_scale);
+    if(_overdraw.map.area() != width * height)
+        frame.scene_changed = true;
+    _overdraw.map.reset(width, height);
+
+    // thorvg only hands out const paints of the animation. They're hidden and restored within this frame, like the
+    // ones owned here.
+    auto &       pieces    = _overdraw.pieces;
+    const size_t capacity  = pieces.capacity();
+    const auto   add_piece = [&](tvg::Paint * paint, const bool composed) {
+        if(paint)
+            pieces.push_back({paint, paint->opacity(), composed});
+    };
+    pieces.clear();
+    add_piece(_scene.poster, false);
+    add_piece(_scene.static_below, false);
+    add_piece(_scene.static_above, false);
+    if(!_scene.logo_reduced && _overdraw.layers_complete) {
+        for(const auto & layer : _overdraw.layers)
+            add_piece(const_cast<tvg::Paint *>(_logo_animation->picture()->paint(layer.id)), layer.composed);
+    } else
+        add_piece(_scene.logo_layer, false);
+    if(pieces.capacity() != capacity)
+        frame.scene_changed = true;
+
+    for(const auto & piece : pieces)
+        piece.paint->opacity(0);
+
+    // Clearing the canvas writes every pixel once, it's what used to be the background fill.
+    _overdraw.map.add_everywhere();
+    for(const auto & piece : pieces) {
+        piece.paint->opacity(piece.opacity);
+        _canvas->update();
+        _canvas->draw(true);
+        _canvas->sync();
+        _overdraw.map.add_coverage(_canvas_pixels, width);
+
+        // The offscreen buffer of a matte or mask covers the layer's bounds, and gets blended onto the canvas.
+        float x;
+        float y;
+        float w;
+        float h;
+        if(piece.composed && piece.paint->bounds(&x, &y, &w, &h) == tvg::Result::Success)
+            _overdraw.map.add_area(x, y, w, h);
+        piece.paint->opacity(0);
+    }
+
+    for(const auto & piece : pieces)
+        piece.paint->opacity(piece.opacity);
+    // The overlay is blended from its surface, which reads and writes every pixel of its bounds.
+    if(_overlay.visible)
+        _overdraw.map.add_area(_overlay.x, _overlay.y, _overlay.width, _overlay.height);
+    _overdraw.map.colorize(_canvas_pixels, width);
+
+    frame.overdraw_pixel_writes  = _overdraw.map.pixel_writes();
+    frame.overdraw_canvas_pixels = _overdraw.map.area();
+    return true;
+}
+#endif
 
-    if(_logo_animation->frame(_logo_animation->totalFrame() * animation_progress) != tvg::Result::Success)
+#ifdef LOTTIE_SPLASH_PROFILING
+bool SplashWindow::draw_canvas_profiled() noexcept {
+    // The reduced logo is drawn by its own canvas, leaving nothing of the animation to compare in this one.
+    if(_scene.logo_reduced || _profiled_layer_ids.empty())
         return false;
 
-    auto logo_picture = _logo_animation->picture();
-    if(!logo_picture)
+    // Layers outside their in and out points have no paint in this frame. thorvg only hands out const paints, hiding
+    // one for a single render and restoring it is all the profiler does with it.
+    const size_t layer = _layer_profiler.next_layer();
+    auto *       paint = const_cast<tvg::Paint *>(_logo_animation->picture()->paint(_profiled_layer_ids[layer]));
+    if(!paint)
         return false;
 
-    auto dup_logo_picture = logo_picture->duplicate();
-    if(!dup_logo_picture)
+    const auto draw = [this] {
+        const auto                   start = std::chrono::steady_clock::now();
+        utils::LayerProfiler::Timing timing;
+        _canvas->update();
+        const auto drawn = std::chrono::steady_clock::now();
+        _canvas->draw(true);
+        _canvas->sync();
+        timing.update = drawn - start;
+        timing.draw   = std::chrono::steady_clock::now() - drawn;
+        return timing;
+    };
+
+    // The render without the layer goes first, so the frame that stays in the buffer is the complete one.
+    const auto opacity = paint->opacity();
+    paint->opacity(0);
+    const auto without_layer = draw();
+    paint->opacity(opacity);
+    _layer_profiler.record(layer, without_layer, draw());
+    _profiling_render_time += without_layer.update + without_layer.draw;
+    return true;
+}
+#endif
+
+bool SplashWindow::update_logo(bool reduce, const bool animate, FrameInfo & frame) noexcept {
+    if(reduce && !_reduced_logo.canvas) {
+        // Falls back to the full resolution logo when the reduced one can't be drawn.
+        reduce              = create_reduced_logo();
+        frame.scene_changed = true;
+    }
+
+    if(reduce != _scene.logo_reduced) {
+        auto * logo_picture = _logo_animation->picture();
+        auto * from         = reduce ? _scene.logo_layer : _reduced_logo.logo_scene;
+        auto * to           = reduce ? _reduced_logo.logo_scene : _scene.logo_layer;
+
+        // The animation holds its own reference to the picture, so taking it out of a scene doesn't delete it. At full
+        // resolution, it goes below the bitmap of the static layers above it.
+        if(!logo_picture || from->remove(logo_picture) != tvg::Result::Success ||
+           to->push(logo_picture, reduce ? nullptr : _scene.static_above) != tvg::Result::Success)
+            return false;
+
+        _scene.reduced_logo->opacity(reduce ? 255 : 0);
+        _scene.logo_reduced     = reduce;
+        _reduced_logo.has_frame = false;
+        frame.scene_changed     = true;
+    }
+
+#ifndef THORVG_GL_RASTER_SUPPORT
+    update_static_layers(frame);
+#endif
+    return !reduce || (!animate && _reduced_logo.has_frame) || draw_reduced_logo(frame);
+}
+
+bool SplashWindow::create_reduced_logo() noexcept {
+#ifdef THORVG_GL_RASTER_SUPPORT
+    return false;
+#else
+    const utils::memory::Phase phase{utils::memory::Subsystem::FrameCache};
+
+    const int width  = static_cast<int>(_window_width * _dpi_scale);
+    const int height = static_cast<int>(_window_height * _dpi_scale);
+
+    auto & reduced = _reduced_logo;
+    reduced.width  = (width + 1) / 2;
+    reduced.height = (height + 1) / 2;
+    reduced.pixels.resize(static_cast<size_t>(reduced.width) * reduced.height);
+    reduced.upscaled.resize(static_cast<size_t>(width) * height);
+    reduced.canvas.reset(tvg::SwCanvas::gen());
+
+    auto logo_scene = tvg::Scene::gen();
+    if(!reduced.canvas ||
+       reduced.canvas->target(
+         reduced.pixels.data(), reduced.width, reduced.width, reduced.height, tvg::ColorSpace::ARGB8888) !=
+         tvg::Result::Success ||
+       !logo_scene || reduced.canvas->push(logo_scene) != tvg::Result::Success) {
+        reduced = {};
         return false;
+    }
+    // The scene scale applies on top of the logo's own DPI scale and placement.
+    logo_scene->scale(0.5f);
 
-    if(scene->push(std::move(dup_logo_picture)) != tvg::Result::Success)
+    // Hidden until update_logo moves the logo into the reduced canvas.
+    auto picture = tvg::Picture::gen();
+    if(!picture || _scene.logo_layer->push(picture) != tvg::Result::Success) {
+        reduced = {};
+        return false;
+    }
+    picture->opacity(0);
+    if(picture->load(reduced.upscaled.data(),
+                     static_cast<uint32_t>(width),
+                     static_cast<uint32_t>(height),
+                     tvg::ColorSpace::ARGB8888,
+                     false) != tvg::Result::Success) {
+        _scene.logo_layer->remove(picture);
+        reduced = {};
         return false;
+    }
+
+    reduced.logo_scene  = logo_scene;
+    _scene.reduced_logo = picture;
+    return true;
+#endif
+}
 
-    if(_current_state.progress > 0.0f || !_current_state.status_message.empty()) {
-        auto overlay_scene = tvg::Scene::gen();
-        if(!overlay_scene)
+bool SplashWindow::draw_reduced_logo(FrameInfo & frame) noexcept {
+    auto & reduced = _reduced_logo;
+    {
+        const utils::memory::Phase   phase{utils::memory::Subsystem::Rasterizer};
+        const utils::AllocationScope engine_allocations;
+        if(reduced.canvas->update() != tvg::Result::Success || reduced.canvas->draw(true) != tvg::Result::Success ||
+           reduced.canvas->sync() != tvg::Result::Success)
             return false;
+        frame.engine_heap_allocations += engine_allocations.count();
+    }
 
-        constexpr float BASE_BAR_WIDTH         = 245.f;
-        constexpr float BASE_BAR_HEIGHT        = 6.f;
-        constexpr float BASE_BAR_CORNER_RADIUS = 3.f;
-        constexpr float BASE_BAR_Y             = 243.f;
-        constexpr float BASE_STATUS_MESSAGE_Y  = 257.f;
-        constexpr float BASE_GETTING_READY_Y   = 200.f;
-        constexpr float BASE_X                 = 110.f;
-
-        const float BAR_WIDTH         = BASE_BAR_WIDTH * _dpi_scale;
-        const float BAR_HEIGHT        = BASE_BAR_HEIGHT * _dpi_scale;
-        const float BAR_CORNER_RADIUS = BASE_BAR_CORNER_RADIUS * _dpi_scale;
-        const float bar_x             = (_window_width * _dpi_scale - BAR_WIDTH) * .5f;
-        const float bar_y             = BASE_BAR_Y * _dpi_scale;
-
-        if(!_current_state.status_message.empty()) {
-            auto text = tvg::Text::gen();
-            auto fill = tvg::LinearGradient::gen();
-            if(!text || !fill)
-                return false;
+    const int width  = static_cast<int>(_window_width * _dpi_scale);
+    const int height = static_cast<int>(_window_height * _dpi_scale);
+    utils::upscale_2x(reduced.pixels.data(), reduced.width, reduced.height, reduced.upscaled.data(), width, height);
+    reduced.has_frame = true;
+
+    // thorvg doesn't see writes to pixels it doesn't own, so the picture is pointed at them again.
+    frame.scene_changed = true;
+    return _scene.reduced_logo->load(reduced.upscaled.data(),
+                                     static_cast<uint32_t>(width),
+                                     static_cast<uint32_t>(height),
+                                     tvg::ColorSpace::ARGB8888,
+                                     false) == tvg::Result::Success;
+}
+
+#ifndef THORVG_GL_RASTER_SUPPORT
+void SplashWindow::update_static_layers(FrameInfo & frame) noexcept {
+    auto & cache = _static_layers;
+    if(cache.layers.empty())
+        return;
+
+    const int  width  = static_cast<int>(_window_width * _dpi_scale);
+    const int  height = static_cast<int>(_window_height * _dpi_scale);
+    const bool drawn  = (_scene.static_below || _scene.static_above) && cache.width == width && cache.height == height;
+
+    // The reduced logo renders the animation on a canvas of its own, which doesn't have the bitmaps.
+    bool use_bitmaps = !_scene.logo_reduced;
+    bool failed      = false;
+    if(use_bitmaps && !drawn) {
+        frame.scene_changed = true;
+        failed              = !draw_static_layers();
+        use_bitmaps         = !failed;
+    }
+
+    // thorvg rebuilds the layers' paints when it updates the animation, so they're hidden again every frame.
+    auto * logo_picture = _logo_animation->picture();
+    for(const StaticLayerRun * run : {&cache.below, &cache.above}) {
+        if(!use_bitmaps && !cache.opacities_known)
+            break;
+        for(size_t i = run->first; i < run->first + run->count; ++i) {
+            const auto & layer = cache.layers[i];
+            if(auto * paint = const_cast<tvg::Paint *>(logo_picture->paint(layer.id)))
+                paint->opacity(use_bitmaps ? 0 : layer.opacity);
+        }
+    }
+    for(auto * bitmap : {_scene.static_below, _scene.static_above}) {
+        if(bitmap)
+            bitmap->opacity(use_bitmaps ? 255 : 0);
+    }
+    frame.cached_static_layers = use_bitmaps ? cache.below.count + cache.above.count : 0;
 
-            text->font(_loaded_font_family.c_str(), px_to_pt(12.f * _dpi_scale));
+    // Gives up for good after the layers are back, rather than trying again every frame.
+    if(failed)
+        cache.layers.clear();
+}
 
-            constexpr tvg::Fill::ColorStop STATUS_MESSAGE_COLOR = {.offset = 0, .r = 255, .g = 255, .b = 255, .a = 182};
-            const std::array<tvg::Fill::ColorStop, 2> colorStops = {STATUS_MESSAGE_COLOR, STATUS_MESSAGE_COLOR};
-            fill->linear(0, 0, 1, 1);
-            fill->colorStops(colorStops.data(), static_cast<uint32_t>(colorStops.size()));
-            text->fill(std::move(fill));
+bool SplashWindow::draw_static_layers() noexcept {
+    const utils::memory::Phase phase{utils::memory::Subsystem::FrameCache};
+
+    auto &    cache        = _static_layers;
+    auto *    logo_picture = _logo_animation->picture();
+    const int width        = static_cast<int>(_window_width * _dpi_scale);
+    const int height       = static_cast<int>(_window_height * _dpi_scale);
+
+    // Layers outside their in and out points have no paint. thorvg only hands out const paints, they're hidden for the
+    // draws below and restored, like the profiler does.
+    std::pmr::vector<uint8_t> opacities{&_frame_arena};
+    for(auto & layer : cache.layers) {
+        const auto * paint = logo_picture->paint(layer.id);
+        opacities.push_back(paint ? paint->opacity() : 0);
+        if(!cache.opacities_known)
+            layer.opacity = opacities.back();
+    }
+    cache.opacities_known = true;
+
+    // Like the reduced logo, the animation is moved into a canvas of its own to be drawn there.
+    std::unique_ptr<tvg::SwCanvas> canvas{tvg::SwCanvas::gen()};
+    auto                           scene = tvg::Scene::gen();
+    if(!canvas || !scene || canvas->push(scene) != tvg::Result::Success ||
+       _scene.logo_layer->remove(logo_picture) != tvg::Result::Success)
+        return false;
 
-            text->text(reinterpret_cast<const char *>(_current_state.status_message.c_str()));
+    bool drawn = scene->push(logo_picture) == tvg::Result::Success;
+    for(StaticLayerRun * run : {&cache.below, &cache.above}) {
+        if(!drawn || !run->count)
+            continue;
 
-            const float status_message_x = bar_x;
-            const float status_message_y = BASE_STATUS_MESSAGE_Y * _dpi_scale;
-            text->translate(status_message_x, status_message_y);
-            overlay_scene->push(std::move(text));
+        for(size_t i = 0; i < cache.layers.size(); ++i) {
+            const bool in_run = i >= run->first && i < run->first + run->count;
+            if(auto * paint = const_cast<tvg::Paint *>(logo_picture->paint(cache.layers[i].id)))
+                paint->opacity(in_run ? cache.layers[i].opacity : 0);
         }
+        run->pixels.resize(static_cast<size_t>(width) * height);
+        drawn = canvas->target(run->pixels.data(), width, width, height, tvg::ColorSpace::ARGB8888) ==
+                  tvg::Result::Success &&
+                canvas->update() == tvg::Result::Success && canvas->draw(true) == tvg::Result::Success &&
+                canvas->sync() == tvg::Result::Success;
+    }
 
-        const float progress_bar_progress = get_interpolated_progress();
-        auto        bg                    = tvg::Shape::gen();
-        if(!bg)
-            return false;
+    for(size_t i = 0; i < cache.layers.size(); ++i) {
+        if(auto * paint = const_cast<tvg::Paint *>(logo_picture->paint(cache.layers[i].id)))
+            paint->opacity(opacities[i]);
+    }
+    // The animation holds its own reference to the picture, so taking it out of the scene doesn't delete it. It goes
+    // back below the bitmap of the layers above it.
+    scene->remove(logo_picture);
+    if(_scene.logo_layer->push(logo_picture, _scene.static_above) != tvg::Result::Success || !drawn)
+        return false;
+
+    const auto load_bitmap = [&](tvg::Picture *& bitmap, StaticLayerRun & run, tvg::Paint * at) {
+        if(!run.count)
+            return true;
+        if(!bitmap) {
+            auto picture = tvg::Picture::gen();
+            if(!picture || _scene.logo_layer->push(picture, at) != tvg::Result::Success)
+                return false;
+            bitmap = picture;
+        }
+        // thorvg doesn't see writes to pixels it doesn't own, so the picture is pointed at them again.
+        return bitmap->load(run.pixels.data(),
+                            static_cast<uint32_t>(width),
+                            static_cast<uint32_t>(height),
+                            tvg::ColorSpace::ARGB8888,
+                            false) == tvg::Result::Success;
+    };
+    if(!load_bitmap(_scene.static_below, cache.below, logo_picture) ||
+       !load_bitmap(_scene.static_above, cache.above, nullptr))
+        return false;
+
+    cache.width  = width;
+    cache.height = height;
+    return true;
+}
+
+bool SplashWindow::update_overlay_surface(FrameInfo & frame) noexcept {
+    auto & overlay  = _overlay;
+    overlay.visible = false;
+    if(!frame.overlay_drawn)
+        return true;
 
-        bg->appendRect(bar_x, bar_y, BAR_WIDTH, BAR_HEIGHT, BAR_CORNER_RADIUS, BAR_CORNER_RADIUS);
-        bg->fill(128, 128, 128, static_cast<uint8_t>(255 * 0.18f));
-        overlay_scene->push(std::move(bg));
+    const auto visible_run = [](const TextSlot & slot) {
+        return slot.picture && slot.picture->opacity() ? slot.run_id : 0;
+    };
+    const auto thorvg_text = [](const TextSlot & slot) { return slot.text && slot.text->opacity(); };
+
+    const OverlayInputs inputs{
+      .status_message_run = visible_run(_scene.status_message),
+      .getting_ready_run  = visible_run(_scene.getting_ready),
+      .progress           = _last_drawn_progress,
+      .thorvg_text        = thorvg_text(_scene.status_message) || thorvg_text(_scene.getting_ready),
+    };
+    if(overlay.drawn == inputs && !inputs.thorvg_text) {
+        overlay.visible = overlay.width && overlay.height;
+        return true;
+    }
+    overlay.drawn.reset();
+    frame.overlay_redrawn = true;
+
+    // The bounds change with the messages. They're measured where the overlay is laid out and rounded out to whole
+    // pixels, so the surface lines up with the canvas.
+    const int canvas_width  = static_cast<int>(_window_width * _dpi_scale);
+    const int canvas_height = static_cast<int>(_window_height * _dpi_scale);
+    float     x;
+    float     y;
+    float     w;
+    float     h;
+    _scene.overlay->translate(0.0f, 0.0f);
+    if(_scene.overlay->bounds(&x, &y, &w, &h) != tvg::Result::Success)
+        return false;
+    const int left   = std::clamp(static_cast<int>(std::floor(x)), 0, canvas_width);
+    const int top    = std::clamp(static_cast<int>(std::floor(y)), 0, canvas_height);
+    const int right  = std::clamp(static_cast<int>(std::ceil(x + w)), left, canvas_width);
+    const int bottom = std::clamp(static_cast<int>(std::ceil(y + h)), top, canvas_height);
+    if(right == left || bottom == top) {
+        overlay.width  = 0;
+        overlay.height = 0;
+        overlay.drawn  = inputs;
+        return true;
+    }
 
-        auto fill = tvg::Shape::gen();
-        if(!fill)
+    // The canvas is only pointed at the surface again when its size changed, which is also when it may have moved.
+    const int    width  = right - left;
+    const int    height = bottom - top;
+    const size_t size   = static_cast<size_t>(width) * height;
+    if(size > overlay.pixels.size() || width != overlay.width || height != overlay.height) {
+        const utils::memory::Phase phase{utils::memory::Subsystem::FrameCache};
+        overlay.pixels.resize(std::max(size, overlay.pixels.size()));
+        if(overlay.canvas->target(overlay.pixels.data(), width, width, height, tvg::ColorSpace::ARGB8888) !=
+           tvg::Result::Success)
             return false;
+        frame.scene_changed = true;
+    }
+    overlay.x      = left;
+    overlay.y      = top;
+    overlay.width  = width;
+    overlay.height = height;
+    _scene.overlay->translate(static_cast<float>(-left), static_cast<float>(-top));
+
+    const utils::memory::Phase   phase{utils::memory::Subsystem::Rasterizer};
+    const utils::AllocationScope engine_allocations;
+
+    const bool drawn = overlay.canvas->update() == tvg::Result::Success &&
+                       overlay.canvas->draw(true) == tvg::Result::Success &&
+                       overlay.canvas->sync() == tvg::Result::Success;
+    frame.engine_heap_allocations += engine_allocations.count();
+    if(!drawn)
+        return false;
+
+    overlay.drawn   = inputs;
+    overlay.visible = true;
+    return true;
+}
+
+void SplashWindow::composite_overlay() noexcept {
+    const auto & overlay = _overlay;
+    if(!overlay.visible || !_canvas_pixels)
+        return;
+
+    const auto stride = static_cast<size_t>(_window_width * _dpi_scale);
+    utils::blend_over(_canvas_pixels + overlay.y * stride + overlay.x,
+                      stride,
+                      overlay.pixels.data(),
+                      static_cast<size_t>(overlay.width),
+                      overlay.width,
+                      overlay.height);
+}
+#endif
+
+bool SplashWindow::update_text(TextSlot &                  slot,
+                               const TextRunCache::Run *   run,
+                               const TextRunCache::Style & style,
+                               const std::u8string_view    message,
+                               const float                 x,
+                               const float                 y,
+                               const uint8_t               opacity,
+                               FrameInfo &                 frame) noexcept {
+    // An empty message hides the slot.
+    if(message.empty()) {
+        if(slot.picture)
+            slot.picture->opacity(0);
+        if(slot.text)
+            slot.text->opacity(0);
+        return true;
+    }
 
-        const float filled_width = BAR_WIDTH * progress_bar_progress;
-        fill->appendRect(bar_x, bar_y, filled_width, BAR_HEIGHT, BAR_CORNER_RADIUS, BAR_CORNER_RADIUS);
-        fill->fill(255, 255, 255);
-        overlay_scene->push(std::move(fill));
-
-        const char8_t * GETTING_READY_MESSAGE = u8"Getting Ready...";
-        if(auto getting_ready_text = tvg::Text::gen()) {
-            getting_ready_text->font(_loaded_font_family.c_str(), px_to_pt(15.f * _dpi_scale));
-            getting_ready_text->text(reinterpret_cast<const char *>(GETTING_READY_MESSAGE));
-            getting_ready_text->fill(255, 255, 255);
-            getting_ready_text->translate(BASE_X * _dpi_scale, BASE_GETTING_READY_Y * _dpi_scale);
-            overlay_scene->push(std::move(getting_ready_text));
+    if(run && run->id != slot.run_id) {
+        if(!slot.picture) {
+            auto picture = tvg::Picture::gen();
+            if(!picture || _scene.overlay->push(picture) != tvg::Result::Success)
+                return false;
+            slot.picture = picture;
         }
 
-        scene->push(std::move(overlay_scene));
+        // The pixels outlive the picture's use of them, any run evicted from the cache gets a new id here first.
+        if(slot.picture->load(const_cast<uint32_t *>(run->pixels.data()),
+                              static_cast<uint32_t>(run->width),
+                              static_cast<uint32_t>(run->height),
+                              tvg::ColorSpace::ARGB8888,
+                              false) != tvg::Result::Success)
+            return false;
+
+        slot.picture->translate(std::round(x) + run->origin_x, std::round(y) + run->origin_y);
+        slot.run_id         = run->id;
+        frame.scene_changed = true;
     }
 
-    _canvas->push(std::move(scene));
-    _canvas->update();
-    _canvas->draw();
-    _canvas->sync();
+    if(!run && !slot.text) {
+        auto text = tvg::Text::gen();
+        if(!text || _scene.overlay->push(text) != tvg::Result::Success)
+            return false;
 
-#ifdef THORVG_GL_RASTER_SUPPORT
-    SwapBuffers(_hdc.get());
-#else
-    BitBlt(_hdc.get(),
-           0,
-           0,
-           static_cast<int>(_window_width * _dpi_scale),
-           static_cast<int>(_window_height * _dpi_scale),
-           _memdc.get(),
-           0,
-           0,
-           SRCCOPY);
-#endif
+        text->font(style.family.c_str(), style.size_pt);
+        text->fill(style.r, style.g, style.b);
+        text->translate(x, y);
+        slot.text           = text;
+        frame.scene_changed = true;
+    }
 
+    if(slot.picture)
+        slot.picture->opacity(run ? opacity : 0);
+    if(slot.text) {
+        slot.text->opacity(run ? 0 : opacity);
+        // No software engine to rasterize into, so thorvg lays out the text every frame.
+        if(!run)
+            slot.text->text(reinterpret_cast<const char *>(std::pmr::u8string{message, &_frame_arena}.c_str()));
+    }
     return true;
 }
 
@@ -6,24 +6,132 @@
 #include <string>
 #include <chrono>
 #include <atomic>
+#include <array>
+#include <filesystem>
+#include <optional>
+#include <vector>
 
 #include <Windows.h>
 
 #include "win32_resource_deleters.hpp"
+#include "text_run_cache.hpp"
+#include "utils/animation_timeline.hpp"
+#include "utils/clock.hpp"
+#include "utils/frame_arena.hpp"
+#include "utils/layer_profiler.hpp"
+#include "utils/message_template.hpp"
+#include "utils/overdraw_map.hpp"
+#include "utils/progress_tasks.hpp"
+#include "utils/progress_spring.hpp"
+#include "utils/quality_governor.hpp"
+#include "utils/win32_visibility.hpp"
 
 class SplashWindow final {
   public:
+    struct InitOptions {
+        // Premultiplied ARGB8888 image blitted into the window before the animation is parsed.
+        const uint32_t * poster_pixels = nullptr;
+        int              poster_width  = 0;
+        int              poster_height = 0;
+        // When set, the poster is loaded from this file if no pixels are given, and the first live frame is stored
+        // there for the next run.
+        std::wstring poster_cache_path;
+        // Optional TrueType font buffer, copied by thorvg. Takes precedence over the font search paths.
+        const char * font_data      = nullptr;
+        size_t       font_data_size = 0;
+        // Font files tried in order. Platform defaults are used when empty.
+        std::vector<std::filesystem::path> font_search_paths;
+        // Animation time only moves through advance_clock, which makes every frame reproducible.
+        bool virtual_clock = false;
+        // Only whole animation frames are shown, for animations that were only checked at whole frames.
+        bool quantize_frames = false;
+    };
+
+    struct Stats {
+        std::chrono::nanoseconds time_to_first_pixel{};
+        std::chrono::nanoseconds time_to_first_frame{};
+        uint64_t                 frames_rendered = 0;
+        // Frames in which the progress bar moved, stays flat once the bar settled.
+        uint64_t progress_bar_updates = 0;
+        // Frames which rasterized the progress bar and the messages. The software renderer keeps them in a surface of
+        // their own and only draws them again when they changed, the OpenGL one draws them with every frame.
+        uint64_t overlay_redraws = 0;
+        // Frame deadlines skipped because a frame took too long, and the worst delay of a frame that was still drawn.
+        uint64_t                 dropped_frames = 0;
+        std::chrono::nanoseconds max_frame_lateness{};
+        // Animation frames drawn again in the next window frame, and animation frames never drawn at all.
+        uint64_t repeated_source_frames = 0;
+        uint64_t skipped_source_frames  = 0;
+        // Picked by the quality governor after each frame.
+        utils::QualityGovernor::Level quality_level         = utils::QualityGovernor::Level::Full;
+        uint64_t                      quality_level_changes = 0;
+        // Fraction of one core used by the render thread and thorvg's workers, measured over the last half second.
+        double cpu_usage = 0.0;
+        // Nothing is rendered while the window is minimized, cloaked, off-screen or the session is locked.
+        uint64_t                 times_hidden = 0;
+        std::chrono::nanoseconds hidden_time{};
+        // Heap allocations by lottie_splash itself in frames that kept the scene's structure, which should stay 0, and
+        // by thorvg on the render thread in the last frame. Only counted in builds with --with-allocation-counter.
+        uint64_t steady_frame_heap_allocations = 0;
+        uint64_t engine_frame_heap_allocations = 0;
+        // Whether the animation contains expressions, found by scanning it before thorvg parses it. Unless the library
+        // was built with --without-expressions, the load time includes starting the expression engine and its heap is
+        // reserved.
+        bool                     uses_expressions = false;
+        std::chrono::nanoseconds animation_load_time{};
+        uint64_t                 expression_heap_bytes = 0;
+        // Pixel writes summed over the last frame drawn as an overdraw heat map, and the canvas area they're spread
+        // over. Both stay 0 until the heat map is shown.
+        uint64_t overdraw_pixel_writes  = 0;
+        uint64_t overdraw_canvas_pixels = 0;
+        // Top level layers of the animation which never change, drawn from bitmaps rendered once instead of being
+        // rasterized in the last frame.
+        uint64_t cached_static_layers = 0;
+        // Progress the bar moves towards in the last frame, set directly or aggregated from the tasks, and the progress
+        // it was drawn at.
+        float progress_target    = 0.0f;
+        float displayed_progress = 0.0f;
+    };
+
     explicit SplashWindow(std::pair<int, int> dimensions) noexcept;
     ~SplashWindow() noexcept;
 
-    bool init(const char * lottie_data, size_t data_size, const wchar_t * window_title) noexcept;
-    bool run_message_loop() noexcept;
-    void set_status_message(const char8_t * message) noexcept;
-    void set_progress(float progress) noexcept;
-    bool wait_until_closed(const unsigned timeout_ms = 3000) noexcept;
-    void request_close() noexcept;
-    void show() const noexcept;
-    bool is_initialized() const noexcept;
+    bool  init(const char *        lottie_data,
+               size_t              data_size,
+               const wchar_t *     window_title,
+               const InitOptions & options) noexcept;
+    bool  run_message_loop() noexcept;
+    void  set_status_message(const char8_t * message) noexcept;
+    void  set_progress(float progress) noexcept;
+    bool  wait_until_closed(const unsigned timeout_ms = 3000) noexcept;
+    void  request_close() noexcept;
+    void  show() const noexcept;
+    bool  is_initialized() const noexcept;
+    Stats stats() const noexcept;
+
+    // Registered messages are immutable, so switching between them is a single atomic store. They may contain "{N}"
+    // placeholders, which the render thread replaces with counter N whenever it draws a frame.
+    std::optional<uint32_t> register_message(const char8_t * message) noexcept;
+    bool                    set_status_message_id(uint32_t id) noexcept;
+    bool                    set_counter(uint32_t slot, uint64_t value) noexcept;
+
+    // Rendering is throttled to stay within this fraction of one core. Can be called from any thread.
+    bool set_cpu_budget(double share_of_one_core) noexcept;
+
+    // Replaces the splash with a heat map of how often each pixel is written per frame. Returns false for the OpenGL
+    // canvas, whose pixels can't be read back cheaply.
+    bool set_overdraw_heat_map(bool enabled) noexcept;
+
+    // Returns false unless the window was initialized with a virtual clock.
+    bool advance_clock(std::chrono::nanoseconds delta) noexcept;
+
+    // Once a task is added, the progress bar follows the weighted task progress instead of set_progress.
+    utils::ProgressTasks::Task * add_task(float weight) noexcept { return _tasks.add(weight); }
+
+#ifdef LOTTIE_SPLASH_PROFILING
+    // Per-layer render cost, gathered on every full resolution frame.
+    const utils::LayerProfiler & layer_profiler() const noexcept { return _layer_profiler; }
+#endif
 
     enum class InitError {
         None,
@@ -36,22 +144,72 @@ class SplashWindow final {
     } _last_error = InitError::None;
 
   private:
+    struct FrameInfo {
+        bool overlay_drawn      = false;
+        bool overlay_redrawn    = false;
+        bool poster_drawn       = false;
+        bool progress_bar_moved = false;
+        // Paints were created, removed, moved or got new pixels, which is allowed to allocate.
+        bool     scene_changed           = false;
+        uint64_t heap_allocations        = 0;
+        uint64_t engine_heap_allocations = 0;
+        uint64_t cached_static_layers    = 0;
+        // Only set when the frame was drawn as an overdraw heat map.
+        uint64_t overdraw_pixel_writes  = 0;
+        uint64_t overdraw_canvas_pixels = 0;
+    };
+
+    // Text drawn from a cached run, or laid out by thorvg when runs can't be rasterized.
+    struct TextSlot {
+        tvg::Picture * picture = nullptr;
+        tvg::Text *    text    = nullptr;
+        uint64_t       run_id  = 0;
+    };
+
     bool render() noexcept;
     bool init_window(const wchar_t * window_title) noexcept;
 #ifdef THORVG_GL_RASTER_SUPPORT
     bool init_opengl() noexcept;
 #endif
-    bool  init_thorvg(const char * lottie_data, const size_t data_size) noexcept;
-    bool  init_thorvg_common(const char * lottie_data, size_t data_size) noexcept;
-    bool  init_fonts() noexcept;
+    bool  init_thorvg(const char * lottie_data, const size_t data_size, const InitOptions & options) noexcept;
+    bool  init_thorvg_common(const char * lottie_data, size_t data_size, bool quantize_frames) noexcept;
+    bool  init_fonts(const InitOptions & options) noexcept;
+    void  init_poster(const InitOptions & options, const char * lottie_data, size_t data_size) noexcept;
+    void  present_poster() noexcept;
+    bool  build_scene() noexcept;
+    bool  update_poster_crossfade(FrameInfo & frame) noexcept;
+    bool  update_logo(bool reduce, bool animate, FrameInfo & frame) noexcept;
+    bool  create_reduced_logo() noexcept;
+    bool  draw_reduced_logo(FrameInfo & frame) noexcept;
+    void  on_frame_presented(const FrameInfo & frame) noexcept;
+    bool  update_text(TextSlot &                  slot,
+                      const TextRunCache::Run *   run,
+                      const TextRunCache::Style & style,
+                      std::u8string_view          message,
+                      float                       x,
+                      float                       y,
+                      uint8_t                     opacity,
+                      FrameInfo &                 frame) noexcept;
     void  cleanup() noexcept;
-    float get_interpolated_progress() noexcept;
+    void  retarget_progress_locked(float progress) noexcept;
+    void  draw_canvas(FrameInfo & frame) noexcept;
+#ifndef THORVG_GL_RASTER_SUPPORT
+    bool  draw_overdraw_heat_map(FrameInfo & frame) noexcept;
+    void  update_static_layers(FrameInfo & frame) noexcept;
+    bool  draw_static_layers() noexcept;
+    bool  update_overlay_surface(FrameInfo & frame) noexcept;
+    void  composite_overlay() noexcept;
+#endif
+#ifdef LOTTIE_SPLASH_PROFILING
+    bool  draw_canvas_profiled() noexcept;
+#endif
 
     static LRESULT CALLBACK StaticWindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam) noexcept;
     LRESULT                 HandleMessage(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam) noexcept;
 
-    std::string _loaded_font_family;
-    float       _dpi_scale = 1.0f;
+    std::string  _loaded_font_family;
+    float        _dpi_scale = 1.0f;
+    TextRunCache _text_runs{8};
 
     mutable std::mutex _state_mutex;
     std::atomic_bool   _is_rendering = false;
@@ -63,12 +221,44 @@ class SplashWindow final {
     WindowState      _pending_state;
     std::atomic_bool _needs_update = false;
 
+    static constexpr uint32_t MAX_REGISTERED_MESSAGES = 1024;
+    static constexpr uint32_t NO_MESSAGE_ID           = UINT32_MAX;
+
+    // A slot is filled before the count publishing it is stored and never changes after, so the render thread reads
+    // registered messages without taking the lock.
+    std::mutex                                                                          _registry_mutex;
+    std::array<std::unique_ptr<const utils::MessageTemplate>, MAX_REGISTERED_MESSAGES> _registered_messages;
+    std::atomic_uint32_t                                                                _registered_message_count = 0;
+
+    std::atomic_uint32_t                                                   _status_message_id = NO_MESSAGE_ID;
+    std::array<std::atomic_uint64_t, utils::MessageTemplate::MAX_COUNTERS> _counters{};
+
+    // Reset at the start of every frame, for data that's only needed while drawing it.
+    utils::FrameArena _frame_arena;
+
+    utils::ProgressTasks _tasks;
+
+    // Written under _state_mutex, the render thread evaluates a copy taken under the same lock.
+    utils::ProgressSpring _progress_spring;
+    float                 _last_drawn_progress = -1.0f;
+
     struct {
-        float                                 start_value      = 0.0f;
-        float                                 target_value     = 0.0f;
-        std::chrono::steady_clock::time_point start_time       = std::chrono::steady_clock::now();
-        bool                                  is_interpolating = false;
-    } _progress_state;
+        std::vector<uint32_t>                  pixels;
+        int                                    width  = 0;
+        int                                    height = 0;
+        std::wstring                           cache_path;
+        uint64_t                               content_hash  = 0;
+        bool                                   needs_caching = false;
+        std::optional<utils::Clock::duration>  crossfade_start;
+    } _poster;
+
+    mutable std::mutex     _stats_mutex;
+    Stats                  _stats;
+    utils::Clock::duration _init_time{};
+
+    // Every timestamp that affects what's drawn comes from _clock. _virtual_clock is set when _clock is virtual.
+    std::unique_ptr<utils::Clock> _clock = std::make_unique<utils::SteadyClock>();
+    utils::VirtualClock *         _virtual_clock = nullptr;
 
     struct {
         bool thorvg_initialized = false;
@@ -87,7 +277,123 @@ class SplashWindow final {
     std::unique_ptr<HDC__, DCDeleter> _memdc;
     std::unique_ptr<tvg::SwCanvas>    _canvas;
 #endif
-    std::unique_ptr<tvg::Animation>       _logo_animation;
-    std::chrono::steady_clock::time_point _start_time;
-    std::atomic_bool                      _close_requested = false;
+    // Only set for the software canvas.
+    uint32_t * _canvas_pixels = nullptr;
+
+    // Built on the first frame and owned by the canvas. Later frames only change properties, so steady frames reuse
+    // thorvg's paints along with their path and image buffers instead of generating new ones.
+    struct {
+        tvg::Scene *        logo_layer   = nullptr;
+        tvg::Picture *      reduced_logo = nullptr;
+        tvg::Picture *      poster       = nullptr;
+        // Bitmaps of the static layers below and above the animated ones.
+        tvg::Picture *      static_below = nullptr;
+        tvg::Picture *      static_above = nullptr;
+        tvg::Scene *        overlay      = nullptr;
+        tvg::Shape *        bar_fill     = nullptr;
+        TextSlot            status_message;
+        TextSlot            getting_ready;
+        TextRunCache::Style status_message_style;
+        TextRunCache::Style getting_ready_style;
+        bool                logo_reduced = false;
+    } _scene;
+
+    // Half resolution logo, upscaled into a window sized buffer. The last upscaled frame doubles as the frozen frame.
+    struct {
+        std::unique_ptr<tvg::SwCanvas> canvas;
+        tvg::Scene *                   logo_scene = nullptr;
+        std::vector<uint32_t>          pixels;
+        std::vector<uint32_t>          upscaled;
+        int                            width     = 0;
+        int                            height    = 0;
+        bool                           has_frame = false;
+    } _reduced_logo;
+    std::unique_ptr<tvg::Animation> _logo_animation;
+    utils::AnimationTimeline        _timeline;
+    utils::QualityGovernor          _quality_governor;
+    std::atomic<double>             _cpu_budget = 0.5;
+    std::vector<DWORD>              _worker_thread_ids;
+    utils::Win32VisibilitySource    _visibility_source;
+    std::atomic_bool                _close_requested = false;
+
+#ifndef THORVG_GL_RASTER_SUPPORT
+    // The heat map draws the frame one piece at a time: the poster, each top level layer of the animation and the
+    // overlay's blend. Layers are looked up by id every frame, since thorvg rebuilds their paints.
+    struct OverdrawLayer {
+        uint32_t id = 0;
+        // Drawn through a matte or masks, which takes an offscreen buffer.
+        bool composed = false;
+    };
+    struct OverdrawPiece {
+        tvg::Paint * paint    = nullptr;
+        uint8_t      opacity  = 0;
+        bool         composed = false;
+    };
+    struct {
+        std::atomic_bool           enabled = false;
+        std::vector<OverdrawLayer> layers;
+        // Whether every drawn top level layer is in layers, otherwise the animation is treated as a single piece.
+        bool                       layers_complete = false;
+        std::vector<OverdrawPiece> pieces;
+        utils::OverdrawMap         map;
+    } _overdraw;
+
+    // Top level layers which render the same on every frame are drawn into bitmaps once, and hidden in the animation
+    // while the bitmaps are shown. The animation is a single paint, so only the runs of them at the bottom and the top
+    // of its layer stack can be taken out, to be drawn below and above it.
+    struct StaticLayer {
+        uint32_t id       = 0;
+        bool     constant = false;
+        // The layer's own opacity, restored whenever the bitmaps aren't used. It's as constant as the rest of it.
+        uint8_t opacity = 0;
+    };
+    struct StaticLayerRun {
+        size_t                first = 0;
+        size_t                count = 0;
+        std::vector<uint32_t> pixels;
+    };
+    struct {
+        // Every drawn top level layer, the topmost first. Empty when there's nothing to cache.
+        std::vector<StaticLayer> layers;
+        StaticLayerRun           below;
+        StaticLayerRun           above;
+        bool                     opacities_known = false;
+        // The canvas size the bitmaps were drawn at. They're drawn again when it changes, e.g. with the DPI scale.
+        int width  = 0;
+        int height = 0;
+    } _static_layers;
+
+    // The overlay is drawn into a surface covering just its bounds, and only when something in it changed. Every frame
+    // blends the surface onto the canvas, so frames in which only the logo moves don't rasterize the bar and the text.
+    struct OverlayInputs {
+        // Cached text runs, 0 for a hidden message.
+        uint64_t status_message_run = 0;
+        uint64_t getting_ready_run  = 0;
+        float    progress           = -1.0f;
+        // Text without a cached run is laid out by thorvg every frame, so it's drawn again every frame too.
+        bool thorvg_text = false;
+
+        bool operator==(const OverlayInputs &) const = default;
+    };
+    struct {
+        std::unique_ptr<tvg::SwCanvas> canvas;
+        std::vector<uint32_t>          pixels;
+        std::optional<OverlayInputs>   drawn;
+        // The surface's place on the canvas.
+        int  x       = 0;
+        int  y       = 0;
+        int  width   = 0;
+        int  height  = 0;
+        bool visible = false;
+    } _overlay;
+#endif
+
+#ifdef LOTTIE_SPLASH_PROFILING
+    // thorvg's ids of the profiled layers, in the profiler's order. The paints behind them are rebuilt by every
+    // frame update, so they're looked up each time.
+    std::vector<uint32_t>    _profiled_layer_ids;
+    utils::LayerProfiler     _layer_profiler;
+    // The extra render of the current frame, which the quality governor leaves out.
+    std::chrono::nanoseconds _profiling_render_time{};
+#endif
 };
\ No newline at end of file
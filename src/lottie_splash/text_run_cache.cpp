@@ -0,0 +1,220 @@
+#include "text_run_cache.hpp"
+
+#include "utils/blend.hpp"
+#include "utils/memory.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <climits>
+#include <cmath>
+#include <utility>
+
+const TextRunCache::Run * TextRunCache::get(const Style & style, const std::u8string_view text) noexcept {
+    for(auto it = _runs.begin(); it != _runs.end(); ++it) {
+        if(it->style == style && it->text == text) {
+            _runs.splice(_runs.begin(), _runs, it);
+            return &_runs.front();
+        }
+    }
+
+    Run run{.style = style, .text = std::u8string{text}};
+    if(!rasterize(run))
+        return nullptr;
+    run.id = _next_id++;
+
+    if(_runs.size() >= _capacity)
+        _runs.pop_back();
+    _runs.push_front(std::move(run));
+    return &_runs.front();
+}
+
+const TextRunCache::Run * TextRunCache::get_pinned(const size_t                   slot,
+                                                   const Style &                  style,
+                                                   const utils::MessageTemplate & message,
+                                                   const std::atomic_uint64_t *   counters) noexcept {
+    if(!_digits_rasterized || _digits[0].style != style) {
+        _digits_rasterized = false;
+        if(!rasterize_digits(style))
+            return nullptr;
+        _digits_rasterized = true;
+    }
+
+    if(slot >= _pinned_messages.size())
+        _pinned_messages.resize(slot + 1);
+
+    auto &     pinned   = _pinned_messages[slot];
+    const auto segments = message.segments();
+    if(!pinned || pinned->message != &message || pinned->style != style) {
+        auto rasterized = std::make_unique<PinnedMessage>(PinnedMessage{.message = &message, .style = style});
+        rasterized->literals.resize(segments.size());
+        for(size_t i = 0; i < segments.size(); ++i) {
+            if(segments[i].counter >= 0)
+                continue;
+
+            auto & literal = rasterized->literals[i];
+            literal        = {.style = style, .text = std::u8string{message.literal(segments[i])}};
+            if(!rasterize(literal, true))
+                return nullptr;
+        }
+        pinned = std::move(rasterized);
+    }
+
+    bool changed = pinned->run.id == 0;
+    for(const auto & segment : segments) {
+        if(segment.counter < 0)
+            continue;
+        const uint64_t value = counters[segment.counter].load(std::memory_order_relaxed);
+        changed |= std::exchange(pinned->values[segment.counter], value) != value;
+    }
+    if(changed && !compose(*pinned)) {
+        pinned->run.id = 0;
+        return nullptr;
+    }
+    return &pinned->run;
+}
+
+void TextRunCache::clear() noexcept {
+    _runs.clear();
+    _pinned_messages.clear();
+    _digits_rasterized = false;
+}
+
+bool TextRunCache::rasterize_digits(const Style & style) noexcept {
+    for(size_t i = 0; i < _digits.size(); ++i) {
+        _digits[i] = {.style = style, .text = std::u8string(1, static_cast<char8_t>(u8'0' + i))};
+        if(!rasterize(_digits[i], true))
+            return false;
+    }
+    return true;
+}
+
+bool TextRunCache::compose(PinnedMessage & pinned) noexcept {
+    // Pieces start at the pen rounded to whole pixels, their bitmaps are snapped already. Kerning between a literal and
+    // the digits next to it is lost, which is hardly visible at status message sizes.
+    const auto for_each_piece = [&](const auto & draw) {
+        const auto segments = pinned.message->segments();
+        float      pen      = 0.0f;
+        for(size_t i = 0; i < segments.size(); ++i) {
+            if(segments[i].counter < 0) {
+                draw(pinned.literals[i], static_cast<int>(std::round(pen)));
+                pen += pinned.literals[i].advance;
+                continue;
+            }
+
+            char       digits[20];
+            const auto last = std::to_chars(digits, digits + sizeof(digits), pinned.values[segments[i].counter]).ptr;
+            for(const char * digit = digits; digit != last; ++digit) {
+                const Run & glyph = _digits[*digit - '0'];
+                draw(glyph, static_cast<int>(std::round(pen)));
+                pen += glyph.advance;
+            }
+        }
+    };
+
+    int left   = INT_MAX;
+    int top    = INT_MAX;
+    int right  = INT_MIN;
+    int bottom = INT_MIN;
+    for_each_piece([&](const Run & piece, const int x) {
+        if(!piece.width)
+            return;
+        left   = std::min(left, x + piece.origin_x);
+        top    = std::min(top, piece.origin_y);
+        right  = std::max(right, x + piece.origin_x + piece.width);
+        bottom = std::max(bottom, piece.origin_y + piece.height);
+    });
+    if(left >= right)
+        return false;
+
+    auto & run    = pinned.run;
+    run.style     = pinned.style;
+    run.origin_x  = left;
+    run.origin_y  = top;
+    run.width     = right - left;
+    run.height    = bottom - top;
+    run.id        = _next_id++;
+    {
+        // Keeps the bitmap's storage, it only grows when the message gets bigger than it ever was.
+        const utils::memory::Phase phase{utils::memory::Subsystem::FrameCache};
+        run.pixels.assign(static_cast<size_t>(run.width) * run.height, 0);
+    }
+
+    // Neighbouring glyphs' bitmaps can overlap where their antialiased edges meet.
+    for_each_piece([&](const Run & piece, const int x) {
+        if(!piece.width)
+            return;
+        utils::blend_over(run.pixels.data() + static_cast<size_t>(piece.origin_y - top) * run.width +
+                            (x + piece.origin_x - left),
+                          static_cast<size_t>(run.width),
+                          piece.pixels.data(),
+                          static_cast<size_t>(piece.width),
+                          piece.width,
+                          piece.height);
+    });
+    return true;
+}
+
+bool TextRunCache::rasterize(Run & run, const bool measure_advance) noexcept {
+    if(run.text.empty())
+        return false;
+
+    const utils::memory::Phase phase{utils::memory::Subsystem::FrameCache};
+
+    std::unique_ptr<tvg::SwCanvas> canvas{tvg::SwCanvas::gen()};
+    if(!canvas)
+        return false;
+
+    // The canvas needs a target before anything can be measured, the real one is only known after layout.
+    uint32_t placeholder = 0;
+    if(canvas->target(&placeholder, 1, 1, 1, tvg::ColorSpace::ARGB8888) != tvg::Result::Success)
+        return false;
+
+    auto text = tvg::Text::gen();
+    if(!text || canvas->push(text) != tvg::Result::Success)
+        return false;
+
+    text->font(run.style.family.c_str(), run.style.size_pt);
+    text->text(reinterpret_cast<const char *>(run.text.c_str()));
+    text->fill(run.style.r, run.style.g, run.style.b);
+
+    float x = 0.0f;
+    float y = 0.0f;
+    float w = 0.0f;
+    float h = 0.0f;
+    if(measure_advance) {
+        // Bounds only cover the ink. The right edge of a bar following the text, minus where the bar alone ends, is the
+        // advance including trailing spaces, as long as the font doesn't kern against the bar.
+        text->text(reinterpret_cast<const char *>((run.text + u8"|").c_str()));
+        if(text->bounds(&x, &y, &w, &h) != tvg::Result::Success)
+            return false;
+        const float text_right = x + w;
+        text->text("|");
+        if(text->bounds(&x, &y, &w, &h) != tvg::Result::Success)
+            return false;
+        run.advance = text_right - (x + w);
+        text->text(reinterpret_cast<const char *>(run.text.c_str()));
+    }
+
+    if(text->bounds(&x, &y, &w, &h) != tvg::Result::Success || w <= 0.0f || h <= 0.0f) {
+        run.width  = 0;
+        run.height = 0;
+        return measure_advance;
+    }
+
+    // Snap to whole pixels, so blitting the run never needs resampling.
+    run.origin_x = static_cast<int>(std::floor(x));
+    run.origin_y = static_cast<int>(std::floor(y));
+    run.width    = static_cast<int>(std::ceil(x + w)) - run.origin_x;
+    run.height   = static_cast<int>(std::ceil(y + h)) - run.origin_y;
+    run.pixels.assign(static_cast<size_t>(run.width) * run.height, 0);
+
+    text->translate(static_cast<float>(-run.origin_x), static_cast<float>(-run.origin_y));
+
+    if(canvas->target(run.pixels.data(), run.width, run.width, run.height, tvg::ColorSpace::ARGB8888) !=
+         tvg::Result::Success ||
+       canvas->update() != tvg::Result::Success || canvas->draw() != tvg::Result::Success ||
+       canvas->sync() != tvg::Result::Success)
+        return false;
+
+    return true;
+}
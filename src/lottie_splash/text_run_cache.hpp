@@ -0,0 +1,79 @@
+#pragma once
+#include "utils/message_template.hpp"
+
+#include <thorvg.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Lays out and rasterizes text runs into premultiplied ARGB bitmaps once, so frames only blit them instead of
+// reshaping and re-tessellating every glyph outline.
+class TextRunCache final {
+  public:
+    struct Style {
+        std::string family;
+        float       size_pt = 0.0f;
+        uint8_t     r       = 255;
+        uint8_t     g       = 255;
+        uint8_t     b       = 255;
+
+        bool operator==(const Style &) const = default;
+    };
+
+    struct Run {
+        Style                 style;
+        std::u8string         text;
+        std::vector<uint32_t> pixels;
+        int                   width  = 0;
+        int                   height = 0;
+        // Position of the bitmap's top-left corner relative to the text origin.
+        int origin_x = 0;
+        int origin_y = 0;
+        // How far the text moves the pen, only measured for the pieces messages are composed from.
+        float advance = 0.0f;
+        // Unique per rasterization, so a picture showing a run can tell it went stale even if its memory was reused.
+        uint64_t id = 0;
+    };
+
+    explicit TextRunCache(const size_t capacity) noexcept : _capacity(capacity) {}
+
+    // Returns nullptr if the run couldn't be rasterized, e.g. when the software engine isn't available. The returned
+    // run stays valid until at least _capacity - 1 other runs have been requested.
+    const Run * get(const Style & style, const std::u8string_view text) noexcept;
+    // The message with its placeholders filled in from the counters, kept in the given slot until the message or the
+    // style changes instead of being evicted. The literal parts and the digits are rasterized once, so a counter
+    // changing only copies their bitmaps into the slot's again, without laying out any text.
+    const Run * get_pinned(const size_t                   slot,
+                           const Style &                  style,
+                           const utils::MessageTemplate & message,
+                           const std::atomic_uint64_t *   counters) noexcept;
+    void        clear() noexcept;
+
+  private:
+    struct PinnedMessage {
+        const utils::MessageTemplate * message = nullptr;
+        Style                          style;
+        // One per segment of the message, counters leave theirs empty.
+        std::vector<Run>                                            literals;
+        std::array<uint64_t, utils::MessageTemplate::MAX_COUNTERS> values{};
+        Run                                                         run;
+    };
+
+    // Pieces without any ink, e.g. spaces, only succeed when the advance is measured.
+    static bool rasterize(Run & run, bool measure_advance = false) noexcept;
+    bool        rasterize_digits(const Style & style) noexcept;
+    bool        compose(PinnedMessage & pinned) noexcept;
+
+    const size_t                                _capacity;
+    std::list<Run>                              _runs; // Most recently used first
+    std::vector<std::unique_ptr<PinnedMessage>> _pinned_messages;
+    std::array<Run, 10>                         _digits;
+    bool                                        _digits_rasterized = false;
+    uint64_t                                    _next_id           = 1;
+};
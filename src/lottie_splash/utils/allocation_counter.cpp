@@ -0,0 +1,7 @@
+#include "allocation_counter.hpp"
+
+#include "memory.hpp"
+
+namespace utils {
+uint64_t thread_allocations() noexcept { return ALLOCATIONS_COUNTED ? memory::thread_operator_new_calls() : 0; }
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+namespace utils {
+#ifdef LOTTIE_SPLASH_COUNT_ALLOCATIONS
+inline constexpr bool ALLOCATIONS_COUNTED = true;
+#else
+inline constexpr bool ALLOCATIONS_COUNTED = false;
+#endif
+
+// Number of times the calling thread went through operator new. Builds with --with-allocation-counter count them in the
+// operator new that --with-custom-allocator replaces, all other builds always return 0.
+uint64_t thread_allocations() noexcept;
+
+// Allocations made by the calling thread since construction.
+class AllocationScope final {
+  public:
+    AllocationScope() noexcept : _start(thread_allocations()) {}
+
+    uint64_t count() const noexcept { return thread_allocations() - _start; }
+
+  private:
+    uint64_t _start;
+};
+}
@@ -0,0 +1,55 @@
+#include "animation_timeline.hpp"
+
+#include <cmath>
+
+namespace {
+// Clock values which are an exact number of frames apart, e.g. a virtual clock stepped by 1/fps in whole nanoseconds,
+// can land a hair before the frame boundary after the conversion to frames. A few microseconds of slack keep them on
+// the frame they were meant for.
+constexpr double FRAME_EPSILON = 1e-4;
+}
+
+namespace utils {
+AnimationTimeline::AnimationTimeline(const double total_frames,
+                                     const double duration_seconds,
+                                     const bool   quantize) noexcept
+  : _total_frames(total_frames), _frame_rate(duration_seconds > 0.0 ? total_frames / duration_seconds : 0.0),
+    _quantize(quantize) {}
+
+void AnimationTimeline::reset(const duration start) noexcept {
+    _start      = start;
+    _last_frame = -1;
+}
+
+double AnimationTimeline::position(const duration now) const noexcept {
+    const double elapsed = now > _start ? std::chrono::duration<double>(now - _start).count() : 0.0;
+    return elapsed * _frame_rate + FRAME_EPSILON;
+}
+
+void AnimationTimeline::resync(const duration now) noexcept {
+    if(valid())
+        _last_frame = static_cast<int64_t>(std::floor(position(now))) - 1;
+}
+
+double AnimationTimeline::advance(const duration now) noexcept {
+    if(!valid())
+        return 0.0;
+
+    const double position = this->position(now);
+
+    // Counted in frames since reset rather than within the loop, so the loop seam looks like any other frame step.
+    const auto frame = static_cast<int64_t>(std::floor(position));
+    if(_last_frame >= 0) {
+        if(frame == _last_frame)
+            ++_stats.repeated_frames;
+        else if(frame > _last_frame + 1)
+            _stats.skipped_frames += static_cast<uint64_t>(frame - _last_frame - 1);
+    }
+    _last_frame = frame;
+
+    // A fractional last frame is shown for a whole frame, so quantized loops are ceil(total_frames) frames long.
+    if(_quantize)
+        return static_cast<double>(frame % static_cast<int64_t>(std::ceil(_total_frames)));
+    return std::fmod(position - FRAME_EPSILON, _total_frames);
+}
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace utils {
+// Maps clock time to a looping position in the animation's own frame units. The position is derived from the time
+// since reset() in double precision on every call, so looping never accumulates error. By default positions are
+// continuous, so motion stays smooth when the window refreshes faster than the animation's frame rate. With quantization
+// every position is a whole source frame, for animations whose in-between frames were never checked.
+class AnimationTimeline final {
+  public:
+    using duration = std::chrono::nanoseconds;
+
+    struct Stats {
+        // Source frames shown more than once in a row, i.e. rendering ran faster than the animation's frame rate.
+        uint64_t repeated_frames = 0;
+        // Source frames which were never shown, because rendering fell behind.
+        uint64_t skipped_frames = 0;
+    };
+
+    AnimationTimeline() noexcept = default;
+    AnimationTimeline(const double total_frames, const double duration_seconds, const bool quantize = false) noexcept;
+
+    void   reset(const duration start) noexcept;
+    // Position to present at `now`, in [0, total_frames). Meant to be called once per presented frame.
+    double advance(const duration now) noexcept;
+    // Continues counting from the frame at `now` without reporting the frames in between as skipped, e.g. after
+    // nothing was presented on purpose.
+    void   resync(const duration now) noexcept;
+
+    bool          valid() const noexcept { return _total_frames > 0.0 && _frame_rate > 0.0; }
+    double        frame_rate() const noexcept { return _frame_rate; }
+    const Stats & stats() const noexcept { return _stats; }
+
+  private:
+    double position(const duration now) const noexcept;
+
+    double   _total_frames = 0.0;
+    double   _frame_rate   = 0.0;
+    bool     _quantize     = false;
+    duration _start{};
+    int64_t  _last_frame = -1;
+    Stats    _stats;
+};
+}
@@ -0,0 +1,17 @@
+#include "blend.hpp"
+
+namespace utils {
+void blend_over(uint32_t *           dst,
+                const size_t         dst_stride,
+                const uint32_t *     src,
+                const size_t         src_stride,
+                const int            width,
+                const int            height,
+                const PixelKernels & kernels) noexcept {
+    if(!dst || !src || width <= 0 || height <= 0)
+        return;
+
+    for(int y = 0; y < height; ++y)
+        kernels.blend_over(dst + y * dst_stride, src + y * src_stride, static_cast<size_t>(width));
+}
+}
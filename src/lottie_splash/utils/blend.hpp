@@ -0,0 +1,18 @@
+#pragma once
+
+#include "pixel_kernels.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace utils {
+// Draws a premultiplied ARGB8888 image over another one, row by row with the blend_over kernel. Strides are in pixels.
+// Transparent and opaque stretches of the source are skipped or copied.
+void blend_over(uint32_t *           dst,
+                size_t               dst_stride,
+                const uint32_t *     src,
+                size_t               src_stride,
+                int                  width,
+                int                  height,
+                const PixelKernels & kernels = pixel_kernels()) noexcept;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+namespace utils {
+// Source of animation time. Everything that ends up in a frame reads time through it, so swapping in a VirtualClock
+// makes the rendered output a pure function of the time the caller asked for.
+class Clock {
+  public:
+    using duration = std::chrono::nanoseconds;
+
+    virtual ~Clock() = default;
+
+    // Monotonic time since an unspecified epoch.
+    virtual duration now() const noexcept = 0;
+};
+
+class SteadyClock final : public Clock {
+  public:
+    duration now() const noexcept override { return std::chrono::steady_clock::now().time_since_epoch(); }
+};
+
+// Starts at zero and only moves when advanced. Can be advanced from any thread while another one renders.
+class VirtualClock final : public Clock {
+  public:
+    duration now() const noexcept override { return duration{_now.load(std::memory_order_acquire)}; }
+    void     advance(const duration delta) noexcept { _now.fetch_add(delta.count(), std::memory_order_acq_rel); }
+
+  private:
+    std::atomic<duration::rep> _now = 0;
+};
+}
@@ -0,0 +1,98 @@
+#include "font_provider.hpp"
+
+#include <map>
+#include <mutex>
+
+#ifdef _WIN32
+#include "unicode.hpp"
+
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+std::optional<utils::FontData> map_file(const std::filesystem::path & path) {
+#ifdef _WIN32
+    const HANDLE file = CreateFileW(
+      path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(file == INVALID_HANDLE_VALUE)
+        return std::nullopt;
+
+    LARGE_INTEGER size{};
+    const HANDLE  mapping = GetFileSizeEx(file, &size) && size.QuadPart > 0 && size.QuadPart <= UINT32_MAX
+                              ? CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr)
+                              : nullptr;
+    CloseHandle(file);
+    if(!mapping)
+        return std::nullopt;
+
+    // The view keeps the mapping alive on its own.
+    const void * view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if(!view)
+        return std::nullopt;
+
+    return utils::FontData{.data = static_cast<const char *>(view), .size = static_cast<size_t>(size.QuadPart)};
+#else
+    const int file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if(file < 0)
+        return std::nullopt;
+
+    struct stat info {};
+    void *      view = fstat(file, &info) == 0 && info.st_size > 0 && info.st_size <= UINT32_MAX
+                         ? mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0)
+                         : MAP_FAILED;
+    close(file);
+    if(view == MAP_FAILED)
+        return std::nullopt;
+
+    return utils::FontData{.data = static_cast<const char *>(view), .size = static_cast<size_t>(info.st_size)};
+#endif
+}
+}
+
+namespace utils {
+std::optional<FontData> map_font_file(const std::filesystem::path & path) {
+    static std::mutex                                               mappings_mutex;
+    static std::map<std::filesystem::path, std::optional<FontData>> mappings;
+
+    std::lock_guard lock{mappings_mutex};
+    if(const auto it = mappings.find(path); it != mappings.end())
+        return it->second;
+
+    auto font = map_file(path);
+    if(font) {
+        // path::string() throws for names the narrow code page can't represent, ending the process in noexcept callers.
+#ifdef _WIN32
+        font->family = wide_to_utf8(path.stem().native());
+#else
+        font->family = path.stem().native();
+#endif
+    }
+    return mappings.emplace(path, std::move(font)).first->second;
+}
+
+const std::vector<std::filesystem::path> & default_font_paths() {
+    static const std::vector<std::filesystem::path> paths = [] {
+#ifdef _WIN32
+        wchar_t windows_dir[MAX_PATH];
+        if(!GetWindowsDirectoryW(windows_dir, MAX_PATH))
+            return std::vector<std::filesystem::path>{};
+
+        const std::filesystem::path fonts_dir = std::filesystem::path{windows_dir} / L"Fonts";
+        return std::vector{fonts_dir / L"segoeui.ttf", fonts_dir / L"arial.ttf", fonts_dir / L"tahoma.ttf"};
+#else
+        return std::vector<std::filesystem::path>{"/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+                                                  "/usr/share/fonts/TTF/DejaVuSans.ttf",
+                                                  "/usr/share/fonts/dejavu/DejaVuSans.ttf",
+                                                  "/usr/share/fonts/truetype/liberation/LiberationSans-Regular.ttf",
+                                                  "/usr/share/fonts/liberation/LiberationSans-Regular.ttf"};
+#endif
+    }();
+    return paths;
+}
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace utils {
+struct FontData {
+    std::string  family;
+    const char * data = nullptr;
+    size_t       size = 0;
+};
+
+// Maps a font file into memory. Mappings are created once per process and live until it exits, so all splash windows
+// share the same pages and reloading a font after thorvg was reinitialized doesn't touch the disk.
+std::optional<FontData> map_font_file(const std::filesystem::path & path);
+
+// Platform font files tried in order when the caller doesn't provide a search list.
+const std::vector<std::filesystem::path> & default_font_paths();
+
+// Small font subset compiled into the library, used when no other font could be loaded.
+FontData embedded_font();
+}
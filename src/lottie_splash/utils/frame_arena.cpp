@@ -0,0 +1,49 @@
+#include "frame_arena.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace utils {
+FrameArena::FrameArena(const size_t initial_capacity) noexcept
+    : _block(new(std::nothrow) std::byte[initial_capacity]), _capacity(_block ? initial_capacity : 0) {}
+
+void FrameArena::reset() noexcept {
+    const size_t needed = used();
+    _used               = 0;
+    _overflow.clear();
+    _overflow_bytes = 0;
+
+    if(needed <= _capacity)
+        return;
+
+    // Leave some headroom, so a frame that grows slowly doesn't reallocate the block every time.
+    const size_t capacity = needed + needed / 2;
+    if(std::unique_ptr<std::byte[]> block{new(std::nothrow) std::byte[capacity]}; block) {
+        _block    = std::move(block);
+        _capacity = capacity;
+    }
+}
+
+void * FrameArena::do_allocate(const size_t bytes, const size_t alignment) {
+    const auto base    = reinterpret_cast<uintptr_t>(_block.get());
+    const auto aligned = (base + _used + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    if(_block && aligned + bytes <= base + _capacity) {
+        _used = aligned + bytes - base;
+        return reinterpret_cast<void *>(aligned);
+    }
+
+    // The padding lets any alignment be served from a block that only has the default one.
+    const size_t                 size = bytes + alignment;
+    std::unique_ptr<std::byte[]> block{new(std::nothrow) std::byte[size]};
+    // Strings and vectors backed by the arena don't expect null, and the library doesn't use exceptions, so running out
+    // of memory ends the process like operator new does.
+    if(!block)
+        std::abort();
+
+    const auto overflow_base = reinterpret_cast<uintptr_t>(block.get());
+    _overflow.push_back(std::move(block));
+    _overflow_bytes += size;
+    return reinterpret_cast<void *>((overflow_base + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1));
+}
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace utils {
+// Bump allocator for data that only lives until the end of a frame. Deallocation is a no-op, everything is released at
+// once by reset(). When a frame needs more than the current block, the overflow comes from the heap and the next
+// reset() replaces the block with one that fits the whole frame, so steady frames never touch the heap.
+class FrameArena final : public std::pmr::memory_resource {
+  public:
+    explicit FrameArena(size_t initial_capacity = 4096) noexcept;
+
+    // Invalidates everything allocated since the last reset.
+    void   reset() noexcept;
+    size_t capacity() const noexcept { return _capacity; }
+    // Bytes handed out since the last reset, including alignment padding and overflow allocations.
+    size_t used() const noexcept { return _used + _overflow_bytes; }
+
+  private:
+    void * do_allocate(size_t bytes, size_t alignment) override;
+    void   do_deallocate(void *, size_t, size_t) noexcept override {}
+    bool   do_is_equal(const std::pmr::memory_resource & other) const noexcept override { return this == &other; }
+
+    std::unique_ptr<std::byte[]>              _block;
+    size_t                                    _capacity = 0;
+    size_t                                    _used     = 0;
+    std::vector<std::unique_ptr<std::byte[]>> _overflow;
+    size_t                                    _overflow_bytes = 0;
+};
+}
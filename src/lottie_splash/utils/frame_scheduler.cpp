@@ -0,0 +1,37 @@
+#include "frame_scheduler.hpp"
+
+#include <algorithm>
+
+namespace utils {
+void FrameScheduler::reset(const duration now) noexcept {
+    _origin      = now;
+    _frame_index = 0;
+}
+
+void FrameScheduler::set_interval(const duration frame_interval) noexcept {
+    _origin      = deadline();
+    _frame_index = 0;
+    _interval    = frame_interval;
+}
+
+void FrameScheduler::begin_frame(const duration now) noexcept {
+    const duration lateness = std::max(now - deadline(), duration::zero());
+
+    ++_stats.frames;
+    _stats.max_lateness = std::max(_stats.max_lateness, lateness);
+    _stats.total_lateness += lateness;
+}
+
+FrameScheduler::duration FrameScheduler::end_frame(const duration now) noexcept {
+    ++_frame_index;
+
+    // A deadline missed by less than half a frame is still worth rendering late. Beyond that, the frame would land
+    // closer to the following deadline, so it's dropped and the schedule skips ahead on the same grid.
+    if(const duration late = now - deadline(); late > _interval / 2) {
+        const int64_t missed = (late - _interval / 2) / _interval + 1;
+        _frame_index += missed;
+        _stats.dropped_frames += static_cast<uint64_t>(missed);
+    }
+    return deadline();
+}
+}
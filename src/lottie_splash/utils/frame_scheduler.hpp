@@ -0,0 +1,42 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace utils {
+// Hands out frame deadlines on a fixed grid anchored at reset(). Deadlines are computed from the frame index rather
+// than by adding intervals, so wake-up latency never accumulates into drift. Deadlines which were missed by a wide
+// margin are skipped and counted as dropped frames.
+class FrameScheduler final {
+  public:
+    using duration = std::chrono::nanoseconds;
+
+    struct Stats {
+        uint64_t frames         = 0;
+        uint64_t dropped_frames = 0;
+        // How late frames started relative to their deadline.
+        duration max_lateness{};
+        duration total_lateness{};
+    };
+
+    explicit FrameScheduler(const duration frame_interval) noexcept : _interval(frame_interval) {}
+
+    void     reset(const duration now) noexcept;
+    // Re-anchors the grid at the current deadline, so the frame after it is the first one on the new interval.
+    void     set_interval(const duration frame_interval) noexcept;
+    // Called when the frame for the current deadline begins.
+    void     begin_frame(const duration now) noexcept;
+    // Called after the frame is presented. Returns the deadline to wait for before beginning the next one.
+    duration end_frame(const duration now) noexcept;
+
+    duration      deadline() const noexcept { return _origin + _interval * _frame_index; }
+    duration      interval() const noexcept { return _interval; }
+    const Stats & stats() const noexcept { return _stats; }
+
+  private:
+    duration _interval;
+    duration _origin{};
+    int64_t  _frame_index = 0;
+    Stats    _stats;
+};
+}
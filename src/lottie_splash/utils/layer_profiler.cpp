@@ -0,0 +1,91 @@
+#include "layer_profiler.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace utils {
+namespace {
+double to_ms(const LayerProfiler::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+void append_json_string(std::string & out, const std::string_view string) {
+    out += '"';
+    for(const char c : string) {
+        if(c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if(static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            out += escaped;
+        } else {
+            out += c;
+        }
+    }
+    out += '"';
+}
+}
+
+void LayerProfiler::set_layers(std::vector<std::string> names) {
+    std::lock_guard lock{_mutex};
+    _names = std::move(names);
+    _totals.assign(_names.size(), {});
+    _next = 0;
+}
+
+size_t LayerProfiler::next_layer() noexcept {
+    const size_t layer = _next;
+    _next              = _names.empty() ? 0 : (_next + 1) % _names.size();
+    return layer;
+}
+
+void LayerProfiler::record(const size_t layer, const Timing & without_layer, const Timing & full) noexcept {
+    std::lock_guard lock{_mutex};
+    if(layer >= _totals.size())
+        return;
+
+    auto & totals = _totals[layer];
+    ++totals.samples;
+    totals.update += full.update - without_layer.update;
+    totals.draw += full.draw - without_layer.draw;
+}
+
+std::vector<LayerProfiler::Entry> LayerProfiler::sorted() const {
+    std::vector<Entry> entries;
+    {
+        std::lock_guard lock{_mutex};
+        entries.reserve(_names.size());
+        for(size_t i = 0; i < _names.size(); ++i) {
+            const auto & totals  = _totals[i];
+            const double samples = static_cast<double>(std::max<uint64_t>(totals.samples, 1));
+            entries.push_back(
+              {_names[i], totals.samples, to_ms(totals.update) / samples, to_ms(totals.draw) / samples});
+        }
+    }
+    std::stable_sort(entries.begin(), entries.end(), [](const Entry & a, const Entry & b) {
+        return a.update_ms + a.draw_ms > b.update_ms + b.draw_ms;
+    });
+    return entries;
+}
+
+std::string LayerProfiler::to_json() const {
+    std::string json  = "{\"layers\":[";
+    bool        first = true;
+    for(const auto & entry : sorted()) {
+        char numbers[128];
+        std::snprintf(numbers,
+                      sizeof(numbers),
+                      ",\"samples\":%llu,\"update_ms\":%.4f,\"draw_ms\":%.4f}",
+                      static_cast<unsigned long long>(entry.samples),
+                      entry.update_ms,
+                      entry.draw_ms);
+        json += first ? "{\"name\":" : ",{\"name\":";
+        append_json_string(json, entry.name);
+        json += numbers;
+        first = false;
+    }
+    json += "]}";
+    return json;
+}
+}
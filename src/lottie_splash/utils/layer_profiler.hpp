@@ -0,0 +1,58 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace utils {
+// Attributes render cost to the animation's layers by leaving them out one at a time. For each profiled frame the
+// window renders once more with a single layer hidden before the real render, and the difference between the two is
+// that layer's cost, including its children and whatever it mattes. Only one layer is left out per frame, so a loop
+// of the animation gathers samples of every layer at a cost of one extra render per frame.
+//
+// "Update" is thorvg's canvas update, which turns paths into spans, and "draw" is rasterizing them. Evaluating the
+// animation's model happens for all layers at once and isn't attributed.
+class LayerProfiler final {
+  public:
+    using duration = std::chrono::nanoseconds;
+
+    struct Timing {
+        duration update{};
+        duration draw{};
+    };
+
+    struct Entry {
+        // Points into the profiler, valid until set_layers is called again. Always null-terminated.
+        std::string_view name;
+        uint64_t    samples = 0;
+        // Averages per sampled frame. Noise can make layers which cost next to nothing slightly negative.
+        double update_ms = 0.0;
+        double draw_ms   = 0.0;
+    };
+
+    void   set_layers(std::vector<std::string> names);
+    size_t layer_count() const noexcept { return _names.size(); }
+    // The layer to leave out in the next profiled frame, cycling through all of them.
+    size_t next_layer() noexcept;
+    void   record(const size_t layer, const Timing & without_layer, const Timing & full) noexcept;
+
+    // Most expensive first. Can be called from any thread.
+    std::vector<Entry> sorted() const;
+    std::string        to_json() const;
+
+  private:
+    struct Totals {
+        uint64_t samples = 0;
+        duration update{};
+        duration draw{};
+    };
+
+    std::vector<std::string> _names;
+    size_t                   _next = 0;
+    mutable std::mutex       _mutex;
+    std::vector<Totals>      _totals;
+};
+}
@@ -0,0 +1,207 @@
+#include "lottie_scan.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <optional>
+
+namespace utils {
+namespace {
+bool is_whitespace(const char c) noexcept { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+// Returns the index after the closing quote of the string starting at `begin`, or json.size() if it's unterminated.
+size_t skip_string(const std::string_view json, size_t begin) noexcept {
+    for(size_t i = begin + 1; i < json.size(); ++i) {
+        if(json[i] == '\\')
+            ++i;
+        else if(json[i] == '"')
+            return i + 1;
+    }
+    return json.size();
+}
+
+size_t skip_whitespace(const std::string_view json, size_t i) noexcept {
+    while(i < json.size() && is_whitespace(json[i]))
+        ++i;
+    return i;
+}
+
+std::optional<double> parse_number(const std::string_view json, const size_t i) noexcept {
+    double     value  = 0.0;
+    const auto result = std::from_chars(json.data() + i, json.data() + json.size(), value);
+    return result.ec == std::errc{} ? std::optional{value} : std::nullopt;
+}
+}
+
+bool uses_expressions(const std::string_view json) noexcept {
+    size_t i = 0;
+    while(i < json.size()) {
+        if(json[i] != '"') {
+            ++i;
+            continue;
+        }
+
+        const size_t end    = skip_string(json, i);
+        const bool   is_x   = end - i == 3 && json[i + 1] == 'x';
+        const size_t after  = skip_whitespace(json, end);
+        const bool   is_key = after < json.size() && json[after] == ':';
+        if(!is_key) {
+            i = end;
+            continue;
+        }
+
+        i = skip_whitespace(json, after + 1);
+        if(is_x && i + 1 < json.size() && json[i] == '"' && json[i + 1] != '"')
+            return true;
+    }
+    return false;
+}
+
+std::vector<LayerInfo> scan_layers(const std::string_view json) {
+    // Each open object or array, with the key it's the value of and the layer it belongs to. Elements of an array
+    // inherit the array's key, so an object whose key is "layers" is a layer.
+    struct Container {
+        char             kind;
+        std::string_view key;
+        size_t           layer;
+    };
+    constexpr size_t NO_LAYER = SIZE_MAX;
+
+    // What decides whether a layer is constant, besides the flags in LayerInfo.
+    struct Traits {
+        std::optional<double> in_point;
+        std::optional<double> out_point;
+        bool                  animated = false;
+        bool                  parented = false;
+        bool                  precomp  = false;
+        // The layer or a shape in it has a blend mode, which needs what's drawn below it.
+        bool                  blended  = false;
+    };
+
+    std::vector<Container> stack;
+    std::vector<LayerInfo> layers;
+    std::vector<Traits>    traits;
+    Traits                 root;
+    std::string_view       key;
+
+    // The layer whose properties are being read, i.e. the innermost container is a layer object.
+    const auto current_layer = [&]() -> LayerInfo * {
+        if(stack.empty() || stack.back().kind != '{' || stack.back().layer == NO_LAYER)
+            return nullptr;
+        if(stack.size() >= 2 && stack[stack.size() - 2].layer == stack.back().layer)
+            return nullptr;
+        return &layers[stack.back().layer];
+    };
+
+    size_t i = 0;
+    while(i < json.size()) {
+        const char c = json[i];
+        if(c == '{' || c == '[') {
+            const bool in_array = !stack.empty() && stack.back().kind == '[';
+            const auto outer    = stack.empty() ? NO_LAYER : stack.back().layer;
+            if(c == '{' && in_array && stack.back().key == "layers") {
+                // Precomps keep their layers in the assets, so only the root's own array holds top level ones.
+                layers.emplace_back().top_level = stack.size() == 2;
+                traits.emplace_back();
+                stack.push_back({c, stack.back().key, layers.size() - 1});
+            } else {
+                if(auto * layer = current_layer(); layer && c == '[' && key == "masksProperties") {
+                    const size_t next = skip_whitespace(json, i + 1);
+                    layer->masked     = next < json.size() && json[next] != ']';
+                }
+                stack.push_back({c, in_array ? stack.back().key : key, outer});
+            }
+            key = {};
+            ++i;
+        } else if(c == '}' || c == ']') {
+            if(!stack.empty())
+                stack.pop_back();
+            key = {};
+            ++i;
+        } else if(c == '"') {
+            const size_t           end    = skip_string(json, i);
+            const std::string_view string = json.substr(i + 1, std::max<size_t>(end - i, 2) - 2);
+            const size_t           after  = skip_whitespace(json, end);
+            if(after < json.size() && json[after] == ':') {
+                key = string;
+                i   = after + 1;
+                continue;
+            }
+
+            // Escaped names can't be compared with the unescaped ones thorvg hashes.
+            if(auto * layer = current_layer(); layer && key == "nm" && string.find('\\') == std::string_view::npos)
+                layer->name = string;
+            if(key == "x" && !string.empty() && !stack.empty() && stack.back().layer != NO_LAYER)
+                traits[stack.back().layer].animated = true;
+            key = {};
+            i   = end;
+        } else if(is_whitespace(c)) {
+            ++i;
+        } else {
+            // Flags are 0 or 1 and booleans true or false, any other leading digit means an enabled mode.
+            const bool set = (c >= '1' && c <= '9') || c == 't';
+            if(auto * layer = current_layer(); layer && !key.empty()) {
+                auto & layer_traits = traits[stack.back().layer];
+                if(key == "hd")
+                    layer->hidden = set;
+                else if(key == "td")
+                    layer->matte_source = set;
+                else if(key == "tt")
+                    layer->matted = set;
+                else if(key == "ip")
+                    layer_traits.in_point = parse_number(json, i);
+                else if(key == "op")
+                    layer_traits.out_point = parse_number(json, i);
+                else if(key == "parent")
+                    layer_traits.parented = c != 'n';
+                else if(key == "ty")
+                    layer_traits.precomp = parse_number(json, i) == 0.0;
+            } else if(!key.empty() && stack.size() == 1) {
+                if(key == "ip")
+                    root.in_point = parse_number(json, i);
+                else if(key == "op")
+                    root.out_point = parse_number(json, i);
+            }
+            // Animated properties are flagged with "a", keyframes are objects with a time "t". Static text documents
+            // are stored as a keyframe too, which errs on the safe side.
+            if(!stack.empty() && stack.back().layer != NO_LAYER && ((key == "a" && set) || (key == "t" && c != 'n')))
+                traits[stack.back().layer].animated = true;
+            if(!stack.empty() && stack.back().layer != NO_LAYER && key == "bm" && set)
+                traits[stack.back().layer].blended = true;
+            key = {};
+            ++i;
+        }
+    }
+
+    std::vector<std::string> duplicates;
+    for(size_t a = 0; a < layers.size(); ++a) {
+        for(size_t b = a + 1; b < layers.size(); ++b) {
+            if(!layers[a].name.empty() && layers[a].name == layers[b].name)
+                duplicates.push_back(layers[a].name);
+        }
+    }
+    for(size_t i = 0; i < layers.size(); ++i) {
+        auto &         layer  = layers[i];
+        const Traits & layer_traits = traits[i];
+        if(std::find(duplicates.begin(), duplicates.end(), layer.name) != duplicates.end())
+            layer.name.clear();
+
+        const bool whole_timeline = layer_traits.in_point && layer_traits.out_point && root.in_point &&
+                                    root.out_point && *layer_traits.in_point <= *root.in_point &&
+                                    *layer_traits.out_point >= *root.out_point;
+        layer.constant = layer.top_level && !layer.hidden && !layer.matte_source && !layer.matted &&
+                         !layer_traits.animated && !layer_traits.parented && !layer_traits.precomp &&
+                         !layer_traits.blended && whole_timeline;
+    }
+    return layers;
+}
+
+std::vector<std::string> layer_names(const std::string_view json) {
+    std::vector<std::string> names;
+    for(auto & layer : scan_layers(json)) {
+        if(!layer.name.empty())
+            names.push_back(std::move(layer.name));
+    }
+    return names;
+}
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace utils {
+// Whether a lottie document contains expressions, i.e. any "x" key with a non-empty string value. Expressions are
+// attached to animated properties that way, while the other "x" keys in the format, like a mask's expansion, hold
+// objects or numbers. Only tokenizes the JSON without building anything, so it's cheap enough to run before the real
+// parse.
+bool uses_expressions(std::string_view json) noexcept;
+
+struct LayerInfo {
+    // thorvg identifies a layer's paint by the hash of its name. Empty when that can't work, because the name is
+    // missing, appears more than once or contains escapes.
+    std::string name;
+    // Not part of a precomp.
+    bool top_level = false;
+    // "hd", never drawn.
+    bool hidden = false;
+    // "td", only serves as the track matte of the next layer and isn't drawn itself.
+    bool matte_source = false;
+    // "tt", drawn through the track matte of the layer before it.
+    bool matted = false;
+    // Has masks. Like mattes, they're composed in an offscreen buffer.
+    bool masked = false;
+    // A top level layer which renders the same on every frame: nothing in it has keyframes, expressions or a blend
+    // mode, it has no parent, isn't a precomp, takes no part in a track matte and is shown for the whole timeline.
+    bool constant = false;
+};
+
+// All layers, including the ones in precomps, in document order.
+std::vector<LayerInfo> scan_layers(std::string_view json);
+
+// Names of all layers which have a usable one, in document order.
+std::vector<std::string> layer_names(std::string_view json);
+}
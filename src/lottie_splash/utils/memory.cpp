@@ -0,0 +1,277 @@
+#include "memory.hpp"
+
+#include <Windows.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <utility>
+
+#ifdef LOTTIE_SPLASH_CUSTOM_ALLOCATOR
+#include <engine_heap.h>
+#endif
+
+namespace {
+using utils::memory::Allocator;
+using utils::memory::Subsystem;
+
+constexpr size_t MALLOC_ALIGNMENT = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+// Precedes every block. The offset leads back to the start of what the allocator returned, which differs from the
+// header's size only for over-aligned blocks.
+struct alignas(16) Header {
+    uint64_t size;
+    uint32_t offset;
+    uint16_t allocator;
+    uint16_t subsystem;
+    uint64_t padding;
+    // Right before the block, so blocks of the C runtime handed to thorvg's renamed free can be told apart.
+    uint64_t tag;
+};
+static_assert(sizeof(Header) % MALLOC_ALIGNMENT == 0);
+
+constexpr size_t   MAX_ALLOCATORS   = 16;
+constexpr size_t   MAX_WORKERS      = 8;
+constexpr size_t   SUBSYSTEM_COUNT  = static_cast<size_t>(Subsystem::Count);
+constexpr uint64_t TAG              = 0x6c6f7474'69655f73;
+
+void * crt_malloc(const size_t size, void *) { return std::malloc(size); }
+void * crt_realloc(void * pointer, const size_t size, void *) { return std::realloc(pointer, size); }
+void   crt_free(void * pointer, void *) { std::free(pointer); }
+
+// operator new can run before any dynamic initializer, so everything here has to be constant initialized. Installed
+// allocators are never overwritten, since blocks may still point at them.
+constinit Allocator             allocators[MAX_ALLOCATORS] = {{crt_malloc, crt_realloc, crt_free, nullptr}};
+constinit std::atomic<uint16_t> allocator_count            = 1;
+constinit std::atomic<uint16_t> current_allocator          = 0;
+std::mutex                      allocators_mutex;
+
+constinit thread_local Subsystem current_phase = Subsystem::Other;
+constinit std::atomic<Subsystem> shared_phase  = Subsystem::Other;
+constinit std::atomic<uint64_t>  current_bytes[SUBSYSTEM_COUNT]{};
+constinit std::atomic<uint64_t>  peak_bytes[SUBSYSTEM_COUNT]{};
+
+constinit std::atomic<unsigned long> worker_ids[MAX_WORKERS]{};
+constinit std::atomic<size_t>        worker_count = 0;
+
+constinit thread_local uint64_t operator_new_calls = 0;
+
+uint64_t tag(const uintptr_t pointer) { return TAG ^ pointer; }
+
+Header * header_of(void * pointer) { return static_cast<Header *>(pointer) - 1; }
+
+bool is_worker_thread() {
+    const size_t count = worker_count.load(std::memory_order_acquire);
+    if(!count)
+        return false;
+
+    const DWORD thread_id = GetCurrentThreadId();
+    for(size_t i = 0; i < count; ++i) {
+        if(worker_ids[i].load(std::memory_order_relaxed) == thread_id)
+            return true;
+    }
+    return false;
+}
+
+Subsystem allocating_subsystem() {
+    if(current_phase == Subsystem::Other && is_worker_thread())
+        return shared_phase.load(std::memory_order_relaxed);
+    return current_phase;
+}
+
+void account(const Subsystem subsystem, const uint64_t size) {
+    const auto index = static_cast<size_t>(subsystem);
+    const auto bytes = current_bytes[index].fetch_add(size, std::memory_order_relaxed) + size;
+    auto       peak  = peak_bytes[index].load(std::memory_order_relaxed);
+    while(bytes > peak && !peak_bytes[index].compare_exchange_weak(peak, bytes, std::memory_order_relaxed)) {}
+}
+
+#ifdef LOTTIE_SPLASH_CUSTOM_ALLOCATOR
+// Blocks of the C runtime can reach thorvg's free and realloc, e.g. from inline functions of standard headers that
+// were renamed along with thorvg's calls. They go back to the C runtime. The tag of such a block lies in the heap's own
+// header in front of it, so reading it is safe.
+bool is_own_block(void * pointer) {
+    return header_of(pointer)->tag == tag(reinterpret_cast<uintptr_t>(pointer));
+}
+
+void * engine_malloc(const size_t size) { return utils::memory::allocate(size, MALLOC_ALIGNMENT); }
+
+void * engine_realloc(void * pointer, const size_t size) {
+    if(pointer && !is_own_block(pointer))
+        return std::realloc(pointer, size);
+    return utils::memory::reallocate(pointer, size);
+}
+
+void engine_free(void * pointer) {
+    if(pointer && !is_own_block(pointer))
+        std::free(pointer);
+    else
+        utils::memory::deallocate(pointer);
+}
+
+// thorvg only allocates once the engine is initialized, long after this runs.
+[[maybe_unused]] const bool engine_heap_routed = [] {
+    lottie_splash_engine_heap = {engine_malloc, engine_realloc, engine_free};
+    return true;
+}();
+#endif
+}
+
+namespace utils::memory {
+bool set_allocator(const Allocator & allocator) noexcept {
+    std::lock_guard lock{allocators_mutex};
+    if(!allocator.malloc_fn || !allocator.realloc_fn || !allocator.free_fn) {
+        current_allocator.store(0, std::memory_order_release);
+        return true;
+    }
+
+    const uint16_t slot = allocator_count.load(std::memory_order_relaxed);
+    if(slot == MAX_ALLOCATORS)
+        return false;
+
+    allocators[slot] = allocator;
+    allocator_count.store(slot + 1, std::memory_order_relaxed);
+    current_allocator.store(slot, std::memory_order_release);
+    return true;
+}
+
+void * allocate(const size_t size, const size_t alignment) noexcept {
+    const uint16_t    slot      = current_allocator.load(std::memory_order_acquire);
+    const Allocator & allocator = allocators[slot];
+    const size_t      padding   = alignment > MALLOC_ALIGNMENT ? alignment : 0;
+
+    void * block = allocator.malloc_fn(sizeof(Header) + size + padding, allocator.user);
+    if(!block)
+        return nullptr;
+
+    const auto start   = reinterpret_cast<uintptr_t>(block);
+    auto       pointer = start + sizeof(Header);
+    if(padding)
+        pointer = (pointer + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+
+    const auto subsystem = allocating_subsystem();
+    *header_of(reinterpret_cast<void *>(pointer)) = {.size      = size,
+                                                     .offset    = static_cast<uint32_t>(pointer - start),
+                                                     .allocator = slot,
+                                                     .subsystem = static_cast<uint16_t>(subsystem),
+                                                     .padding   = 0,
+                                                     .tag       = tag(pointer)};
+    account(subsystem, size);
+    return reinterpret_cast<void *>(pointer);
+}
+
+void * reallocate(void * pointer, const size_t size) noexcept {
+    if(!pointer)
+        return allocate(size, MALLOC_ALIGNMENT);
+    if(!size) {
+        deallocate(pointer);
+        return nullptr;
+    }
+
+    const Header header = *header_of(pointer);
+    if(header.offset != sizeof(Header)) {
+        void * moved = allocate(size, MALLOC_ALIGNMENT);
+        if(moved) {
+            std::memcpy(moved, pointer, std::min<uint64_t>(size, header.size));
+            deallocate(pointer);
+        }
+        return moved;
+    }
+
+    // The block stays with the allocator it came from, but its size is charged to what the library does now.
+    const Allocator & allocator = allocators[header.allocator];
+    void *            block =
+      allocator.realloc_fn(static_cast<std::byte *>(pointer) - header.offset, sizeof(Header) + size, allocator.user);
+    if(!block)
+        return nullptr;
+
+    current_bytes[header.subsystem].fetch_sub(header.size, std::memory_order_relaxed);
+    const auto subsystem = allocating_subsystem();
+    const auto resized   = reinterpret_cast<uintptr_t>(block) + sizeof(Header);
+    auto &     moved     = *header_of(reinterpret_cast<void *>(resized));
+    moved.size           = size;
+    moved.subsystem      = static_cast<uint16_t>(subsystem);
+    moved.tag            = tag(resized);
+    account(subsystem, size);
+    return reinterpret_cast<void *>(resized);
+}
+
+void deallocate(void * pointer) noexcept {
+    if(!pointer)
+        return;
+
+    auto * header = header_of(pointer);
+    current_bytes[header->subsystem].fetch_sub(header->size, std::memory_order_relaxed);
+    // A stale tag makes a double free through thorvg's free land in the C runtime, which reports it.
+    header->tag = 0;
+
+    const Allocator & allocator = allocators[header->allocator];
+    allocator.free_fn(static_cast<std::byte *>(pointer) - header->offset, allocator.user);
+}
+
+Usage usage(const Subsystem subsystem) noexcept {
+    const auto index = static_cast<size_t>(subsystem);
+    return {.current_bytes = current_bytes[index].load(std::memory_order_relaxed),
+            .peak_bytes    = peak_bytes[index].load(std::memory_order_relaxed)};
+}
+
+uint64_t thread_operator_new_calls() noexcept { return operator_new_calls; }
+
+void set_worker_threads(const std::span<const unsigned long> thread_ids) noexcept {
+    const size_t count = std::min(thread_ids.size(), MAX_WORKERS);
+    worker_count.store(0, std::memory_order_release);
+    for(size_t i = 0; i < count; ++i)
+        worker_ids[i].store(thread_ids[i], std::memory_order_relaxed);
+    worker_count.store(count, std::memory_order_release);
+}
+
+Phase::Phase(const Subsystem subsystem) noexcept
+    : _previous(std::exchange(current_phase, subsystem)),
+      _previous_shared(shared_phase.exchange(subsystem, std::memory_order_relaxed)) {}
+
+Phase::~Phase() noexcept {
+    current_phase = _previous;
+    shared_phase.store(_previous_shared, std::memory_order_relaxed);
+}
+}
+
+#ifdef LOTTIE_SPLASH_CUSTOM_ALLOCATOR
+namespace {
+void * counted_allocate(const size_t size, const size_t alignment) noexcept {
+    ++operator_new_calls;
+    return utils::memory::allocate(size, alignment);
+}
+}
+
+// Only the single object forms need replacing, the array forms forward to them. Exceptions are disabled, so running
+// out of memory ends the process instead of throwing.
+void * operator new(const size_t size) {
+    if(void * pointer = counted_allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__))
+        return pointer;
+    std::abort();
+}
+
+void * operator new(const size_t size, const std::nothrow_t &) noexcept {
+    return counted_allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void * operator new(const size_t size, const std::align_val_t alignment) {
+    if(void * pointer = counted_allocate(size, static_cast<size_t>(alignment)))
+        return pointer;
+    std::abort();
+}
+
+void * operator new(const size_t size, const std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    return counted_allocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void * pointer) noexcept { utils::memory::deallocate(pointer); }
+void operator delete(void * pointer, const std::align_val_t) noexcept { utils::memory::deallocate(pointer); }
+void operator delete(void * pointer, const size_t) noexcept { utils::memory::deallocate(pointer); }
+void operator delete(void * pointer, const size_t, const std::align_val_t) noexcept {
+    utils::memory::deallocate(pointer);
+}
+#endif
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace utils::memory {
+#ifdef LOTTIE_SPLASH_CUSTOM_ALLOCATOR
+inline constexpr bool CUSTOM_ALLOCATOR = true;
+#else
+inline constexpr bool CUSTOM_ALLOCATOR = false;
+#endif
+
+// Builds with --with-custom-allocator route every operator new in the library and in thorvg, and thorvg's C
+// allocations, through allocate and reallocate, which forward to the installed allocator and account the bytes to the
+// subsystem the library is currently working on.
+enum class Subsystem : uint32_t {
+    Other,
+    // Loading the animation, including building its model.
+    Parser,
+    // Updating the animation's scene for a frame.
+    Model,
+    Rasterizer,
+    // Poster, text runs, reduced resolution buffers and the frame arena.
+    FrameCache,
+    Count,
+};
+
+struct Allocator {
+    using MallocFn  = void * (*)(size_t size, void * user);
+    using ReallocFn = void * (*)(void * pointer, size_t size, void * user);
+    using FreeFn    = void (*)(void * pointer, void * user);
+
+    // Blocks must be aligned like the CRT's malloc, i.e. to 16 bytes on 64 bit targets.
+    MallocFn  malloc_fn  = nullptr;
+    ReallocFn realloc_fn = nullptr;
+    FreeFn    free_fn    = nullptr;
+    void *    user       = nullptr;
+};
+
+struct Usage {
+    uint64_t current_bytes = 0;
+    uint64_t peak_bytes    = 0;
+};
+
+// Blocks remember the allocator they came from, so allocations made before a switch are still freed correctly.
+// Returns false once too many allocators were installed. Passing an allocator without functions restores the CRT one.
+bool   set_allocator(const Allocator & allocator) noexcept;
+void * allocate(size_t size, size_t alignment) noexcept;
+// Like C's realloc, for blocks from allocate with the default alignment.
+void * reallocate(void * pointer, size_t size) noexcept;
+void   deallocate(void * pointer) noexcept;
+Usage  usage(Subsystem subsystem) noexcept;
+
+// Number of times the calling thread went through the replaced operator new, 0 without --with-custom-allocator.
+uint64_t thread_operator_new_calls() noexcept;
+
+// Win32 ids of thorvg's worker threads. They don't know what the library is doing, so their allocations are charged to
+// the phase it's in on the thread that entered one last, usually the render thread that dispatched their work.
+void set_worker_threads(std::span<const unsigned long> thread_ids) noexcept;
+
+// Attributes allocations made by the calling thread, and by thorvg's workers while it lasts, to a subsystem until
+// destroyed. Phases nest, the previous one is restored on destruction.
+class Phase final {
+  public:
+    explicit Phase(Subsystem subsystem) noexcept;
+    ~Phase() noexcept;
+
+    Phase(const Phase &)             = delete;
+    Phase & operator=(const Phase &) = delete;
+
+  private:
+    Subsystem _previous;
+    Subsystem _previous_shared;
+};
+}
@@ -0,0 +1,61 @@
+#include "message_template.hpp"
+
+#include <charconv>
+
+namespace utils {
+MessageTemplate::MessageTemplate(const std::u8string_view text) {
+    const auto append_literal = [&](const std::u8string_view literal) {
+        if(literal.empty())
+            return;
+        if(_segments.empty() || _segments.back().counter >= 0)
+            _segments.push_back({.literal_offset = static_cast<uint32_t>(_literals.size())});
+        _literals += literal;
+        _segments.back().literal_length += static_cast<uint32_t>(literal.size());
+    };
+
+    for(size_t i = 0; i < text.size();) {
+        const size_t brace = text.find_first_of(u8"{}", i);
+        if(brace == std::u8string_view::npos) {
+            append_literal(text.substr(i));
+            break;
+        }
+
+        append_literal(text.substr(i, brace - i));
+        if(brace + 1 < text.size() && text[brace + 1] == text[brace]) {
+            append_literal(text.substr(brace, 1));
+            i = brace + 2;
+            continue;
+        }
+
+        const size_t close   = text[brace] == u8'{' ? text.find(u8'}', brace) : std::u8string_view::npos;
+        const auto   digits  = close != std::u8string_view::npos ? text.substr(brace + 1, close - brace - 1)
+                                                                  : std::u8string_view{};
+        size_t       counter = MAX_COUNTERS;
+        const auto * first   = reinterpret_cast<const char *>(digits.data());
+        const auto * last    = first + digits.size();
+        if(!digits.empty() && std::from_chars(first, last, counter).ptr == last && counter < MAX_COUNTERS) {
+            _segments.push_back({.counter = static_cast<int32_t>(counter)});
+            _has_placeholders = true;
+            i                 = close + 1;
+        } else {
+            append_literal(text.substr(brace, 1));
+            i = brace + 1;
+        }
+    }
+}
+
+void MessageTemplate::format(const std::atomic_uint64_t * counters, std::pmr::u8string & out) const noexcept {
+    out.clear();
+    for(const auto & segment : _segments) {
+        if(segment.counter < 0) {
+            out.append(_literals.data() + segment.literal_offset, segment.literal_length);
+            continue;
+        }
+
+        char       digits[20];
+        const auto value       = counters[segment.counter].load(std::memory_order_relaxed);
+        const auto [last, err] = std::to_chars(digits, digits + sizeof(digits), value);
+        out.append(reinterpret_cast<const char8_t *>(digits), last - digits);
+    }
+}
+}
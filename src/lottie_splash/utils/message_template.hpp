@@ -0,0 +1,43 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace utils {
+// Status message in which "{N}" is replaced with the current value of counter N. "{{" and "}}" produce literal braces,
+// anything else inside braces is kept as is.
+class MessageTemplate final {
+  public:
+    static constexpr size_t MAX_COUNTERS = 16;
+
+    // Either a literal stretch of the resolved text or a counter, consecutive literals are merged.
+    struct Segment {
+        uint32_t literal_offset = 0;
+        uint32_t literal_length = 0;
+        int32_t  counter        = -1;
+    };
+
+    explicit MessageTemplate(const std::u8string_view text);
+
+    bool has_placeholders() const noexcept { return _has_placeholders; }
+    // The message with escapes resolved. Only meaningful when there are no placeholders.
+    const std::u8string & text() const noexcept { return _literals; }
+    // Replaces out's contents. Formatting into a string backed by a frame arena keeps it off the heap.
+    void format(const std::atomic_uint64_t * counters, std::pmr::u8string & out) const noexcept;
+
+    std::span<const Segment> segments() const noexcept { return _segments; }
+    std::u8string_view       literal(const Segment & segment) const noexcept {
+        return std::u8string_view{_literals}.substr(segment.literal_offset, segment.literal_length);
+    }
+
+  private:
+    std::u8string        _literals;
+    std::vector<Segment> _segments;
+    bool                 _has_placeholders = false;
+};
+}
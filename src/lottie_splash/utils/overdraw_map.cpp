@@ -0,0 +1,74 @@
+#include "overdraw_map.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace utils {
+namespace {
+constexpr std::array<uint32_t, 6> HEAT_COLORS = {
+  0xff000000, // never written
+  0xff2050e0, // blue
+  0xff30c040, // green
+  0xffe0e030, // yellow
+  0xfff09020, // orange
+  0xffe02020, // red
+};
+
+void increment(uint16_t & count) noexcept {
+    if(count < std::numeric_limits<uint16_t>::max())
+        ++count;
+}
+}
+
+void OverdrawMap::reset(const size_t width, const size_t height) {
+    _width  = width;
+    _height = height;
+    _writes = 0;
+    _counts.assign(width * height, 0);
+}
+
+void OverdrawMap::add_coverage(const uint32_t * pixels, const size_t stride) noexcept {
+    for(size_t y = 0; y < _height; ++y) {
+        const uint32_t * row    = pixels + y * stride;
+        uint16_t *       counts = _counts.data() + y * _width;
+        for(size_t x = 0; x < _width; ++x) {
+            if(row[x] >> 24) {
+                increment(counts[x]);
+                ++_writes;
+            }
+        }
+    }
+}
+
+void OverdrawMap::add_area(const float x, const float y, const float width, const float height) noexcept {
+    const auto clamp = [](const float value, const size_t limit) {
+        return static_cast<size_t>(std::clamp(value, 0.0f, static_cast<float>(limit)));
+    };
+    const size_t left   = clamp(std::floor(x), _width);
+    const size_t right  = clamp(std::ceil(x + width), _width);
+    const size_t top    = clamp(std::floor(y), _height);
+    const size_t bottom = clamp(std::ceil(y + height), _height);
+    for(size_t row = top; row < bottom; ++row) {
+        uint16_t * counts = _counts.data() + row * _width;
+        std::for_each(counts + left, counts + right, increment);
+    }
+    if(left < right && top < bottom)
+        _writes += static_cast<uint64_t>(right - left) * (bottom - top);
+}
+
+void OverdrawMap::add_everywhere() noexcept {
+    std::for_each(_counts.begin(), _counts.end(), increment);
+    _writes += _counts.size();
+}
+
+void OverdrawMap::colorize(uint32_t * pixels, const size_t stride) const noexcept {
+    for(size_t y = 0; y < _height; ++y) {
+        const uint16_t * counts = _counts.data() + y * _width;
+        uint32_t *       row    = pixels + y * stride;
+        for(size_t x = 0; x < _width; ++x)
+            row[x] = HEAT_COLORS[std::min<size_t>(counts[x], HEAT_COLORS.size() - 1)];
+    }
+}
+}
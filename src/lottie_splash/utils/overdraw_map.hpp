@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace utils {
+// Counts how often each pixel of a frame is written. The frame is drawn piece by piece into a cleared buffer, and each
+// piece adds one write to every pixel it left visible. Offscreen composition, which mattes and masks go through, adds
+// one write to every pixel of the composed area.
+class OverdrawMap final {
+  public:
+    // Clears all counts. Only allocates when the size grows.
+    void reset(size_t width, size_t height);
+
+    // Premultiplied ARGB pixels of one piece, drawn alone. Pixels with any alpha were written.
+    void add_coverage(const uint32_t * pixels, size_t stride) noexcept;
+    // Clipped to the map.
+    void add_area(float x, float y, float width, float height) noexcept;
+    void add_everywhere() noexcept;
+
+    // Replaces the pixels with a heat map: written once blue, twice green, three times yellow, four times orange and
+    // five or more times red. Pixels never written stay black.
+    void colorize(uint32_t * pixels, size_t stride) const noexcept;
+
+    // Writes summed over all pixels, which divided by the area is the average overdraw.
+    uint64_t pixel_writes() const noexcept { return _writes; }
+    uint64_t area() const noexcept { return static_cast<uint64_t>(_width) * _height; }
+
+  private:
+    std::vector<uint16_t> _counts;
+    size_t                _width  = 0;
+    size_t                _height = 0;
+    uint64_t              _writes = 0;
+};
+}
@@ -0,0 +1,105 @@
+#include "pixel_kernels_scalar.hpp"
+
+#if defined(LOTTIE_SPLASH_PIXEL_KERNELS_X86)
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+#endif
+
+namespace {
+constexpr utils::PixelKernels SCALAR_KERNELS{
+  .isa                 = utils::PixelIsa::Scalar,
+  .name                = "scalar",
+  .fill                = utils::scalar_pixels::fill,
+  .blend_over          = utils::scalar_pixels::blend_over,
+  .premultiply         = utils::scalar_pixels::premultiply,
+  .unpremultiply       = utils::scalar_pixels::unpremultiply,
+  .swap_red_blue       = utils::scalar_pixels::swap_red_blue,
+  .upscale_row_nearest = utils::scalar_pixels::upscale_row_nearest,
+  .upscale_row_linear  = utils::scalar_pixels::upscale_row_linear,
+  .average_rows        = utils::scalar_pixels::average_rows,
+};
+
+#if defined(LOTTIE_SPLASH_PIXEL_KERNELS_X86)
+// AVX2 needs both the instructions and an OS which saves the upper halves of the registers.
+bool cpu_has_avx2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if(info[0] < 7)
+        return false;
+
+    __cpuid(info, 1);
+    constexpr int OSXSAVE = 1 << 27;
+    constexpr int AVX     = 1 << 28;
+    if((info[2] & (OSXSAVE | AVX)) != (OSXSAVE | AVX) || (_xgetbv(0) & 6) != 6)
+        return false;
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+}
+
+namespace utils {
+const PixelKernels * pixel_kernels(const PixelIsa isa) noexcept {
+    switch(isa) {
+    case PixelIsa::Scalar:
+        return &SCALAR_KERNELS;
+    case PixelIsa::SSE2:
+        return sse2_pixel_kernels();
+    case PixelIsa::AVX2:
+#if defined(LOTTIE_SPLASH_PIXEL_KERNELS_X86)
+        if(cpu_has_avx2())
+            return avx2_pixel_kernels();
+#endif
+        return nullptr;
+    case PixelIsa::NEON:
+        return neon_pixel_kernels();
+    }
+    return nullptr;
+}
+
+const PixelKernels & pixel_kernels() noexcept {
+    static const PixelKernels & best = []() -> const PixelKernels & {
+        for(const auto isa : {PixelIsa::AVX2, PixelIsa::SSE2, PixelIsa::NEON}) {
+            if(const auto * kernels = pixel_kernels(isa))
+                return *kernels;
+        }
+        return SCALAR_KERNELS;
+    }();
+    return best;
+}
+
+void fill(uint32_t *           dst,
+          const size_t         dst_stride,
+          const int            width,
+          const int            height,
+          const uint32_t       color,
+          const PixelKernels & kernels) noexcept {
+    if(!dst || width <= 0 || height <= 0)
+        return;
+
+    for(int y = 0; y < height; ++y)
+        kernels.fill(dst + y * dst_stride, static_cast<size_t>(width), color);
+}
+
+void premultiply(uint32_t * dst, const uint32_t * src, const size_t count, const PixelKernels & kernels) noexcept {
+    if(dst && src)
+        kernels.premultiply(dst, src, count);
+}
+
+void unpremultiply(uint32_t * dst, const uint32_t * src, const size_t count, const PixelKernels & kernels) noexcept {
+    if(dst && src)
+        kernels.unpremultiply(dst, src, count);
+}
+
+void swap_red_blue(uint32_t * dst, const uint32_t * src, const size_t count, const PixelKernels & kernels) noexcept {
+    if(dst && src)
+        kernels.swap_red_blue(dst, src, count);
+}
+}
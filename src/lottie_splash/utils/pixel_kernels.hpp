@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace utils {
+// Row kernels for ARGB8888 pixels, with a scalar reference and SSE2, AVX2 and NEON versions which produce exactly the
+// same pixels. The version is picked by the CPU at runtime, tests and benchmarks can ask for a specific one.
+enum class PixelIsa {
+    Scalar,
+    SSE2,
+    AVX2,
+    NEON,
+};
+
+struct PixelKernels {
+    PixelIsa     isa;
+    const char * name;
+    void (*fill)(uint32_t * dst, size_t count, uint32_t color) noexcept;
+    // Premultiplied source over destination, dst = src + dst * (255 - src alpha) / 255 per channel.
+    void (*blend_over)(uint32_t * dst, const uint32_t * src, size_t count) noexcept;
+    // Color channels times alpha / 255, and back. Unpremultiplying turns pixels without alpha black. dst may be src.
+    void (*premultiply)(uint32_t * dst, const uint32_t * src, size_t count) noexcept;
+    void (*unpremultiply)(uint32_t * dst, const uint32_t * src, size_t count) noexcept;
+    // Swaps the red and blue channels, converting ARGB to ABGR and back. dst may be src.
+    void (*swap_red_blue)(uint32_t * dst, const uint32_t * src, size_t count) noexcept;
+    // One row of a 2x upscale, dst_width is at most twice src_width. Nearest repeats every pixel, linear fills the new
+    // pixels with the rounded-up average of their neighbours.
+    void (*upscale_row_nearest)(const uint32_t * src, int src_width, uint32_t * dst, int dst_width) noexcept;
+    void (*upscale_row_linear)(const uint32_t * src, int src_width, uint32_t * dst, int dst_width) noexcept;
+    // Per channel rounded-up average of two rows.
+    void (*average_rows)(const uint32_t * a, const uint32_t * b, uint32_t * dst, size_t count) noexcept;
+};
+
+// Kernels for isa, or nullptr when the build or the CPU doesn't support it.
+const PixelKernels * pixel_kernels(PixelIsa isa) noexcept;
+// The fastest kernels this CPU supports, picked on the first call.
+const PixelKernels & pixel_kernels() noexcept;
+
+// Image operations built from the row kernels. Strides are in pixels. Nothing in the library needs them yet, only
+// pixel_kernels_bench checks and times them.
+void fill(uint32_t *           dst,
+          size_t               dst_stride,
+          int                  width,
+          int                  height,
+          uint32_t             color,
+          const PixelKernels & kernels = pixel_kernels()) noexcept;
+
+void premultiply(uint32_t *           dst,
+                 const uint32_t *     src,
+                 size_t               count,
+                 const PixelKernels & kernels = pixel_kernels()) noexcept;
+void unpremultiply(uint32_t *           dst,
+                   const uint32_t *     src,
+                   size_t               count,
+                   const PixelKernels & kernels = pixel_kernels()) noexcept;
+void swap_red_blue(uint32_t *           dst,
+                   const uint32_t *     src,
+                   size_t               count,
+                   const PixelKernels & kernels = pixel_kernels()) noexcept;
+}
@@ -0,0 +1,186 @@
+#include "pixel_kernels_scalar.hpp"
+
+#if defined(LOTTIE_SPLASH_PIXEL_KERNELS_X86)
+#include <immintrin.h>
+
+// Only called after the CPU was checked, so the rest of the library doesn't need to be built for AVX2. MSVC allows the
+// intrinsics anywhere, GCC and Clang need the functions using them marked.
+#if defined(__GNUC__) || defined(__clang__)
+#define LOTTIE_SPLASH_AVX2 __attribute__((target("avx2")))
+#else
+#define LOTTIE_SPLASH_AVX2
+#endif
+
+namespace {
+namespace scalar = utils::scalar_pixels;
+
+LOTTIE_SPLASH_AVX2 inline __m256i load(const uint32_t * src) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+}
+LOTTIE_SPLASH_AVX2 inline void store(uint32_t * dst, const __m256i pixels) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), pixels);
+}
+
+// 16 bit channels of four pixels with the alpha of each repeated over its four channels.
+LOTTIE_SPLASH_AVX2 inline __m256i spread_alpha(const __m256i channels) {
+    return _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(channels, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+// a * b / 255 on 16 bit channels holding bytes, rounded like scalar::div255.
+LOTTIE_SPLASH_AVX2 inline __m256i multiply_div255(const __m256i a, const __m256i b) {
+    const __m256i product = _mm256_add_epi16(_mm256_mullo_epi16(a, b), _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(product, _mm256_srli_epi16(product, 8)), 8);
+}
+
+// Unpacking works within each 128 bit half. Pixels interleaved with others that way are put back in order here.
+LOTTIE_SPLASH_AVX2 inline void store_interleaved(uint32_t * dst, const __m256i low, const __m256i high) {
+    store(dst, _mm256_permute2x128_si256(low, high, 0x20));
+    store(dst + 8, _mm256_permute2x128_si256(low, high, 0x31));
+}
+
+LOTTIE_SPLASH_AVX2 void fill(uint32_t * dst, const size_t count, const uint32_t color) noexcept {
+    const __m256i pixels = _mm256_set1_epi32(static_cast<int>(color));
+    size_t        i      = 0;
+    for(; i + 8 <= count; i += 8)
+        store(dst + i, pixels);
+    scalar::fill(dst + i, count - i, color);
+}
+
+LOTTIE_SPLASH_AVX2 void blend_over(uint32_t * dst, const uint32_t * src, const size_t count) noexcept {
+    const __m256i zero   = _mm256_setzero_si256();
+    const __m256i opaque = _mm256_set1_epi32(255);
+    const __m256i max    = _mm256_set1_epi16(255);
+    size_t        i      = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m256i pixels = load(src + i);
+        const __m256i alpha  = _mm256_srli_epi32(pixels, 24);
+        if(_mm256_movemask_epi8(_mm256_cmpeq_epi32(alpha, zero)) == -1)
+            continue;
+        if(_mm256_movemask_epi8(_mm256_cmpeq_epi32(alpha, opaque)) == -1) {
+            store(dst + i, pixels);
+            continue;
+        }
+
+        const __m256i background = load(dst + i);
+        const __m256i low        = _mm256_unpacklo_epi8(pixels, zero);
+        const __m256i high       = _mm256_unpackhi_epi8(pixels, zero);
+        const __m256i scaled     = _mm256_packus_epi16(
+          multiply_div255(_mm256_unpacklo_epi8(background, zero), _mm256_sub_epi16(max, spread_alpha(low))),
+          multiply_div255(_mm256_unpackhi_epi8(background, zero), _mm256_sub_epi16(max, spread_alpha(high))));
+        store(dst + i, _mm256_adds_epu8(pixels, scaled));
+    }
+    scalar::blend_over(dst + i, src + i, count - i);
+}
+
+LOTTIE_SPLASH_AVX2 void premultiply(uint32_t * dst, const uint32_t * src, const size_t count) noexcept {
+    const __m256i zero       = _mm256_setzero_si256();
+    const __m256i alpha_mask = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+    size_t        i          = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m256i pixels = load(src + i);
+        const __m256i low    = _mm256_unpacklo_epi8(pixels, zero);
+        const __m256i high   = _mm256_unpackhi_epi8(pixels, zero);
+        const __m256i scaled =
+          _mm256_packus_epi16(multiply_div255(low, spread_alpha(low)), multiply_div255(high, spread_alpha(high)));
+        store(dst + i,
+              _mm256_or_si256(_mm256_andnot_si256(alpha_mask, scaled), _mm256_and_si256(pixels, alpha_mask)));
+    }
+    scalar::premultiply(dst + i, src + i, count - i);
+}
+
+// The channels of two pixels as 32 bit integers, divided by their alpha like the SSE2 version does it.
+LOTTIE_SPLASH_AVX2 inline __m256i unpremultiply_channels(const uint32_t * src) {
+    const __m256i channels = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(src)));
+    const __m256i alpha    = _mm256_shuffle_epi32(channels, _MM_SHUFFLE(3, 3, 3, 3));
+    const __m256  dividend = _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(channels), _mm256_set1_ps(255.0f)),
+                                          _mm256_cvtepi32_ps(_mm256_srli_epi32(alpha, 1)));
+    return _mm256_cvttps_epi32(_mm256_div_ps(dividend, _mm256_cvtepi32_ps(alpha)));
+}
+
+LOTTIE_SPLASH_AVX2 void unpremultiply(uint32_t * dst, const uint32_t * src, const size_t count) noexcept {
+    const __m256i zero       = _mm256_setzero_si256();
+    const __m256i alpha_mask = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+    // Packing leaves the pixels in the order 0 2 4 6 1 3 5 7.
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    size_t        i     = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m256i pixels = load(src + i);
+        // Division by a zero alpha gives garbage, those pixels are cleared below. Packing saturates to 255.
+        const __m256i low  = _mm256_packs_epi32(unpremultiply_channels(src + i), unpremultiply_channels(src + i + 2));
+        const __m256i high =
+          _mm256_packs_epi32(unpremultiply_channels(src + i + 4), unpremultiply_channels(src + i + 6));
+        const __m256i colors =
+          _mm256_andnot_si256(alpha_mask, _mm256_permutevar8x32_epi32(_mm256_packus_epi16(low, high), order));
+        const __m256i transparent = _mm256_cmpeq_epi32(_mm256_and_si256(pixels, alpha_mask), zero);
+        store(dst + i,
+              _mm256_andnot_si256(transparent, _mm256_or_si256(colors, _mm256_and_si256(pixels, alpha_mask))));
+    }
+    scalar::unpremultiply(dst + i, src + i, count - i);
+}
+
+LOTTIE_SPLASH_AVX2 void swap_red_blue(uint32_t * dst, const uint32_t * src, const size_t count) noexcept {
+    // The byte shuffle works within each 128 bit half, so both halves get the same order.
+    const __m256i order =
+      _mm256_broadcastsi128_si256(_mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15));
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+        store(dst + i, _mm256_shuffle_epi8(load(src + i), order));
+    scalar::swap_red_blue(dst + i, src + i, count - i);
+}
+
+LOTTIE_SPLASH_AVX2 void upscale_row_nearest(const uint32_t * src,
+                                            const int        src_width,
+                                            uint32_t *       dst,
+                                            const int        dst_width) noexcept {
+    int x = 0;
+    for(; x + 8 <= src_width && 2 * x + 16 <= dst_width; x += 8) {
+        const __m256i pixels = load(src + x);
+        store_interleaved(dst + 2 * x, _mm256_unpacklo_epi32(pixels, pixels), _mm256_unpackhi_epi32(pixels, pixels));
+    }
+    scalar::upscale_row_nearest(src + x, src_width - x, dst + 2 * x, dst_width - 2 * x);
+}
+
+LOTTIE_SPLASH_AVX2 void upscale_row_linear(const uint32_t * src,
+                                           const int        src_width,
+                                           uint32_t *       dst,
+                                           const int        dst_width) noexcept {
+    int x = 0;
+    for(; x + 8 < src_width && 2 * x + 16 <= dst_width; x += 8) {
+        const __m256i pixels   = load(src + x);
+        const __m256i averages = _mm256_avg_epu8(pixels, load(src + x + 1));
+        store_interleaved(
+          dst + 2 * x, _mm256_unpacklo_epi32(pixels, averages), _mm256_unpackhi_epi32(pixels, averages));
+    }
+    scalar::upscale_row_linear(src + x, src_width - x, dst + 2 * x, dst_width - 2 * x);
+}
+
+LOTTIE_SPLASH_AVX2 void
+  average_rows(const uint32_t * a, const uint32_t * b, uint32_t * dst, const size_t count) noexcept {
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+        store(dst + i, _mm256_avg_epu8(load(a + i), load(b + i)));
+    scalar::average_rows(a + i, b + i, dst + i, count - i);
+}
+
+constexpr utils::PixelKernels AVX2_KERNELS{
+  .isa                 = utils::PixelIsa::AVX2,
+  .name                = "avx2",
+  .fill                = fill,
+  .blend_over          = blend_over,
+  .premultiply         = premultiply,
+  .unpremultiply       = unpremultiply,
+  .swap_red_blue       = swap_red_blue,
+  .upscale_row_nearest = upscale_row_nearest,
+  .upscale_row_linear  = upscale_row_linear,
+  .average_rows        = average_rows,
+};
+}
+
+namespace utils {
+const PixelKernels * avx2_pixel_kernels() noexcept { return &AVX2_KERNELS; }
+}
+#else
+namespace utils {
+const PixelKernels * avx2_pixel_kernels() noexcept { return nullptr; }
+}
+#endif
@@ -0,0 +1,150 @@
+#include "pixel_kernels_scalar.hpp"
+
+#if defined(LOTTIE_SPLASH_PIXEL_KERNELS_NEON)
+#include <arm_neon.h>
+
+namespace {
+namespace scalar = utils::scalar_pixels;
+
+// Each pixel's alpha repeated in all four of its bytes.
+inline uint8x16_t spread_alpha(const uint32x4_t pixels) {
+    return vreinterpretq_u8_u32(vmulq_n_u32(vshrq_n_u32(pixels, 24), 0x01010101u));
+}
+
+// a * b / 255 per byte, rounded like scalar::div255. vrsra and vrshrn add its two roundings.
+inline uint8x16_t multiply_div255(const uint8x16_t a, const uint8x16_t b) {
+    const uint16x8_t low  = vmull_u8(vget_low_u8(a), vget_low_u8(b));
+    const uint16x8_t high = vmull_u8(vget_high_u8(a), vget_high_u8(b));
+    return vcombine_u8(vrshrn_n_u16(vrsraq_n_u16(low, low, 8), 8), vrshrn_n_u16(vrsraq_n_u16(high, high, 8), 8));
+}
+
+void fill(uint32_t * dst, const size_t count, const uint32_t color) noexcept {
+    const uint32x4_t pixels = vdupq_n_u32(color);
+    size_t           i      = 0;
+    for(; i + 4 <= count; i += 4)
+        vst1q_u32(dst + i, pixels);
+    scalar::fill(dst + i, count - i, color);
+}
+
+void blend_over(uint32_t * dst, const uint32_t * src, const size_t count) noexcept {
+    size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const uint32x4_t pixels = vld1q_u32(src + i);
+        const uint32x4_t alpha  = vshrq_n_u32(pixels, 24);
+        if(vmaxvq_u32(alpha) == 0)
+            continue;
+        if(vminvq_u32(alpha) == 255) {
+            vst1q_u32(dst + i, pixels);
+            continue;
+        }
+
+        const uint8x16_t inverse = vmvnq_u8(spread_alpha(pixels));
+        const uint8x16_t scaled  = multiply_div255(vreinterpretq_u8_u32(vld1q_u32(dst + i)), inverse);
+        vst1q_u32(dst + i, vreinterpretq_u32_u8(vqaddq_u8(vreinterpretq_u8_u32(pixels), scaled)));
+    }
+    scalar::blend_over(dst + i, src + i, count - i);
+}
+
+void premultiply(uint32_t * dst, const uint32_t * src, const size_t count) noexcept {
+    const uint32x4_t alpha_mask = vdupq_n_u32(0xFF000000u);
+    size_t           i          = 0;
+    for(; i + 4 <= count; i += 4) {
+        const uint32x4_t pixels = vld1q_u32(src + i);
+        const uint32x4_t scaled =
+          vreinterpretq_u32_u8(multiply_div255(vreinterpretq_u8_u32(pixels), spread_alpha(pixels)));
+        vst1q_u32(dst + i, vbslq_u32(alpha_mask, pixels, scaled));
+    }
+    scalar::premultiply(dst + i, src + i, count - i);
+}
+
+// One pixel's channels as 32 bit integers, divided by its alpha. Both are below 2^24, so the float quotient truncates
+// to the same integer as the scalar division.
+inline uint32x4_t unpremultiply_channels(const uint32x4_t channels) {
+    const uint32x4_t  alpha    = vdupq_laneq_u32(channels, 3);
+    const float32x4_t dividend =
+      vaddq_f32(vmulq_n_f32(vcvtq_f32_u32(channels), 255.0f), vcvtq_f32_u32(vshrq_n_u32(alpha, 1)));
+    return vcvtq_u32_f32(vdivq_f32(dividend, vcvtq_f32_u32(alpha)));
+}
+
+void unpremultiply(uint32_t * dst, const uint32_t * src, const size_t count) noexcept {
+    const uint32x4_t alpha_mask = vdupq_n_u32(0xFF000000u);
+    size_t           i          = 0;
+    for(; i + 4 <= count; i += 4) {
+        const uint32x4_t pixels = vld1q_u32(src + i);
+        const uint8x16_t bytes  = vreinterpretq_u8_u32(pixels);
+        const uint16x8_t low    = vmovl_u8(vget_low_u8(bytes));
+        const uint16x8_t high   = vmovl_u8(vget_high_u8(bytes));
+        // Division by a zero alpha gives garbage, those pixels are cleared below. Narrowing saturates to 255.
+        const uint16x8_t low_channels  = vcombine_u16(vqmovn_u32(unpremultiply_channels(vmovl_u16(vget_low_u16(low)))),
+                                                     vqmovn_u32(unpremultiply_channels(vmovl_u16(vget_high_u16(low)))));
+        const uint16x8_t high_channels =
+          vcombine_u16(vqmovn_u32(unpremultiply_channels(vmovl_u16(vget_low_u16(high)))),
+                       vqmovn_u32(unpremultiply_channels(vmovl_u16(vget_high_u16(high)))));
+        const uint32x4_t colors =
+          vreinterpretq_u32_u8(vcombine_u8(vqmovn_u16(low_channels), vqmovn_u16(high_channels)));
+        const uint32x4_t visible = vtstq_u32(pixels, alpha_mask);
+        vst1q_u32(dst + i, vandq_u32(visible, vbslq_u32(alpha_mask, pixels, colors)));
+    }
+    scalar::unpremultiply(dst + i, src + i, count - i);
+}
+
+void swap_red_blue(uint32_t * dst, const uint32_t * src, const size_t count) noexcept {
+    static constexpr uint8_t ORDER[16] = {2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15};
+    const uint8x16_t         order     = vld1q_u8(ORDER);
+    size_t                   i         = 0;
+    for(; i + 4 <= count; i += 4)
+        vst1q_u32(dst + i, vreinterpretq_u32_u8(vqtbl1q_u8(vreinterpretq_u8_u32(vld1q_u32(src + i)), order)));
+    scalar::swap_red_blue(dst + i, src + i, count - i);
+}
+
+void upscale_row_nearest(const uint32_t * src, const int src_width, uint32_t * dst, const int dst_width) noexcept {
+    int x = 0;
+    for(; x + 4 <= src_width && 2 * x + 8 <= dst_width; x += 4) {
+        const uint32x4_t pixels = vld1q_u32(src + x);
+        vst2q_u32(dst + 2 * x, uint32x4x2_t{{pixels, pixels}});
+    }
+    scalar::upscale_row_nearest(src + x, src_width - x, dst + 2 * x, dst_width - 2 * x);
+}
+
+void upscale_row_linear(const uint32_t * src, const int src_width, uint32_t * dst, const int dst_width) noexcept {
+    int x = 0;
+    for(; x + 4 < src_width && 2 * x + 8 <= dst_width; x += 4) {
+        const uint32x4_t pixels   = vld1q_u32(src + x);
+        const uint32x4_t averages = vreinterpretq_u32_u8(
+          vrhaddq_u8(vreinterpretq_u8_u32(pixels), vreinterpretq_u8_u32(vld1q_u32(src + x + 1))));
+        vst2q_u32(dst + 2 * x, uint32x4x2_t{{pixels, averages}});
+    }
+    scalar::upscale_row_linear(src + x, src_width - x, dst + 2 * x, dst_width - 2 * x);
+}
+
+void average_rows(const uint32_t * a, const uint32_t * b, uint32_t * dst, const size_t count) noexcept {
+    size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+        vst1q_u32(dst + i,
+                  vreinterpretq_u32_u8(
+                    vrhaddq_u8(vreinterpretq_u8_u32(vld1q_u32(a + i)), vreinterpretq_u8_u32(vld1q_u32(b + i)))));
+    scalar::average_rows(a + i, b + i, dst + i, count - i);
+}
+
+constexpr utils::PixelKernels NEON_KERNELS{
+  .isa                 = utils::PixelIsa::NEON,
+  .name                = "neon",
+  .fill                = fill,
+  .blend_over          = blend_over,
+  .premultiply         = premultiply,
+  .unpremultiply       = unpremultiply,
+  .swap_red_blue       = swap_red_blue,
+  .upscale_row_nearest = upscale_row_nearest,
+  .upscale_row_linear  = upscale_row_linear,
+  .average_rows        = average_rows,
+};
+}
+
+namespace utils {
+const PixelKernels * neon_pixel_kernels() noexcept { return &NEON_KERNELS; }
+}
+#else
+namespace utils {
+const PixelKernels * neon_pixel_kernels() noexcept { return nullptr; }
+}
+#endif
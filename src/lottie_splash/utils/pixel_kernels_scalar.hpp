@@ -0,0 +1,109 @@
+#pragma once
+
+// Shared by the pixel kernel implementations: the scalar reference every SIMD version has to match, which they also
+// use for the pixels left over at the end of a row.
+
+#include "pixel_kernels.hpp"
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LOTTIE_SPLASH_PIXEL_KERNELS_X86
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define LOTTIE_SPLASH_PIXEL_KERNELS_NEON
+#endif
+
+namespace utils::scalar_pixels {
+// x / 255 rounded to nearest, exact for every product of two bytes.
+inline uint32_t div255(const uint32_t x) { return (x + 128 + ((x + 128) >> 8)) >> 8; }
+
+// Per-channel (a + b + 1) / 2, the same rounding as pavgb and vrhadd.
+inline uint32_t average(const uint32_t a, const uint32_t b) { return (a | b) - (((a ^ b) & 0xFEFEFEFEu) >> 1); }
+
+inline uint32_t blend_pixel(const uint32_t src, const uint32_t dst) {
+    const uint32_t alpha = src >> 24;
+    if(alpha == 0)
+        return dst;
+    if(alpha == 255)
+        return src;
+
+    uint32_t result = 0;
+    for(int shift = 0; shift < 32; shift += 8) {
+        const uint32_t channel = ((src >> shift) & 0xFF) + div255(((dst >> shift) & 0xFF) * (255 - alpha));
+        result |= std::min(channel, 255u) << shift;
+    }
+    return result;
+}
+
+inline uint32_t premultiply_pixel(const uint32_t pixel) {
+    const uint32_t alpha  = pixel >> 24;
+    uint32_t       result = pixel & 0xFF000000u;
+    for(int shift = 0; shift < 24; shift += 8)
+        result |= div255(((pixel >> shift) & 0xFF) * alpha) << shift;
+    return result;
+}
+
+// Rounded to nearest. Channels above alpha aren't valid premultiplied colors, they saturate.
+inline uint32_t unpremultiply_pixel(const uint32_t pixel) {
+    const uint32_t alpha = pixel >> 24;
+    if(alpha == 0)
+        return 0;
+
+    uint32_t result = pixel & 0xFF000000u;
+    for(int shift = 0; shift < 24; shift += 8)
+        result |= std::min((((pixel >> shift) & 0xFF) * 255 + alpha / 2) / alpha, 255u) << shift;
+    return result;
+}
+
+inline uint32_t swap_red_blue_pixel(const uint32_t pixel) {
+    return (pixel & 0xFF00FF00u) | ((pixel >> 16) & 0xFF) | ((pixel & 0xFF) << 16);
+}
+
+inline void fill(uint32_t * dst, const size_t count, const uint32_t color) noexcept { std::fill_n(dst, count, color); }
+
+inline void blend_over(uint32_t * dst, const uint32_t * src, const size_t count) noexcept {
+    for(size_t i = 0; i < count; ++i)
+        dst[i] = blend_pixel(src[i], dst[i]);
+}
+
+inline void premultiply(uint32_t * dst, const uint32_t * src, const size_t count) noexcept {
+    for(size_t i = 0; i < count; ++i)
+        dst[i] = premultiply_pixel(src[i]);
+}
+
+inline void unpremultiply(uint32_t * dst, const uint32_t * src, const size_t count) noexcept {
+    for(size_t i = 0; i < count; ++i)
+        dst[i] = unpremultiply_pixel(src[i]);
+}
+
+inline void swap_red_blue(uint32_t * dst, const uint32_t * src, const size_t count) noexcept {
+    for(size_t i = 0; i < count; ++i)
+        dst[i] = swap_red_blue_pixel(src[i]);
+}
+
+inline void upscale_row_nearest(const uint32_t * src, int, uint32_t * dst, const int dst_width) noexcept {
+    for(int x = 0; x < dst_width; ++x)
+        dst[x] = src[x / 2];
+}
+
+inline void
+  upscale_row_linear(const uint32_t * src, const int src_width, uint32_t * dst, const int dst_width) noexcept {
+    for(int x = 0; 2 * x < dst_width; ++x) {
+        dst[2 * x] = src[x];
+        if(2 * x + 1 < dst_width)
+            dst[2 * x + 1] = average(src[x], src[std::min(x + 1, src_width - 1)]);
+    }
+}
+
+inline void average_rows(const uint32_t * a, const uint32_t * b, uint32_t * dst, const size_t count) noexcept {
+    for(size_t i = 0; i < count; ++i)
+        dst[i] = average(a[i], b[i]);
+}
+}
+
+namespace utils {
+// nullptr when the build has no such version.
+const PixelKernels * sse2_pixel_kernels() noexcept;
+const PixelKernels * avx2_pixel_kernels() noexcept;
+const PixelKernels * neon_pixel_kernels() noexcept;
+}
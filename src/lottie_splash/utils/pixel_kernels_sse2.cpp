@@ -0,0 +1,164 @@
+#include "pixel_kernels_scalar.hpp"
+
+#if defined(LOTTIE_SPLASH_PIXEL_KERNELS_X86)
+#include <emmintrin.h>
+
+namespace {
+namespace scalar = utils::scalar_pixels;
+
+inline __m128i load(const uint32_t * src) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(src)); }
+inline void    store(uint32_t * dst, const __m128i pixels) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), pixels);
+}
+
+// 16 bit channels of two pixels with the alpha of each repeated over its four channels.
+inline __m128i spread_alpha(const __m128i channels) {
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(channels, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+// a * b / 255 on 16 bit channels holding bytes, rounded like scalar::div255.
+inline __m128i multiply_div255(const __m128i a, const __m128i b) {
+    const __m128i product = _mm_add_epi16(_mm_mullo_epi16(a, b), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(product, _mm_srli_epi16(product, 8)), 8);
+}
+
+void fill(uint32_t * dst, const size_t count, const uint32_t color) noexcept {
+    const __m128i pixels = _mm_set1_epi32(static_cast<int>(color));
+    size_t        i      = 0;
+    for(; i + 4 <= count; i += 4)
+        store(dst + i, pixels);
+    scalar::fill(dst + i, count - i, color);
+}
+
+void blend_over(uint32_t * dst, const uint32_t * src, const size_t count) noexcept {
+    const __m128i zero   = _mm_setzero_si128();
+    const __m128i opaque = _mm_set1_epi32(255);
+    const __m128i max    = _mm_set1_epi16(255);
+    size_t        i      = 0;
+    for(; i + 4 <= count; i += 4) {
+        const __m128i pixels = load(src + i);
+        const __m128i alpha  = _mm_srli_epi32(pixels, 24);
+        if(_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, zero)) == 0xFFFF)
+            continue;
+        if(_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, opaque)) == 0xFFFF) {
+            store(dst + i, pixels);
+            continue;
+        }
+
+        const __m128i background = load(dst + i);
+        const __m128i low        = multiply_div255(_mm_unpacklo_epi8(background, zero),
+                                                   _mm_sub_epi16(max, spread_alpha(_mm_unpacklo_epi8(pixels, zero))));
+        const __m128i high       = multiply_div255(_mm_unpackhi_epi8(background, zero),
+                                                   _mm_sub_epi16(max, spread_alpha(_mm_unpackhi_epi8(pixels, zero))));
+        store(dst + i, _mm_adds_epu8(pixels, _mm_packus_epi16(low, high)));
+    }
+    scalar::blend_over(dst + i, src + i, count - i);
+}
+
+void premultiply(uint32_t * dst, const uint32_t * src, const size_t count) noexcept {
+    const __m128i zero       = _mm_setzero_si128();
+    const __m128i alpha_mask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    size_t        i          = 0;
+    for(; i + 4 <= count; i += 4) {
+        const __m128i pixels = load(src + i);
+        const __m128i low    = _mm_unpacklo_epi8(pixels, zero);
+        const __m128i high   = _mm_unpackhi_epi8(pixels, zero);
+        const __m128i scaled =
+          _mm_packus_epi16(multiply_div255(low, spread_alpha(low)), multiply_div255(high, spread_alpha(high)));
+        store(dst + i, _mm_or_si128(_mm_andnot_si128(alpha_mask, scaled), _mm_and_si128(pixels, alpha_mask)));
+    }
+    scalar::premultiply(dst + i, src + i, count - i);
+}
+
+// One pixel's channels as 32 bit integers, divided by its alpha. Both are below 2^24, so the float quotient truncates
+// to the same integer as the scalar division.
+inline __m128i unpremultiply_channels(const __m128i channels) {
+    const __m128i alpha    = _mm_shuffle_epi32(channels, _MM_SHUFFLE(3, 3, 3, 3));
+    const __m128  dividend = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(channels), _mm_set1_ps(255.0f)),
+                                       _mm_cvtepi32_ps(_mm_srli_epi32(alpha, 1)));
+    return _mm_cvttps_epi32(_mm_div_ps(dividend, _mm_cvtepi32_ps(alpha)));
+}
+
+void unpremultiply(uint32_t * dst, const uint32_t * src, const size_t count) noexcept {
+    const __m128i zero       = _mm_setzero_si128();
+    const __m128i alpha_mask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    size_t        i          = 0;
+    for(; i + 4 <= count; i += 4) {
+        const __m128i pixels = load(src + i);
+        const __m128i low    = _mm_unpacklo_epi8(pixels, zero);
+        const __m128i high   = _mm_unpackhi_epi8(pixels, zero);
+        // Division by a zero alpha gives garbage, those pixels are cleared below. Packing saturates to 255.
+        const __m128i low_channels  = _mm_packs_epi32(unpremultiply_channels(_mm_unpacklo_epi16(low, zero)),
+                                                     unpremultiply_channels(_mm_unpackhi_epi16(low, zero)));
+        const __m128i high_channels = _mm_packs_epi32(unpremultiply_channels(_mm_unpacklo_epi16(high, zero)),
+                                                      unpremultiply_channels(_mm_unpackhi_epi16(high, zero)));
+        const __m128i colors        = _mm_andnot_si128(alpha_mask, _mm_packus_epi16(low_channels, high_channels));
+        const __m128i transparent   = _mm_cmpeq_epi32(_mm_and_si128(pixels, alpha_mask), zero);
+        store(dst + i, _mm_andnot_si128(transparent, _mm_or_si128(colors, _mm_and_si128(pixels, alpha_mask))));
+    }
+    scalar::unpremultiply(dst + i, src + i, count - i);
+}
+
+void swap_red_blue(uint32_t * dst, const uint32_t * src, const size_t count) noexcept {
+    const __m128i kept    = _mm_set1_epi32(static_cast<int>(0xFF00FF00u));
+    const __m128i channel = _mm_set1_epi32(0xFF);
+    size_t        i       = 0;
+    for(; i + 4 <= count; i += 4) {
+        const __m128i pixels = load(src + i);
+        const __m128i red    = _mm_and_si128(_mm_srli_epi32(pixels, 16), channel);
+        const __m128i blue   = _mm_slli_epi32(_mm_and_si128(pixels, channel), 16);
+        store(dst + i, _mm_or_si128(_mm_and_si128(pixels, kept), _mm_or_si128(red, blue)));
+    }
+    scalar::swap_red_blue(dst + i, src + i, count - i);
+}
+
+void upscale_row_nearest(const uint32_t * src, const int src_width, uint32_t * dst, const int dst_width) noexcept {
+    int x = 0;
+    for(; x + 4 <= src_width && 2 * x + 8 <= dst_width; x += 4) {
+        const __m128i pixels = load(src + x);
+        store(dst + 2 * x, _mm_unpacklo_epi32(pixels, pixels));
+        store(dst + 2 * x + 4, _mm_unpackhi_epi32(pixels, pixels));
+    }
+    scalar::upscale_row_nearest(src + x, src_width - x, dst + 2 * x, dst_width - 2 * x);
+}
+
+void upscale_row_linear(const uint32_t * src, const int src_width, uint32_t * dst, const int dst_width) noexcept {
+    int x = 0;
+    for(; x + 4 < src_width && 2 * x + 8 <= dst_width; x += 4) {
+        const __m128i pixels   = load(src + x);
+        const __m128i averages = _mm_avg_epu8(pixels, load(src + x + 1));
+        store(dst + 2 * x, _mm_unpacklo_epi32(pixels, averages));
+        store(dst + 2 * x + 4, _mm_unpackhi_epi32(pixels, averages));
+    }
+    scalar::upscale_row_linear(src + x, src_width - x, dst + 2 * x, dst_width - 2 * x);
+}
+
+void average_rows(const uint32_t * a, const uint32_t * b, uint32_t * dst, const size_t count) noexcept {
+    size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+        store(dst + i, _mm_avg_epu8(load(a + i), load(b + i)));
+    scalar::average_rows(a + i, b + i, dst + i, count - i);
+}
+
+constexpr utils::PixelKernels SSE2_KERNELS{
+  .isa                 = utils::PixelIsa::SSE2,
+  .name                = "sse2",
+  .fill                = fill,
+  .blend_over          = blend_over,
+  .premultiply         = premultiply,
+  .unpremultiply       = unpremultiply,
+  .swap_red_blue       = swap_red_blue,
+  .upscale_row_nearest = upscale_row_nearest,
+  .upscale_row_linear  = upscale_row_linear,
+  .average_rows        = average_rows,
+};
+}
+
+namespace utils {
+const PixelKernels * sse2_pixel_kernels() noexcept { return &SSE2_KERNELS; }
+}
+#else
+namespace utils {
+const PixelKernels * sse2_pixel_kernels() noexcept { return nullptr; }
+}
+#endif
@@ -0,0 +1,128 @@
+#include "poster_cache.hpp"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include <Windows.h>
+
+namespace {
+constexpr uint32_t POSTER_MAGIC   = 0x4350534C; // "LSPC"
+constexpr uint32_t POSTER_VERSION = 1;
+
+struct PosterHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t width;
+    uint32_t height;
+    uint64_t content_hash;
+};
+
+struct PixelRun {
+    uint32_t count;
+    uint32_t pixel;
+};
+
+struct FileCloser {
+    void operator()(std::FILE * file) const { std::fclose(file); }
+};
+using FilePtr = std::unique_ptr<std::FILE, FileCloser>;
+
+bool write_poster(std::FILE *      file,
+                  const uint32_t * pixels,
+                  const int        width,
+                  const int        height,
+                  const uint64_t   content_hash) {
+    const PosterHeader header{.magic        = POSTER_MAGIC,
+                              .version      = POSTER_VERSION,
+                              .width        = static_cast<uint32_t>(width),
+                              .height       = static_cast<uint32_t>(height),
+                              .content_hash = content_hash};
+    if(std::fwrite(&header, sizeof(header), 1, file) != 1)
+        return false;
+
+    const size_t pixel_count = static_cast<size_t>(width) * height;
+    for(size_t i = 0; i < pixel_count;) {
+        PixelRun run{.count = 1, .pixel = pixels[i]};
+        while(i + run.count < pixel_count && pixels[i + run.count] == run.pixel && run.count < UINT32_MAX)
+            ++run.count;
+        if(std::fwrite(&run, sizeof(run), 1, file) != 1)
+            return false;
+        i += run.count;
+    }
+    return true;
+}
+}
+
+namespace utils {
+uint64_t poster_content_hash(const char * data, const size_t size) {
+    // FNV-1a
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for(size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<uint8_t>(data[i]);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+bool load_poster(const std::wstring_view path,
+                 const int               width,
+                 const int               height,
+                 const uint64_t          content_hash,
+                 std::vector<uint32_t> & out_pixels) {
+    if(path.empty() || width <= 0 || height <= 0)
+        return false;
+
+    FilePtr file{_wfopen(std::wstring{path}.c_str(), L"rb")};
+    if(!file)
+        return false;
+
+    PosterHeader header{};
+    if(std::fread(&header, sizeof(header), 1, file.get()) != 1 || header.magic != POSTER_MAGIC ||
+       header.version != POSTER_VERSION || header.width != static_cast<uint32_t>(width) ||
+       header.height != static_cast<uint32_t>(height) || header.content_hash != content_hash)
+        return false;
+
+    const size_t pixel_count = static_cast<size_t>(width) * height;
+    out_pixels.clear();
+    out_pixels.reserve(pixel_count);
+
+    PixelRun run{};
+    while(out_pixels.size() < pixel_count && std::fread(&run, sizeof(run), 1, file.get()) == 1) {
+        if(run.count == 0 || run.count > pixel_count - out_pixels.size())
+            break;
+        out_pixels.insert(out_pixels.end(), run.count, run.pixel);
+    }
+
+    if(out_pixels.size() != pixel_count) {
+        out_pixels.clear();
+        return false;
+    }
+    return true;
+}
+
+bool save_poster(const std::wstring_view path,
+                 const uint32_t *        pixels,
+                 const int               width,
+                 const int               height,
+                 const uint64_t          content_hash) {
+    if(path.empty() || !pixels || width <= 0 || height <= 0)
+        return false;
+
+    // Write next to the destination first, so a crash mid-write never leaves a truncated poster behind.
+    const std::wstring final_path{path};
+    const std::wstring temp_path = final_path + L".tmp";
+    std::FILE *        file      = _wfopen(temp_path.c_str(), L"wb");
+    if(!file)
+        return false;
+
+    const bool written = write_poster(file, pixels, width, height, content_hash);
+    // Closing flushes, so it can fail as well, e.g. on a full disk.
+    if(std::fclose(file) != 0 || !written ||
+       !MoveFileExW(temp_path.c_str(), final_path.c_str(), MOVEFILE_REPLACE_EXISTING)) {
+        _wremove(temp_path.c_str());
+        return false;
+    }
+    return true;
+}
+}
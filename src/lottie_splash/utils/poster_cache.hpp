@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace utils {
+// Poster cache files hold a single premultiplied ARGB8888 frame, run-length encoded since splash frames are mostly
+// a flat background. The content hash ties a poster to the animation it was rendered from.
+uint64_t poster_content_hash(const char * data, const size_t size);
+bool     load_poster(const std::wstring_view path,
+                     const int               width,
+                     const int               height,
+                     const uint64_t          content_hash,
+                     std::vector<uint32_t> & out_pixels);
+bool     save_poster(const std::wstring_view path,
+                     const uint32_t *        pixels,
+                     const int               width,
+                     const int               height,
+                     const uint64_t          content_hash);
+}
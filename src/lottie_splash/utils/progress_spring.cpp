@@ -0,0 +1,44 @@
+#include "progress_spring.hpp"
+
+#include <cmath>
+
+namespace {
+constexpr double SETTLED_DISTANCE = 1e-4;
+constexpr double SETTLED_VELOCITY = 1e-3;
+}
+
+namespace utils {
+void ProgressSpring::retarget(const double target, const time_point now) noexcept {
+    const double x = value(now);
+    const double v = velocity(now);
+
+    _target = target;
+    _anchor = now;
+    _c1     = x - target;
+    _c2     = v + _omega * _c1;
+}
+
+double ProgressSpring::elapsed_seconds(const time_point now) const noexcept {
+    return now > _anchor ? std::chrono::duration<double>(now - _anchor).count() : 0.0;
+}
+
+double ProgressSpring::value(const time_point now) const noexcept {
+    if(settled(now))
+        return _target;
+
+    const double t = elapsed_seconds(now);
+    return _target + (_c1 + _c2 * t) * std::exp(-_omega * t);
+}
+
+double ProgressSpring::velocity(const time_point now) const noexcept {
+    const double t = elapsed_seconds(now);
+    return (_c2 - _omega * (_c1 + _c2 * t)) * std::exp(-_omega * t);
+}
+
+bool ProgressSpring::settled(const time_point now) const noexcept {
+    const double t     = elapsed_seconds(now);
+    const double decay = std::exp(-_omega * t);
+    return std::abs((_c1 + _c2 * t) * decay) < SETTLED_DISTANCE &&
+           std::abs((_c2 - _omega * (_c1 + _c2 * t)) * decay) < SETTLED_VELOCITY;
+}
+}
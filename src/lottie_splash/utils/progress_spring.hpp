@@ -0,0 +1,31 @@
+#pragma once
+
+#include <chrono>
+
+namespace utils {
+// Critically damped spring evaluated in closed form. The result only depends on the sample time, not on how often it's
+// sampled, and retargeting keeps both position and velocity continuous, so frequent updates never restart the motion.
+class ProgressSpring final {
+  public:
+    using time_point = std::chrono::nanoseconds;
+
+    explicit ProgressSpring(const double angular_frequency = 14.0) noexcept : _omega(angular_frequency) {}
+
+    void   retarget(const double target, const time_point now) noexcept;
+    double value(const time_point now) const noexcept;
+    double velocity(const time_point now) const noexcept;
+    double target() const noexcept { return _target; }
+    // True once the spring is closer to its target than anything a progress bar could display.
+    bool   settled(const time_point now) const noexcept;
+
+  private:
+    double elapsed_seconds(const time_point now) const noexcept;
+
+    double     _omega;
+    double     _target = 0.0;
+    // x(t) = target + (c1 + c2 * t) * e^(-omega * t), with t measured from the anchor
+    double     _c1 = 0.0;
+    double     _c2 = 0.0;
+    time_point _anchor{};
+};
+}
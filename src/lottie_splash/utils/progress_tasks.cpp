@@ -0,0 +1,40 @@
+#include "progress_tasks.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace utils {
+ProgressTasks::Task * ProgressTasks::add(const float weight) noexcept {
+    // An infinite weight would turn the aggregate into inf / inf.
+    if(!(weight > 0.0f) || !std::isfinite(weight))
+        return nullptr;
+
+    std::lock_guard lock{_add_mutex};
+    const uint32_t  index = _task_count.load(std::memory_order_relaxed);
+    if(index >= MAX_TASKS)
+        return nullptr;
+
+    _tasks[index].weight = weight;
+    _task_count.store(index + 1, std::memory_order_release);
+    return &_tasks[index];
+}
+
+void ProgressTasks::advance(Task & task, const uint64_t done, const uint64_t total) noexcept {
+    const double fraction = total ? static_cast<double>(std::min(done, total)) / static_cast<double>(total) : 1.0;
+    task.fraction.store(fraction, std::memory_order_relaxed);
+}
+
+std::optional<float> ProgressTasks::aggregate() const noexcept {
+    const uint32_t count = _task_count.load(std::memory_order_acquire);
+    if(!count)
+        return std::nullopt;
+
+    double weighted_sum = 0.0;
+    double total_weight = 0.0;
+    for(uint32_t i = 0; i < count; ++i) {
+        weighted_sum += _tasks[i].fraction.load(std::memory_order_relaxed) * _tasks[i].weight;
+        total_weight += _tasks[i].weight;
+    }
+    return static_cast<float>(weighted_sum / total_weight);
+}
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
+namespace utils {
+// Aggregates weighted progress reported concurrently by many producers. Producers only touch their own cache line,
+// and the render thread sums all tasks once per frame.
+class ProgressTasks final {
+  public:
+    static constexpr size_t MAX_TASKS = 64;
+
+    struct alignas(64) Task {
+        std::atomic<double> fraction = 0.0;
+        float               weight   = 0.0f;
+    };
+
+    // Returns nullptr if the weight isn't positive and finite or all task slots are taken.
+    Task *      add(const float weight) noexcept;
+    static void advance(Task & task, const uint64_t done, const uint64_t total) noexcept;
+
+    // Weighted mean of all task fractions, or nullopt if no tasks were added.
+    std::optional<float> aggregate() const noexcept;
+
+  private:
+    std::mutex                  _add_mutex;
+    std::array<Task, MAX_TASKS> _tasks;
+    std::atomic_uint32_t        _task_count = 0;
+};
+}
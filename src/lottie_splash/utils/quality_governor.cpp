@@ -0,0 +1,90 @@
+#include "quality_governor.hpp"
+
+#include <algorithm>
+
+namespace {
+using Level = utils::QualityGovernor::Level;
+
+constexpr std::chrono::milliseconds STEP_DOWN_AFTER{250};
+constexpr std::chrono::seconds      MIN_STEP_UP_DELAY{2};
+constexpr std::chrono::seconds      MAX_STEP_UP_DELAY{30};
+// The level above has to fit into this part of the budget, so measurement noise doesn't make levels flap.
+constexpr double STEP_UP_HEADROOM = 0.6;
+constexpr double LOAD_SMOOTHING   = 0.1;
+
+// Rough cost of a frame relative to a full quality one.
+double relative_frame_cost(const Level level) {
+    switch(level) {
+    case Level::ReducedResolution:
+        return 0.35;
+    case Level::Frozen:
+        return 0.1;
+    default:
+        return 1.0;
+    }
+}
+}
+
+namespace utils {
+uint32_t QualityGovernor::frame_interval_multiplier(const Level level) noexcept {
+    switch(level) {
+    case Level::Full:
+        return 1;
+    case Level::Frozen:
+        return 8;
+    default:
+        return 4;
+    }
+}
+
+bool QualityGovernor::report(const duration render_time, const duration frame_interval) noexcept {
+    if(frame_interval <= duration::zero())
+        return false;
+
+    const double frame_load = std::chrono::duration<double>(render_time) / std::chrono::duration<double>(frame_interval);
+    _load                   = _load < 0.0 ? frame_load : _load + (frame_load - _load) * LOAD_SMOOTHING;
+
+    if(_stepped_up) {
+        _since_step_up += frame_interval;
+        // The step up held, so the next one doesn't need to wait for long either.
+        if(_since_step_up >= _step_up_delay) {
+            _stepped_up    = false;
+            _step_up_delay = MIN_STEP_UP_DELAY;
+        }
+    }
+
+    _over_budget = _load > _cpu_share ? _over_budget + frame_interval : duration::zero();
+    if(_over_budget >= STEP_DOWN_AFTER && _level != Level::Frozen) {
+        // Time spent back at the lower level mustn't count as the step up having held.
+        if(_stepped_up) {
+            _step_up_delay = std::min<duration>(_step_up_delay * 2, MAX_STEP_UP_DELAY);
+            _stepped_up    = false;
+        }
+        change_level(static_cast<Level>(static_cast<uint8_t>(_level) + 1));
+        return true;
+    }
+
+    if(_level == Level::Full)
+        return false;
+
+    const Level  upper          = static_cast<Level>(static_cast<uint8_t>(_level) - 1);
+    const double predicted_load = _load * relative_frame_cost(upper) / relative_frame_cost(_level) *
+                                  frame_interval_multiplier(_level) / frame_interval_multiplier(upper);
+    _headroom = predicted_load <= _cpu_share * STEP_UP_HEADROOM ? _headroom + frame_interval : duration::zero();
+    if(_headroom < _step_up_delay)
+        return false;
+
+    change_level(upper);
+    _stepped_up    = true;
+    _since_step_up = duration::zero();
+    return true;
+}
+
+void QualityGovernor::change_level(const Level level) noexcept {
+    _level       = level;
+    _load        = -1.0;
+    _over_budget = duration::zero();
+    _headroom    = duration::zero();
+    ++_level_changes;
+}
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace utils {
+// Trades visual quality for CPU time one step at a time. It watches how much of a core rendering takes at the current
+// level and steps down when that exceeds the allowed share for a while, then steps back up once the cost predicted for
+// the level above fits comfortably. Steps up which had to be undone quickly make the next attempt wait longer.
+class QualityGovernor final {
+  public:
+    using duration = std::chrono::nanoseconds;
+
+    enum class Level : uint8_t {
+        Full,
+        ReducedFrameRate,
+        // The logo is rendered at half resolution and upscaled.
+        ReducedResolution,
+        // The logo stops animating and a cached frame is shown, only the overlay is still updated.
+        Frozen,
+    };
+
+    explicit QualityGovernor(const double cpu_share = 0.5) noexcept : _cpu_share(cpu_share) {}
+
+    // Fraction of one core rendering may use, e.g. 0.25 for a quarter of a core.
+    void set_cpu_share(const double cpu_share) noexcept { _cpu_share = cpu_share; }
+    // Reports the cost of a frame rendered at level(), which was scheduled frame_interval after the previous one.
+    // Returns true if the level changed.
+    bool report(const duration render_time, const duration frame_interval) noexcept;
+
+    Level    level() const noexcept { return _level; }
+    double   load() const noexcept { return _load; }
+    uint64_t level_changes() const noexcept { return _level_changes; }
+
+    // How many base frame intervals a frame at the given level lasts.
+    static uint32_t frame_interval_multiplier(const Level level) noexcept;
+
+  private:
+    void change_level(const Level level) noexcept;
+
+    double   _cpu_share;
+    Level    _level = Level::Full;
+    // Smoothed fraction of a core used at the current level. Negative until the first report at that level.
+    double   _load = -1.0;
+    duration _over_budget{};
+    duration _headroom{};
+    duration _since_step_up{};
+    duration _step_up_delay = std::chrono::seconds{2};
+    bool     _stepped_up    = false;
+    uint64_t _level_changes = 0;
+};
+}
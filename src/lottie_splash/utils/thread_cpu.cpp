@@ -0,0 +1,83 @@
+#include "thread_cpu.hpp"
+
+#include <tlhelp32.h>
+#include <winternl.h>
+
+#include <algorithm>
+
+namespace {
+// ThreadQuerySetWin32StartAddress, which winternl.h doesn't declare.
+constexpr ULONG THREAD_START_ADDRESS_INFORMATION = 9;
+
+using NtQueryInformationThreadPtr = NTSTATUS(WINAPI *)(HANDLE, ULONG, PVOID, ULONG, PULONG);
+const auto nt_query_information_thread = reinterpret_cast<NtQueryInformationThreadPtr>(
+  GetProcAddress(GetModuleHandleW(L"ntdll.dll"), "NtQueryInformationThread"));
+
+// FILETIME durations are in 100 ns units.
+std::chrono::nanoseconds to_duration(const FILETIME & time) {
+    const uint64_t ticks = (static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+    return std::chrono::nanoseconds{static_cast<int64_t>(ticks) * 100};
+}
+}
+
+namespace utils {
+std::vector<DWORD> current_process_thread_ids() {
+    std::vector<DWORD> ids;
+
+    const HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPTHREAD, 0);
+    if(snapshot == INVALID_HANDLE_VALUE)
+        return ids;
+
+    const DWORD   process_id = GetCurrentProcessId();
+    THREADENTRY32 entry{.dwSize = sizeof(entry)};
+    for(BOOL found = Thread32First(snapshot, &entry); found; found = Thread32Next(snapshot, &entry)) {
+        if(entry.th32OwnerProcessID == process_id)
+            ids.push_back(entry.th32ThreadID);
+    }
+    CloseHandle(snapshot);
+
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+void * thread_start_address(const DWORD thread_id) {
+    if(!nt_query_information_thread)
+        return nullptr;
+
+    const HANDLE thread = OpenThread(THREAD_QUERY_INFORMATION, FALSE, thread_id);
+    if(!thread)
+        return nullptr;
+
+    void * start = nullptr;
+    if(!NT_SUCCESS(nt_query_information_thread(
+         thread, THREAD_START_ADDRESS_INFORMATION, &start, sizeof(start), nullptr)))
+        start = nullptr;
+    CloseHandle(thread);
+    return start;
+}
+
+bool ThreadCpuMeter::track(const DWORD thread_id) noexcept {
+    const HANDLE thread = OpenThread(THREAD_QUERY_LIMITED_INFORMATION, FALSE, thread_id);
+    if(!thread)
+        return false;
+
+    _threads.push_back(thread);
+    return true;
+}
+
+void ThreadCpuMeter::clear() noexcept {
+    for(const HANDLE thread : _threads)
+        CloseHandle(thread);
+    _threads.clear();
+}
+
+std::chrono::nanoseconds ThreadCpuMeter::total() const noexcept {
+    std::chrono::nanoseconds total{};
+    for(const HANDLE thread : _threads) {
+        FILETIME creation, exit, kernel, user;
+        if(GetThreadTimes(thread, &creation, &exit, &kernel, &user))
+            total += to_duration(kernel) + to_duration(user);
+    }
+    return total;
+}
+}
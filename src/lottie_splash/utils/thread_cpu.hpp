@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include <Windows.h>
+
+namespace utils {
+// Ids of all threads of the current process, e.g. to find the ones a library started by diffing two snapshots.
+std::vector<DWORD> current_process_thread_ids();
+// Address the thread began running at, e.g. the C runtime's entry point for every std::thread of a module. nullptr if
+// it can't be queried.
+void * thread_start_address(DWORD thread_id);
+
+// Sums the CPU time of a set of threads. The OS only updates thread times on scheduler ticks, so differences between
+// two readings are only meaningful over windows much longer than a tick.
+class ThreadCpuMeter final {
+  public:
+    ThreadCpuMeter() noexcept = default;
+    ~ThreadCpuMeter() noexcept { clear(); }
+    ThreadCpuMeter(const ThreadCpuMeter &)             = delete;
+    ThreadCpuMeter & operator=(const ThreadCpuMeter &) = delete;
+
+    bool track(const DWORD thread_id) noexcept;
+    void clear() noexcept;
+
+    // Kernel and user time of all tracked threads. Threads which exited keep reporting their final time.
+    std::chrono::nanoseconds total() const noexcept;
+    size_t                   size() const noexcept { return _threads.size(); }
+
+  private:
+    std::vector<HANDLE> _threads;
+};
+}
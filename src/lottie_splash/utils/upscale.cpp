@@ -0,0 +1,53 @@
+#include "upscale.hpp"
+
+#include <algorithm>
+
+namespace {
+// Even rows are stretched source rows, odd rows are then blended from the even rows around them.
+void upscale_rows(const uint32_t *            src,
+                  const int                   src_width,
+                  const int                   src_height,
+                  uint32_t *                  dst,
+                  const int                   dst_width,
+                  const int                   dst_height,
+                  const utils::PixelKernels & kernels,
+                  const bool                  nearest) {
+    if(!src || !dst || src_width <= 0 || src_height <= 0 || dst_width <= 0 || dst_height <= 0 ||
+       dst_width > 2 * src_width || dst_height > 2 * src_height)
+        return;
+
+    const auto dst_row     = [&](const int y) { return dst + static_cast<size_t>(y) * dst_width; };
+    const auto upscale_row = nearest ? kernels.upscale_row_nearest : kernels.upscale_row_linear;
+    for(int y = 0; y < dst_height; y += 2)
+        upscale_row(src + static_cast<size_t>(y / 2) * src_width, src_width, dst_row(y), dst_width);
+
+    for(int y = 1; y < dst_height; y += 2) {
+        if(!nearest && y + 1 < dst_height)
+            kernels.average_rows(dst_row(y - 1), dst_row(y + 1), dst_row(y), dst_width);
+        else
+            std::copy_n(dst_row(y - 1), dst_width, dst_row(y));
+    }
+}
+}
+
+namespace utils {
+void upscale_2x(const uint32_t *     src,
+                const int            src_width,
+                const int            src_height,
+                uint32_t *           dst,
+                const int            dst_width,
+                const int            dst_height,
+                const PixelKernels & kernels) noexcept {
+    upscale_rows(src, src_width, src_height, dst, dst_width, dst_height, kernels, false);
+}
+
+void upscale_2x_nearest(const uint32_t *     src,
+                        const int            src_width,
+                        const int            src_height,
+                        uint32_t *           dst,
+                        const int            dst_width,
+                        const int            dst_height,
+                        const PixelKernels & kernels) noexcept {
+    upscale_rows(src, src_width, src_height, dst, dst_width, dst_height, kernels, true);
+}
+}
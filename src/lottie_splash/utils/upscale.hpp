@@ -0,0 +1,25 @@
+#pragma once
+
+#include "pixel_kernels.hpp"
+
+#include <cstdint>
+
+namespace utils {
+// Doubles the size of a premultiplied ARGB8888 image, filling the new pixels with the rounded-up average of their
+// neighbours. Only the top-left dst_width x dst_height pixels are written, which may be at most twice the source size.
+void upscale_2x(const uint32_t *     src,
+                int                  src_width,
+                int                  src_height,
+                uint32_t *           dst,
+                int                  dst_width,
+                int                  dst_height,
+                const PixelKernels & kernels = pixel_kernels()) noexcept;
+// The same, repeating every source pixel instead.
+void upscale_2x_nearest(const uint32_t *     src,
+                        int                  src_width,
+                        int                  src_height,
+                        uint32_t *           dst,
+                        int                  dst_width,
+                        int                  dst_height,
+                        const PixelKernels & kernels = pixel_kernels()) noexcept;
+}
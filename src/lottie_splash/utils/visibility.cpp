@@ -0,0 +1,25 @@
+#include "visibility.hpp"
+
+namespace utils {
+VisibilityState::Transition VisibilityState::update(VisibilitySource & source, const duration now) noexcept {
+    const bool was_visible = visible();
+    _reasons               = source.hidden_reasons();
+    _last_update           = now;
+
+    if(was_visible == visible())
+        return Transition::None;
+
+    if(!visible()) {
+        _hidden_since = now;
+        ++_times_hidden;
+        return Transition::Hidden;
+    }
+
+    _hidden_time += now - _hidden_since;
+    return Transition::Shown;
+}
+
+VisibilityState::duration VisibilityState::hidden_time() const noexcept {
+    return visible() ? _hidden_time : _hidden_time + (_last_update - _hidden_since);
+}
+}
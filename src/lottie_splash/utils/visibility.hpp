@@ -0,0 +1,50 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace utils {
+// Bit flags, a window is visible when none of them are set.
+enum HiddenReason : uint32_t {
+    HIDDEN_MINIMIZED      = 1u << 0,
+    HIDDEN_CLOAKED        = 1u << 1,
+    HIDDEN_SESSION_LOCKED = 1u << 2,
+    HIDDEN_OFF_SCREEN     = 1u << 3,
+    HIDDEN_OCCLUDED       = 1u << 4,
+};
+
+// Reports why a window currently can't be seen. Implementations may track events, poll the window system, or both.
+class VisibilitySource {
+  public:
+    virtual ~VisibilitySource() = default;
+
+    virtual uint32_t hidden_reasons() noexcept = 0;
+};
+
+// Turns the reasons reported by a source into hide and show transitions, and accounts for the time spent hidden.
+class VisibilityState final {
+  public:
+    using duration = std::chrono::nanoseconds;
+
+    enum class Transition {
+        None,
+        Hidden,
+        Shown,
+    };
+
+    Transition update(VisibilitySource & source, const duration now) noexcept;
+
+    bool     visible() const noexcept { return _reasons == 0; }
+    uint32_t reasons() const noexcept { return _reasons; }
+    uint64_t times_hidden() const noexcept { return _times_hidden; }
+    // Includes the ongoing hidden period, as of the last update.
+    duration hidden_time() const noexcept;
+
+  private:
+    uint32_t _reasons = 0;
+    duration _hidden_since{};
+    duration _last_update{};
+    duration _hidden_time{};
+    uint64_t _times_hidden = 0;
+};
+}
@@ -0,0 +1,56 @@
+#include "win32_visibility.hpp"
+
+#include <dwmapi.h>
+#include <wtsapi32.h>
+
+namespace utils {
+void Win32VisibilitySource::attach(const HWND window) noexcept {
+    detach();
+    _window               = window;
+    _event_reasons        = IsIconic(window) ? HIDDEN_MINIMIZED : 0;
+    _session_notification = WTSRegisterSessionNotification(window, NOTIFY_FOR_THIS_SESSION);
+}
+
+void Win32VisibilitySource::detach() noexcept {
+    if(_session_notification && IsWindow(_window))
+        WTSUnRegisterSessionNotification(_window);
+
+    _window               = nullptr;
+    _session_notification = false;
+    _event_reasons        = 0;
+}
+
+void Win32VisibilitySource::on_message(const UINT message, const WPARAM wparam) noexcept {
+    switch(message) {
+    case WM_SIZE:
+        if(wparam == SIZE_MINIMIZED)
+            _event_reasons |= HIDDEN_MINIMIZED;
+        else if(wparam == SIZE_RESTORED || wparam == SIZE_MAXIMIZED)
+            _event_reasons &= ~HIDDEN_MINIMIZED;
+        break;
+
+    case WM_WTSSESSION_CHANGE:
+        if(wparam == WTS_SESSION_LOCK)
+            _event_reasons |= HIDDEN_SESSION_LOCKED;
+        else if(wparam == WTS_SESSION_UNLOCK)
+            _event_reasons &= ~HIDDEN_SESSION_LOCKED;
+        break;
+    }
+}
+
+uint32_t Win32VisibilitySource::hidden_reasons() noexcept {
+    if(!_window)
+        return 0;
+
+    uint32_t reasons = _event_reasons;
+
+    DWORD cloaked = 0;
+    if(SUCCEEDED(DwmGetWindowAttribute(_window, DWMWA_CLOAKED, &cloaked, sizeof(cloaked))) && cloaked)
+        reasons |= HIDDEN_CLOAKED;
+
+    if(!(reasons & HIDDEN_MINIMIZED) && !MonitorFromWindow(_window, MONITOR_DEFAULTTONULL))
+        reasons |= HIDDEN_OFF_SCREEN;
+
+    return reasons;
+}
+}
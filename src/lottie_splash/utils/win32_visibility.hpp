@@ -0,0 +1,27 @@
+#pragma once
+
+#include "visibility.hpp"
+
+#include <Windows.h>
+
+namespace utils {
+// Minimizing and session locks arrive as window messages, which the window forwards to on_message. Cloaking, e.g. by
+// switching virtual desktops, and leaving all monitors are polled. DWM composition hides occlusion from GDI, so
+// HIDDEN_OCCLUDED isn't reported.
+class Win32VisibilitySource final : public VisibilitySource {
+  public:
+    ~Win32VisibilitySource() noexcept override { detach(); }
+
+    // Registers for session notifications, the registration is undone by detach or the destructor.
+    void attach(HWND window) noexcept;
+    void detach() noexcept;
+
+    void     on_message(UINT message, WPARAM wparam) noexcept;
+    uint32_t hidden_reasons() noexcept override;
+
+  private:
+    HWND     _window               = nullptr;
+    bool     _session_notification = false;
+    uint32_t _event_reasons        = 0;
+};
+}
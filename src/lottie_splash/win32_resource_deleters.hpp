@@ -15,6 +15,13 @@ struct DCDeleter final {
     }
 };
 
+struct HandleDeleter final {
+    inline void operator()(HANDLE handle) const {
+        if(handle)
+            CloseHandle(handle);
+    }
+};
+
 struct GLContextDeleter final {
     inline void operator()(HGLRC hglrc) const {
         if(hglrc) {
@@ -0,0 +1,35 @@
+#include "compare.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace lottie_tools {
+Difference compare(const std::span<const uint32_t> a, const std::span<const uint32_t> b) noexcept {
+    Difference difference;
+    const size_t count = std::min(a.size(), b.size());
+    if(a.size() != b.size())
+        difference.differing_pixels = std::max(a.size(), b.size()) - count;
+
+    uint64_t squared_error = 0;
+    for(size_t i = 0; i < count; ++i) {
+        if(a[i] == b[i])
+            continue;
+
+        ++difference.differing_pixels;
+        for(int shift = 0; shift < 32; shift += 8) {
+            const int channel_difference = std::abs(static_cast<int>((a[i] >> shift) & 0xff) -
+                                                    static_cast<int>((b[i] >> shift) & 0xff));
+            difference.max_channel_difference =
+              std::max(difference.max_channel_difference, static_cast<uint32_t>(channel_difference));
+            squared_error += static_cast<uint64_t>(channel_difference * channel_difference);
+        }
+    }
+
+    if(squared_error && count) {
+        const double mean_squared_error = static_cast<double>(squared_error) / (count * 4.0);
+        difference.psnr                 = 10.0 * std::log10(255.0 * 255.0 / mean_squared_error);
+    }
+    return difference;
+}
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace lottie_tools {
+struct Difference {
+    uint64_t differing_pixels       = 0;
+    uint32_t max_channel_difference = 0;
+    // Over all four channels, infinite for identical images.
+    double psnr = std::numeric_limits<double>::infinity();
+};
+
+// Both images are premultiplied ARGB8888 of the same size.
+Difference compare(std::span<const uint32_t> a, std::span<const uint32_t> b) noexcept;
+}
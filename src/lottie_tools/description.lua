@@ -0,0 +1,11 @@
+kind "StaticLib"
+links {"deps"}
+dependson {"deps"}
+runtime "Release"
+
+externalincludedirs {
+  "src/deps/thorvg/inc",
+  "src/deps/config/",
+  -- thorvg's own copy of rapidjson, so the tools read documents the same way its loader does.
+  "src/deps/thorvg/src/loaders/lottie",
+}
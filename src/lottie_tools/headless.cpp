@@ -0,0 +1,60 @@
+#include "headless.hpp"
+
+#include <cmath>
+
+namespace lottie_tools {
+Engine::Engine() noexcept
+    : _initialized(tvg::Initializer::init(0, tvg::CanvasEngine::Sw) == tvg::Result::Success) {}
+
+Engine::~Engine() noexcept {
+    if(_initialized)
+        tvg::Initializer::term(tvg::CanvasEngine::Sw);
+}
+
+bool HeadlessAnimation::load(const std::string_view json) noexcept {
+    _canvas.reset();
+    _animation.reset(tvg::Animation::gen());
+    if(!_animation)
+        return false;
+
+    auto * picture = _animation->picture();
+    if(!picture ||
+       picture->load(json.data(), static_cast<uint32_t>(json.size()), "application/json", "", true) !=
+         tvg::Result::Success)
+        return false;
+
+    float w;
+    float h;
+    picture->size(&w, &h);
+    _width  = static_cast<uint32_t>(std::ceil(w));
+    _height = static_cast<uint32_t>(std::ceil(h));
+    if(!_width || !_height)
+        return false;
+
+    _pixels.assign(static_cast<size_t>(_width) * _height, 0);
+    _canvas.reset(tvg::SwCanvas::gen());
+    return _canvas &&
+           static_cast<tvg::SwCanvas *>(_canvas.get())
+               ->target(_pixels.data(), _width, _width, _height, tvg::ColorSpace::ARGB8888) == tvg::Result::Success &&
+           _canvas->push(picture) == tvg::Result::Success;
+}
+
+float HeadlessAnimation::total_frames() const noexcept { return _animation ? _animation->totalFrame() : 0.f; }
+
+float HeadlessAnimation::duration() const noexcept { return _animation ? _animation->duration() : 0.f; }
+
+bool HeadlessAnimation::update(const float frame) noexcept {
+    if(!_canvas)
+        return false;
+
+    // Asking for the frame that is already shown isn't an error.
+    const auto result = _animation->frame(frame);
+    if(result != tvg::Result::Success && result != tvg::Result::InsufficientCondition)
+        return false;
+    return _canvas->update() == tvg::Result::Success;
+}
+
+bool HeadlessAnimation::render(const float frame) noexcept {
+    return update(frame) && _canvas->draw(true) == tvg::Result::Success && _canvas->sync() == tvg::Result::Success;
+}
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <thorvg.h>
+
+namespace lottie_tools {
+// Initializes thorvg's software engine for the lifetime of the object. Without worker threads, so frames render the
+// same way every time and measured costs aren't spread across threads.
+class Engine final {
+  public:
+    Engine() noexcept;
+    ~Engine() noexcept;
+
+    Engine(const Engine &)             = delete;
+    Engine & operator=(const Engine &) = delete;
+
+    bool initialized() const noexcept { return _initialized; }
+
+  private:
+    bool _initialized = false;
+};
+
+// A lottie animation rendered into a premultiplied ARGB8888 buffer at its own size, loaded the same way the splash
+// window loads its logo.
+class HeadlessAnimation final {
+  public:
+    bool load(std::string_view json) noexcept;
+
+    float    total_frames() const noexcept;
+    float    duration() const noexcept;
+    uint32_t width() const noexcept { return _width; }
+    uint32_t height() const noexcept { return _height; }
+
+    // Evaluates the animation at `frame` without rasterizing it, the paints' transforms and opacities are up to date
+    // afterwards.
+    bool update(float frame) noexcept;
+    bool render(float frame) noexcept;
+
+    std::span<const uint32_t> pixels() const noexcept { return _pixels; }
+    tvg::Animation *          animation() const noexcept { return _animation.get(); }
+    tvg::Canvas *             canvas() const noexcept { return _canvas.get(); }
+
+  private:
+    std::unique_ptr<tvg::Animation> _animation;
+    std::unique_ptr<tvg::Canvas>    _canvas;
+    std::vector<uint32_t>           _pixels;
+    uint32_t                        _width  = 0;
+    uint32_t                        _height = 0;
+};
+}
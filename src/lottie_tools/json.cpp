@@ -0,0 +1,164 @@
+#include "json.hpp"
+
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+
+namespace lottie_tools {
+namespace {
+void append_string(std::string & out, const std::string_view string) {
+    out += '"';
+    for(const char c : string) {
+        switch(c) {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        case '\n':
+            out += "\\n";
+            break;
+        case '\r':
+            out += "\\r";
+            break;
+        case '\t':
+            out += "\\t";
+            break;
+        default:
+            if(static_cast<unsigned char>(c) < 0x20) {
+                char escaped[8];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                out += escaped;
+            } else {
+                out += c;
+            }
+        }
+    }
+    out += '"';
+}
+
+void append_number(std::string & out, const rapidjson::Value & value) {
+    char buffer[32];
+    auto result = std::to_chars_result{};
+    if(value.IsInt64()) {
+        result = std::to_chars(std::begin(buffer), std::end(buffer), value.GetInt64());
+    } else if(value.IsUint64()) {
+        result = std::to_chars(std::begin(buffer), std::end(buffer), value.GetUint64());
+    } else {
+        const double number = value.GetDouble();
+        if(!std::isfinite(number)) {
+            out += '0';
+            return;
+        }
+        const auto as_float = static_cast<float>(number);
+        result              = static_cast<double>(as_float) == number
+                                ? std::to_chars(std::begin(buffer), std::end(buffer), as_float)
+                                : std::to_chars(std::begin(buffer), std::end(buffer), number);
+    }
+    out.append(buffer, result.ptr);
+}
+
+void append_value(std::string & out, const rapidjson::Value & value) {
+    switch(value.GetType()) {
+    case rapidjson::kNullType:
+        out += "null";
+        break;
+    case rapidjson::kFalseType:
+        out += "false";
+        break;
+    case rapidjson::kTrueType:
+        out += "true";
+        break;
+    case rapidjson::kStringType:
+        append_string(out, {value.GetString(), value.GetStringLength()});
+        break;
+    case rapidjson::kNumberType:
+        append_number(out, value);
+        break;
+    case rapidjson::kArrayType: {
+        out += '[';
+        bool first = true;
+        for(const auto & element : value.GetArray()) {
+            if(!first)
+                out += ',';
+            first = false;
+            append_value(out, element);
+        }
+        out += ']';
+        break;
+    }
+    case rapidjson::kObjectType: {
+        out += '{';
+        bool first = true;
+        for(const auto & member : value.GetObject()) {
+            if(!first)
+                out += ',';
+            first = false;
+            append_string(out, {member.name.GetString(), member.name.GetStringLength()});
+            out += ':';
+            append_value(out, member.value);
+        }
+        out += '}';
+        break;
+    }
+    }
+}
+}
+
+bool read_file(const std::filesystem::path & path, std::string & out) noexcept {
+    std::FILE * file = nullptr;
+#ifdef _WIN32
+    _wfopen_s(&file, path.c_str(), L"rb");
+#else
+    file = std::fopen(path.c_str(), "rb");
+#endif
+    if(!file)
+        return false;
+
+    out.clear();
+    char   buffer[64 * 1024];
+    size_t read;
+    while((read = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+        out.append(buffer, read);
+    const bool ok = !std::ferror(file);
+    std::fclose(file);
+    return ok;
+}
+
+bool write_file(const std::filesystem::path & path, const std::string_view data) noexcept {
+    std::FILE * file = nullptr;
+#ifdef _WIN32
+    _wfopen_s(&file, path.c_str(), L"wb");
+#else
+    file = std::fopen(path.c_str(), "wb");
+#endif
+    if(!file)
+        return false;
+
+    const bool ok = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    return std::fclose(file) == 0 && ok;
+}
+
+std::string to_json(const rapidjson::Value & value) {
+    std::string out;
+    append_value(out, value);
+    return out;
+}
+
+std::string_view string_member(const rapidjson::Value & object, const char * name) noexcept {
+    if(!object.IsObject())
+        return {};
+    const auto member = object.FindMember(name);
+    return member != object.MemberEnd() && member->value.IsString()
+             ? std::string_view{member->value.GetString(), member->value.GetStringLength()}
+             : std::string_view{};
+}
+
+double number_member(const rapidjson::Value & object, const char * name, const double fallback) noexcept {
+    if(!object.IsObject())
+        return fallback;
+    const auto member = object.FindMember(name);
+    return member != object.MemberEnd() && member->value.IsNumber() ? member->value.GetDouble() : fallback;
+}
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+#include <rapidjson/document.h>
+
+namespace lottie_tools {
+bool read_file(const std::filesystem::path & path, std::string & out) noexcept;
+bool write_file(const std::filesystem::path & path, std::string_view data) noexcept;
+
+// Compact JSON. Numbers which are exactly representable as float, i.e. everything thorvg reads back, are written with
+// the fewest digits that round-trip as float, so baked and rewritten files don't grow 17 digit numbers.
+std::string to_json(const rapidjson::Value & value);
+
+// Value of an object's member, or the fallback when it's missing or has another type.
+std::string_view string_member(const rapidjson::Value & object, const char * name) noexcept;
+double           number_member(const rapidjson::Value & object, const char * name, double fallback) noexcept;
+
+// Calls visit(value, parent_object, key) for every member of every object below `value`, depth first.
+template <typename Visitor>
+void for_each_member(rapidjson::Value & value, Visitor && visit) {
+    if(value.IsObject()) {
+        for(auto & member : value.GetObject()) {
+            visit(member.value, value, std::string_view{member.name.GetString(), member.name.GetStringLength()});
+            for_each_member(member.value, visit);
+        }
+    } else if(value.IsArray()) {
+        for(auto & element : value.GetArray())
+            for_each_member(element, visit);
+    }
+}
+}
@@ -0,0 +1,10 @@
+kind "ConsoleApp"
+runtime "Release"
+
+files {
+  "src/lottie_splash/utils/message_template.cpp",
+}
+
+externalincludedirs {
+  "src/lottie_splash"
+}
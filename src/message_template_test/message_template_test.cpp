@@ -0,0 +1,119 @@
+// Headless checks of the registered status messages' templates: "{N}" placeholders filled in from the counters,
+// "{{" and "}}" escapes, placeholders that don't name a counter kept as text, and counters up to the largest value.
+// Also checks the segments the text run cache composes messages from. Exits with an error when a check fails. Doesn't
+// depend on any window system, so it runs anywhere:
+//   message_template_test
+
+#include <utils/message_template.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <memory_resource>
+#include <string_view>
+
+namespace {
+using Counters = std::array<std::atomic_uint64_t, utils::MessageTemplate::MAX_COUNTERS>;
+
+int failures = 0;
+
+void check(const bool condition, const char * what) {
+    if(!condition) {
+        std::fprintf(stderr, "failed: %s\n", what);
+        ++failures;
+    }
+}
+
+std::pmr::u8string format(const std::u8string_view text, const Counters & counters) {
+    std::pmr::u8string out;
+    utils::MessageTemplate{text}.format(counters.data(), out);
+    return out;
+}
+
+void check_placeholders() {
+    Counters counters{};
+    counters[0]  = 3;
+    counters[1]  = 12;
+    counters[15] = 7;
+
+    check(format(u8"Copied {0} of {1} files", counters) == u8"Copied 3 of 12 files", "counters are filled in");
+    check(format(u8"{1}{0}", counters) == u8"123", "adjacent placeholders");
+    check(format(u8"{15} left", counters) == u8"7 left", "the last counter");
+    check(format(u8"{0}{0}", counters) == u8"33", "a counter used twice");
+
+    const utils::MessageTemplate with{u8"Step {0}"};
+    const utils::MessageTemplate without{u8"Almost done"};
+    check(with.has_placeholders() && !without.has_placeholders(), "placeholders are detected");
+    check(without.text() == u8"Almost done", "a message without placeholders is its text");
+
+    // The counters are read when formatting, not when the template is made.
+    std::pmr::u8string out;
+    counters[0] = 4;
+    with.format(counters.data(), out);
+    check(out == u8"Step 4", "the current value is used");
+    counters[0] = 5;
+    with.format(counters.data(), out);
+    check(out == u8"Step 5", "formatting replaces the previous text");
+}
+
+void check_escapes() {
+    Counters counters{};
+    counters[0] = 9;
+
+    check(format(u8"{{0}}", counters) == u8"{0}", "escaped braces aren't a placeholder");
+    check(format(u8"{{{0}}}", counters) == u8"{9}", "a placeholder between escaped braces");
+    check(format(u8"a }} b {{ c", counters) == u8"a } b { c", "escapes on their own");
+    check(!utils::MessageTemplate{u8"{{0}}"}.has_placeholders(), "only escapes isn't a placeholder");
+    check(utils::MessageTemplate{u8"{{0}}"}.text() == u8"{0}", "escapes are resolved in the text");
+}
+
+void check_out_of_range() {
+    Counters counters{};
+
+    check(format(u8"{16}", counters) == u8"{16}", "a slot past the last counter is kept as text");
+    check(format(u8"{99999999999999999999}", counters) == u8"{99999999999999999999}", "an unparsable slot is kept");
+    check(format(u8"{-1} {x} {} {0x}", counters) == u8"{-1} {x} {} {0x}", "anything else in braces is kept");
+    check(format(u8"{0", counters) == u8"{0", "an unclosed brace is kept");
+    check(format(u8"0}", counters) == u8"0}", "a lone closing brace is kept");
+    check(!utils::MessageTemplate{u8"{16}"}.has_placeholders(), "out of range slots aren't placeholders");
+}
+
+void check_large_values() {
+    Counters counters{};
+    counters[0] = std::numeric_limits<uint64_t>::max();
+    counters[1] = 1'000'000'000'000;
+
+    check(format(u8"{0}", counters) == u8"18446744073709551615", "the largest value");
+    check(format(u8"{1} bytes", counters) == u8"1000000000000 bytes", "values past 32 bits");
+}
+
+void check_segments() {
+    const utils::MessageTemplate message{u8"{0}: {{{1}}}"};
+    const auto                   segments = message.segments();
+
+    check(segments.size() == 4, "counters and the literals between them");
+    if(segments.size() != 4)
+        return;
+    check(segments[0].counter == 0, "no empty literal before a leading placeholder");
+    check(segments[1].counter < 0 && message.literal(segments[1]) == u8": {", "literals are resolved and merged");
+    check(segments[2].counter == 1, "the second counter");
+    check(segments[3].counter < 0 && message.literal(segments[3]) == u8"}", "a trailing literal");
+}
+}
+
+int main() {
+    check_placeholders();
+    check_escapes();
+    check_out_of_range();
+    check_large_values();
+    check_segments();
+    if(failures) {
+        std::fprintf(stderr, "%d checks failed\n", failures);
+        return EXIT_FAILURE;
+    }
+    std::printf("all checks passed\n");
+    return EXIT_SUCCESS;
+}
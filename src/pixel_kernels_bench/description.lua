@@ -0,0 +1,12 @@
+kind "ConsoleApp"
+runtime "Release"
+
+files {
+  "src/lottie_splash/utils/pixel_kernels*.cpp",
+  "src/lottie_splash/utils/blend.cpp",
+  "src/lottie_splash/utils/upscale.cpp",
+}
+
+externalincludedirs {
+  "src/lottie_splash"
+}
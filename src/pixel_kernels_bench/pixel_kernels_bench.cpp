@@ -0,0 +1,252 @@
+// Checks that every SIMD version of the pixel kernels this CPU supports produces exactly the same pixels as the scalar
+// reference, then times each kernel on a frame sized image. Exits with an error on the first mismatch. Doesn't depend
+// on any window system, so it runs anywhere:
+//   pixel_kernels_bench [runs]
+
+#include <utils/blend.hpp>
+#include <utils/pixel_kernels.hpp>
+#include <utils/upscale.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace {
+using Image = std::vector<uint32_t>;
+
+constexpr std::array<utils::PixelIsa, 3> SIMD_ISAS = {
+  utils::PixelIsa::SSE2,
+  utils::PixelIsa::AVX2,
+  utils::PixelIsa::NEON,
+};
+
+// Runs of transparent, opaque and translucent pixels, like an overlay or a logo frame has.
+Image random_premultiplied(const size_t count, std::mt19937 & rng) {
+    Image                                   pixels(count);
+    std::uniform_int_distribution<uint32_t> byte{0, 255};
+    std::uniform_int_distribution<size_t>   run_length{1, 24};
+    for(size_t i = 0; i < count;) {
+        const uint32_t kind = byte(rng) % 3;
+        for(const size_t end = std::min(count, i + run_length(rng)); i < end; ++i) {
+            const uint32_t alpha = kind == 0 ? 0 : kind == 1 ? 255 : byte(rng);
+            uint32_t       pixel = alpha << 24;
+            for(int shift = 0; shift < 24; shift += 8)
+                pixel |= (byte(rng) * alpha / 255) << shift;
+            pixels[i] = pixel;
+        }
+    }
+    return pixels;
+}
+
+Image random_pixels(const size_t count, std::mt19937 & rng) {
+    Image pixels(count);
+    for(auto & pixel : pixels)
+        pixel = static_cast<uint32_t>(rng());
+    return pixels;
+}
+
+// Every alpha with every channel value, in each of the color channels.
+Image every_alpha_and_channel() {
+    Image pixels;
+    for(uint32_t alpha = 0; alpha < 256; ++alpha) {
+        for(uint32_t channel = 0; channel < 256; ++channel)
+            pixels.push_back(alpha << 24 | channel << 16 | (255 - channel) << 8 | (channel * 7 & 0xFF));
+    }
+    return pixels;
+}
+
+bool report_mismatch(const char *                kernel,
+                     const utils::PixelKernels & kernels,
+                     const Image &               expected,
+                     const Image &               got) {
+    const auto mismatch = std::mismatch(expected.begin(), expected.end(), got.begin());
+    if(mismatch.first == expected.end())
+        return true;
+
+    std::fprintf(stderr,
+                 "%s %s: pixel %zu is %08x, the scalar version gives %08x\n",
+                 kernels.name,
+                 kernel,
+                 static_cast<size_t>(mismatch.first - expected.begin()),
+                 *mismatch.second,
+                 *mismatch.first);
+    return false;
+}
+
+// A conversion of src into dst, run with different lengths and start offsets to cover the SIMD loops and their tails.
+using RowKernel = void (*)(uint32_t *, const uint32_t *, size_t) noexcept;
+
+bool verify_row_kernel(const char *                     name,
+                       const utils::PixelKernels &      kernels,
+                       RowKernel utils::PixelKernels::* kernel,
+                       const Image &                    src,
+                       const Image &                    background) {
+    const auto & scalar = *utils::pixel_kernels(utils::PixelIsa::Scalar);
+    for(size_t offset = 0; offset < 4; ++offset) {
+        for(const size_t count : {size_t{0}, size_t{1}, size_t{3}, size_t{7}, size_t{8}, size_t{13}, size_t{33},
+                                  src.size() - offset}) {
+            Image expected = background;
+            Image got      = background;
+            (scalar.*kernel)(expected.data() + offset, src.data() + offset, count);
+            (kernels.*kernel)(got.data() + offset, src.data() + offset, count);
+            if(!report_mismatch(name, kernels, expected, got))
+                return false;
+        }
+    }
+    return true;
+}
+
+bool verify_upscale(const utils::PixelKernels & kernels, std::mt19937 & rng, const bool nearest) {
+    const auto & scalar  = *utils::pixel_kernels(utils::PixelIsa::Scalar);
+    const auto   upscale = nearest ? utils::upscale_2x_nearest : utils::upscale_2x;
+    for(const int width : {1, 2, 5, 8, 9, 17, 40}) {
+        for(const int height : {1, 2, 3, 6}) {
+            const Image src = random_premultiplied(static_cast<size_t>(width) * height, rng);
+            // Odd sizes leave out the last column or row of the doubled image.
+            for(const int trim : {0, 1}) {
+                const int dst_width  = std::max(1, 2 * width - trim);
+                const int dst_height = std::max(1, 2 * height - trim);
+                Image     expected(static_cast<size_t>(dst_width) * dst_height);
+                Image     got(expected.size());
+                upscale(src.data(), width, height, expected.data(), dst_width, dst_height, scalar);
+                upscale(src.data(), width, height, got.data(), dst_width, dst_height, kernels);
+                if(!report_mismatch(nearest ? "upscale_2x_nearest" : "upscale_2x", kernels, expected, got))
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool verify(const utils::PixelKernels & kernels) {
+    std::mt19937 rng{42};
+    const Image  premultiplied = random_premultiplied(4096, rng);
+    const Image  background    = random_premultiplied(4096, rng);
+    const Image  any           = random_pixels(4096, rng);
+    const Image  exhaustive    = every_alpha_and_channel();
+
+    // Blending is only defined for premultiplied colors, which can't exceed their alpha.
+    const auto & scalar = *utils::pixel_kernels(utils::PixelIsa::Scalar);
+    Image        exhaustive_premultiplied(exhaustive.size());
+    scalar.premultiply(exhaustive_premultiplied.data(), exhaustive.data(), exhaustive.size());
+    const Image exhaustive_background(exhaustive_premultiplied.rbegin(), exhaustive_premultiplied.rend());
+
+    using K = utils::PixelKernels;
+    if(!verify_row_kernel("blend_over", kernels, &K::blend_over, premultiplied, background) ||
+       !verify_row_kernel("blend_over", kernels, &K::blend_over, exhaustive_premultiplied, exhaustive_background) ||
+       !verify_row_kernel("premultiply", kernels, &K::premultiply, any, background) ||
+       !verify_row_kernel("premultiply", kernels, &K::premultiply, exhaustive, exhaustive_background) ||
+       !verify_row_kernel("unpremultiply", kernels, &K::unpremultiply, premultiplied, background) ||
+       !verify_row_kernel("unpremultiply", kernels, &K::unpremultiply, exhaustive, exhaustive_background) ||
+       !verify_row_kernel("swap_red_blue", kernels, &K::swap_red_blue, any, background) ||
+       !verify_upscale(kernels, rng, false) || !verify_upscale(kernels, rng, true))
+        return false;
+
+    for(const size_t count : {size_t{0}, size_t{5}, size_t{8}, size_t{4093}}) {
+        Image expected = background;
+        Image got      = background;
+        scalar.fill(expected.data() + 1, count, 0x80402010u);
+        kernels.fill(got.data() + 1, count, 0x80402010u);
+        if(!report_mismatch("fill", kernels, expected, got))
+            return false;
+    }
+
+    for(const size_t count : {size_t{0}, size_t{6}, size_t{4096}}) {
+        Image expected = background;
+        Image got      = background;
+        scalar.average_rows(any.data(), premultiplied.data(), expected.data(), count);
+        kernels.average_rows(any.data(), premultiplied.data(), got.data(), count);
+        if(!report_mismatch("average_rows", kernels, expected, got))
+            return false;
+    }
+    return true;
+}
+
+// Best time of a few runs, in megapixels per second of output.
+double measure(const int runs, const size_t pixels, const std::function<void()> & run) {
+    auto best = std::chrono::steady_clock::duration::max();
+    for(int i = 0; i < runs; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        run();
+        best = std::min(best, std::chrono::steady_clock::now() - start);
+    }
+    return pixels / std::chrono::duration<double, std::micro>(best).count();
+}
+
+void benchmark(const int runs, const std::vector<const utils::PixelKernels *> & available) {
+    // A 1080p frame, and half of it for the upscale.
+    constexpr int  WIDTH  = 1920;
+    constexpr int  HEIGHT = 1080;
+    constexpr auto COUNT  = static_cast<size_t>(WIDTH) * HEIGHT;
+
+    std::mt19937 rng{7};
+    const Image  overlay = random_premultiplied(COUNT, rng);
+    const Image  frame   = random_premultiplied(COUNT, rng);
+    const Image  half    = random_premultiplied(COUNT / 4, rng);
+    Image        dst(COUNT);
+
+    struct Case {
+        const char *                                     name;
+        std::function<void(const utils::PixelKernels &)> run;
+    };
+    const Case cases[] = {
+      {"fill", [&](const auto & k) { utils::fill(dst.data(), WIDTH, WIDTH, HEIGHT, 0xFF202020u, k); }},
+      {"blend_over",
+       [&](const auto & k) {
+           dst = frame;
+           utils::blend_over(dst.data(), WIDTH, overlay.data(), WIDTH, WIDTH, HEIGHT, k);
+       }},
+      {"premultiply", [&](const auto & k) { utils::premultiply(dst.data(), frame.data(), COUNT, k); }},
+      {"unpremultiply", [&](const auto & k) { utils::unpremultiply(dst.data(), frame.data(), COUNT, k); }},
+      {"swap_red_blue", [&](const auto & k) { utils::swap_red_blue(dst.data(), frame.data(), COUNT, k); }},
+      {"upscale_2x",
+       [&](const auto & k) { utils::upscale_2x(half.data(), WIDTH / 2, HEIGHT / 2, dst.data(), WIDTH, HEIGHT, k); }},
+      {"upscale_2x_nearest",
+       [&](const auto & k) {
+           utils::upscale_2x_nearest(half.data(), WIDTH / 2, HEIGHT / 2, dst.data(), WIDTH, HEIGHT, k);
+       }},
+    };
+
+    std::printf("%-20s", "Mpixels/s");
+    for(const auto * kernels : available)
+        std::printf(" %10s", kernels->name);
+    std::printf("\n");
+    for(const auto & test : cases) {
+        std::printf("%-20s", test.name);
+        // The scalar reference comes first.
+        double scalar = 0.0;
+        double best   = 0.0;
+        for(const auto * kernels : available) {
+            const double speed = measure(runs, COUNT, [&] { test.run(*kernels); });
+            scalar             = scalar > 0.0 ? scalar : speed;
+            best               = std::max(best, speed);
+            std::printf(" %10.0f", speed);
+        }
+        std::printf("   %.1fx\n", best / scalar);
+    }
+}
+}
+
+int main(int argc, char ** argv) {
+    const int runs = argc > 1 ? std::max(1, std::atoi(argv[1])) : 20;
+
+    std::vector<const utils::PixelKernels *> available{utils::pixel_kernels(utils::PixelIsa::Scalar)};
+    for(const auto isa : SIMD_ISAS) {
+        const auto * kernels = utils::pixel_kernels(isa);
+        if(!kernels)
+            continue;
+        if(!verify(*kernels))
+            return EXIT_FAILURE;
+        std::printf("%s matches the scalar reference\n", kernels->name);
+        available.push_back(kernels);
+    }
+    std::printf("dispatching to %s\n\n", utils::pixel_kernels().name);
+
+    benchmark(runs, available);
+    return EXIT_SUCCESS;
+}
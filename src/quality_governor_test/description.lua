@@ -0,0 +1,10 @@
+kind "ConsoleApp"
+runtime "Release"
+
+files {
+  "src/lottie_splash/utils/quality_governor.cpp",
+}
+
+externalincludedirs {
+  "src/lottie_splash"
+}
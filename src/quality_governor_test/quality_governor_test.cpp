@@ -0,0 +1,157 @@
+// Headless checks of the adaptive quality governor. A fake clock renders frames at whatever level the governor picked,
+// at the interval that level asks for and with a cost that shrinks with the level, and checks when the governor steps
+// down, that it doesn't step back up while the level above wouldn't fit, and that a step up which had to be undone
+// makes the next one wait longer. Exits with an error when a check fails. Doesn't depend on any window system, so it
+// runs anywhere:
+//   quality_governor_test
+
+#include <utils/quality_governor.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+
+namespace {
+using namespace std::chrono;
+using Level = utils::QualityGovernor::Level;
+
+constexpr nanoseconds FRAME = 16'666'667ns;
+
+int failures = 0;
+
+void check(const bool condition, const char * what) {
+    if(!condition) {
+        std::fprintf(stderr, "failed: %s\n", what);
+        ++failures;
+    }
+}
+
+// What a frame of a logo costing full_cost at full quality costs at the given level.
+nanoseconds frame_cost(const nanoseconds full_cost, const Level level) {
+    switch(level) {
+    case Level::ReducedResolution:
+        return full_cost * 35 / 100;
+    case Level::Frozen:
+        return full_cost / 10;
+    default:
+        return full_cost;
+    }
+}
+
+class FakeClock final {
+  public:
+    nanoseconds now{};
+
+    // Renders frames, each after the interval of the governor's level, until the level changes or the given time has
+    // passed. Returns when the level changed, relative to the start.
+    std::optional<nanoseconds>
+      run(utils::QualityGovernor & governor, const nanoseconds full_cost, const nanoseconds length) {
+        const nanoseconds start = now;
+        while(now - start < length) {
+            const nanoseconds interval = FRAME * utils::QualityGovernor::frame_interval_multiplier(governor.level());
+            now += interval;
+            if(governor.report(frame_cost(full_cost, governor.level()), interval))
+                return now - start;
+        }
+        return std::nullopt;
+    }
+};
+
+void check_within_budget() {
+    utils::QualityGovernor governor{0.5};
+    FakeClock              clock;
+
+    check(!clock.run(governor, 4ms, 10s), "a quarter of a core on a half core budget keeps full quality");
+    check(governor.level() == Level::Full && governor.level_changes() == 0, "still at full quality");
+    check(governor.load() > 0.23 && governor.load() < 0.25, "the load is the share of a core rendering takes");
+}
+
+void check_step_down() {
+    utils::QualityGovernor governor{0.5};
+    FakeClock              clock;
+
+    // 12ms out of every 16.7ms is over the budget from the first frame, and stays over it for 250ms.
+    const auto changed = clock.run(governor, 12ms, 1s);
+    check(changed == FRAME * 15, "steps down after being over the budget for 250ms");
+    check(governor.level() == Level::ReducedFrameRate, "steps down one level");
+
+    // A quarter of the frames fits, but full quality still wouldn't, so the level holds.
+    check(!clock.run(governor, 12ms, 30s), "doesn't step up while the level above would exceed the budget");
+    check(governor.level_changes() == 1, "a single level change");
+}
+
+void check_frozen() {
+    utils::QualityGovernor governor{0.5};
+    FakeClock              clock;
+
+    while(clock.run(governor, 100ms, 10s)) {}
+    check(governor.level() == Level::Frozen, "a logo costing more than a frame freezes");
+    check(governor.level_changes() == 3, "one level at a time");
+    check(!clock.run(governor, 100ms, 10s), "freezing holds");
+}
+
+void check_step_up() {
+    utils::QualityGovernor governor{0.5};
+    FakeClock              clock;
+
+    clock.run(governor, 12ms, 1s);
+    check(governor.level() == Level::ReducedFrameRate, "steps down under load");
+
+    // The logo gets cheaper, e.g. after a heavy segment. Stepping up waits for two seconds of headroom.
+    auto changed = clock.run(governor, 2ms, 10s);
+    check(changed && *changed >= 2s && *changed < 3s, "steps up after two seconds of headroom");
+    check(governor.level() == Level::Full, "back at full quality");
+
+    // The load comes back right after stepping up, so the step up is undone and the next one waits twice as long.
+    clock.run(governor, 12ms, 1s);
+    check(governor.level() == Level::ReducedFrameRate, "steps down again");
+    changed = clock.run(governor, 2ms, 10s);
+    check(changed && *changed >= 4s && *changed < 5s, "an undone step up doubles the delay of the next one");
+
+    // This one holds, which brings the delay back to two seconds.
+    check(!clock.run(governor, 2ms, 10s), "full quality holds");
+    clock.run(governor, 12ms, 1s);
+    check(governor.level() == Level::ReducedFrameRate, "steps down a third time");
+    changed = clock.run(governor, 2ms, 10s);
+    check(changed && *changed >= 2s && *changed < 3s, "a step up that held resets the delay");
+}
+
+void check_cpu_share() {
+    utils::QualityGovernor governor{0.5};
+    FakeClock              clock;
+
+    clock.run(governor, 12ms, 1s);
+    check(governor.level() == Level::ReducedFrameRate, "steps down on a half core budget");
+
+    governor.set_cpu_share(2.0);
+    const auto changed = clock.run(governor, 12ms, 10s);
+    check(changed && *changed >= 2s && *changed < 3s, "a bigger budget lets it step up");
+    check(governor.level() == Level::Full, "full quality fits two cores");
+}
+
+void check_intervals() {
+    check(utils::QualityGovernor::frame_interval_multiplier(Level::Full) == 1, "full quality renders every frame");
+    check(utils::QualityGovernor::frame_interval_multiplier(Level::ReducedFrameRate) == 4, "a quarter of the frames");
+    check(utils::QualityGovernor::frame_interval_multiplier(Level::ReducedResolution) == 4, "also a quarter");
+    check(utils::QualityGovernor::frame_interval_multiplier(Level::Frozen) == 8, "frozen only updates the overlay");
+
+    utils::QualityGovernor governor{0.5};
+    check(!governor.report(1s, 0ns) && governor.load() < 0.0, "a frame without an interval isn't counted");
+}
+}
+
+int main() {
+    check_within_budget();
+    check_step_down();
+    check_frozen();
+    check_step_up();
+    check_cpu_share();
+    check_intervals();
+    if(failures) {
+        std::fprintf(stderr, "%d checks failed\n", failures);
+        return EXIT_FAILURE;
+    }
+    std::printf("all checks passed\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,22 @@
+kind "ConsoleApp"
+links {"lottie_tools", "deps"}
+dependson {"lottie_tools"}
+runtime "Release"
+
+files {
+  "src/lottie_splash/text_run_cache.cpp",
+  "src/lottie_splash/utils/memory.cpp",
+  "src/lottie_splash/utils/message_template.cpp",
+  "src/lottie_splash/utils/blend.cpp",
+  "src/lottie_splash/utils/pixel_kernels*.cpp",
+  "src/lottie_splash/utils/font_provider.cpp",
+  "src/lottie_splash/utils/unicode.cpp",
+  "src/lottie_splash/fonts/embedded_font.cpp",
+}
+
+externalincludedirs {
+  "src",
+  "src/lottie_splash",
+  "src/deps/thorvg/inc",
+  "src/deps/config/",
+}
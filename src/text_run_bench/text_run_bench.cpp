@@ -0,0 +1,206 @@
+// Headless benchmark of an overlay frame showing a 100 character status message in the font compiled into the library.
+// Compares laying the message out with a tvg::Text on every frame, like the splash window did before text runs were
+// cached, with drawing a run from the TextRunCache, once for a message that stays the same and once for one that
+// changes on every frame and so has to be rasterized each time. The last case fills the changing number in as a
+// registered message's counter, which only redraws the digits from cached glyphs:
+//   text_run_bench [frames]
+
+#include <lottie_tools/headless.hpp>
+#include <text_run_cache.hpp>
+#include <utils/font_provider.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+// The splash window's size and status message layout at 96 DPI.
+constexpr int   WIDTH          = 465;
+constexpr int   HEIGHT         = 300;
+constexpr float MESSAGE_X      = 110.0f;
+constexpr float MESSAGE_Y      = 257.0f;
+constexpr float MESSAGE_SIZE   = 12.0f * 72.0f / 96.0f;
+constexpr int   MESSAGE_LENGTH = 100;
+
+// An installer's status line, with a counter that can change from frame to frame without changing the length.
+std::u8string status_message(const int counter) {
+    char file[16];
+    std::snprintf(file, sizeof(file), "%06d", counter % 1000000);
+
+    std::u8string message = u8"Extracting C:\\Program Files\\Example Studio\\resources\\packages\\shaders\\cache_";
+    message.append(reinterpret_cast<const char8_t *>(file));
+    message.append(u8".bin");
+    message.resize(MESSAGE_LENGTH, u8'.');
+    return message;
+}
+
+// The same status line as a registered message, with the counter's six digits in place of the placeholder.
+std::u8string counter_message_template() {
+    std::u8string message =
+      u8"Extracting C:\\Program Files\\Example Studio\\resources\\packages\\shaders\\cache_{0}.bin";
+    message.resize(MESSAGE_LENGTH - 6 + 3, u8'.');
+    return message;
+}
+
+class Overlay final {
+  public:
+    Overlay() : _pixels(static_cast<size_t>(WIDTH) * HEIGHT), _canvas(tvg::SwCanvas::gen()) {
+        if(_canvas)
+            _canvas->target(_pixels.data(), WIDTH, WIDTH, HEIGHT, tvg::ColorSpace::ARGB8888);
+    }
+
+    tvg::SwCanvas * canvas() const { return _canvas.get(); }
+
+    bool render() {
+        return _canvas->update() == tvg::Result::Success && _canvas->draw(true) == tvg::Result::Success &&
+               _canvas->sync() == tvg::Result::Success;
+    }
+
+  private:
+    std::vector<uint32_t>          _pixels;
+    std::unique_ptr<tvg::SwCanvas> _canvas;
+};
+
+// Lays out and tessellates the message every frame.
+std::function<bool(int)> text_per_frame(Overlay & overlay, const std::string & family, const bool changing) {
+    auto * text = tvg::Text::gen();
+    if(!text || overlay.canvas()->push(text) != tvg::Result::Success)
+        return nullptr;
+
+    text->font(family.c_str(), MESSAGE_SIZE);
+    text->fill(255, 255, 255);
+    text->translate(MESSAGE_X, MESSAGE_Y);
+    return [text, &overlay, changing](const int frame) {
+        const auto message = status_message(changing ? frame : 0);
+        text->text(reinterpret_cast<const char *>(message.c_str()));
+        return overlay.render();
+    };
+}
+
+// Loads the run's bitmap into the picture only when the run changed, like SplashWindow::update_text.
+bool show_run(tvg::Picture * picture, const TextRunCache::Run * run, uint64_t & run_id) {
+    if(!run)
+        return false;
+    if(run->id == run_id)
+        return true;
+
+    if(picture->load(const_cast<uint32_t *>(run->pixels.data()),
+                     static_cast<uint32_t>(run->width),
+                     static_cast<uint32_t>(run->height),
+                     tvg::ColorSpace::ARGB8888,
+                     false) != tvg::Result::Success)
+        return false;
+    picture->translate(MESSAGE_X + run->origin_x, MESSAGE_Y + run->origin_y);
+    run_id = run->id;
+    return true;
+}
+
+// Blits the run's bitmap from the cache.
+std::function<bool(int)> cached_run(Overlay & overlay, const std::string & family, const bool changing) {
+    auto * picture = tvg::Picture::gen();
+    if(!picture || overlay.canvas()->push(picture) != tvg::Result::Success)
+        return nullptr;
+
+    auto cache = std::make_shared<TextRunCache>(8);
+    return [picture, cache, &overlay, family, changing, run_id = uint64_t{0}](const int frame) mutable {
+        const auto * run =
+          cache->get({.family = family, .size_pt = MESSAGE_SIZE}, status_message(changing ? frame : 0));
+        return show_run(picture, run, run_id) && overlay.render();
+    };
+}
+
+// Fills the counter in from the cached bitmaps of the message's literal parts and of the digits.
+std::function<bool(int)> counter_message(Overlay & overlay, const std::string & family, const bool changing) {
+    auto * picture = tvg::Picture::gen();
+    if(!picture || overlay.canvas()->push(picture) != tvg::Result::Success)
+        return nullptr;
+
+    struct State {
+        TextRunCache                        cache{8};
+        utils::MessageTemplate              message{counter_message_template()};
+        std::array<std::atomic_uint64_t, 1> counters{};
+        uint64_t                            run_id = 0;
+    };
+    auto state = std::make_shared<State>();
+    return [picture, state, &overlay, family, changing](const int frame) {
+        state->counters[0].store(changing ? 100000 + (frame + 1) % 900000 : 100000, std::memory_order_relaxed);
+        const auto * run = state->cache.get_pinned(
+          0, {.family = family, .size_pt = MESSAGE_SIZE}, state->message, state->counters.data());
+        return show_run(picture, run, state->run_id) && overlay.render();
+    };
+}
+
+struct Timing {
+    double mean_ms = 0.0;
+    double best_ms = 0.0;
+};
+
+bool measure(const int frames, const std::function<bool(int)> & frame, Timing & timing) {
+    if(!frame || !frame(-1))
+        return false;
+
+    using ms   = std::chrono::duration<double, std::milli>;
+    auto total = ms::zero();
+    auto best  = ms::max();
+    for(int i = 0; i < frames; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        if(!frame(i))
+            return false;
+        const ms elapsed = std::chrono::steady_clock::now() - start;
+        total += elapsed;
+        best   = std::min(best, elapsed);
+    }
+    timing = {.mean_ms = total.count() / frames, .best_ms = best.count()};
+    return true;
+}
+}
+
+int main(int argc, char ** argv) {
+    const int frames = argc > 1 ? std::max(1, std::atoi(argv[1])) : 500;
+
+    const lottie_tools::Engine engine;
+    if(!engine.initialized()) {
+        std::fprintf(stderr, "Couldn't initialize thorvg\n");
+        return EXIT_FAILURE;
+    }
+
+    const auto font = utils::embedded_font();
+    if(tvg::Text::load(font.family.c_str(), font.data, static_cast<uint32_t>(font.size), "ttf", false) !=
+       tvg::Result::Success) {
+        std::fprintf(stderr, "Couldn't load the embedded font\n");
+        return EXIT_FAILURE;
+    }
+
+    struct Case {
+        const char *          name;
+        decltype(&cached_run) make;
+        bool                  changing;
+    };
+    const Case cases[] = {
+      {"text per frame", text_per_frame, false},
+      {"cached run", cached_run, false},
+      {"text per frame, changing", text_per_frame, true},
+      {"cached run, changing", cached_run, true},
+      {"counter message, changing", counter_message, true},
+    };
+
+    std::printf("%d frames of %dx%d with a %d character status message\n\n", frames, WIDTH, HEIGHT, MESSAGE_LENGTH);
+    std::printf("%-26s %10s %10s\n", "ms per frame", "mean", "best");
+    for(const auto & test : cases) {
+        Overlay overlay;
+        Timing  timing;
+        if(!overlay.canvas() || !measure(frames, test.make(overlay, font.family, test.changing), timing)) {
+            std::fprintf(stderr, "%s: rendering failed\n", test.name);
+            return EXIT_FAILURE;
+        }
+        std::printf("%-26s %10.3f %10.3f\n", test.name, timing.mean_ms, timing.best_ms);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,11 @@
+kind "ConsoleApp"
+runtime "Release"
+
+files {
+  "src/lottie_splash/utils/visibility.cpp",
+  "src/lottie_splash/utils/animation_timeline.cpp",
+}
+
+externalincludedirs {
+  "src/lottie_splash"
+}
@@ -0,0 +1,111 @@
+// Headless checks of how the render loop reacts to its window being hidden. Drives VisibilityState with a fake source
+// through minimizing, locking the session and cloaking, and checks the reported transitions and the hidden time, then
+// checks that resyncing the animation timeline after a hidden period doesn't count the gap as skipped frames. Exits
+// with an error when a check fails. Doesn't depend on any window system, so it runs anywhere:
+//   visibility_test
+
+#include <utils/animation_timeline.hpp>
+#include <utils/visibility.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+using namespace std::chrono;
+using Transition = utils::VisibilityState::Transition;
+
+class FakeSource final : public utils::VisibilitySource {
+  public:
+    uint32_t reasons = 0;
+
+    uint32_t hidden_reasons() noexcept override { return reasons; }
+};
+
+int failures = 0;
+
+void check(const bool condition, const char * what) {
+    if(!condition) {
+        std::fprintf(stderr, "failed: %s\n", what);
+        ++failures;
+    }
+}
+
+void check_transitions() {
+    FakeSource             source;
+    utils::VisibilityState state;
+
+    check(state.update(source, 0s) == Transition::None, "a visible window doesn't transition");
+    check(state.visible() && state.times_hidden() == 0, "starts visible");
+
+    source.reasons = utils::HIDDEN_MINIMIZED;
+    check(state.update(source, 1s) == Transition::Hidden, "minimizing hides");
+    check(!state.visible() && state.times_hidden() == 1, "minimized counts as hidden once");
+
+    // More reasons while hidden, and one of them going away, don't show the window.
+    source.reasons |= utils::HIDDEN_SESSION_LOCKED;
+    check(state.update(source, 2s) == Transition::None, "locking while minimized doesn't transition");
+    check(state.reasons() == (utils::HIDDEN_MINIMIZED | utils::HIDDEN_SESSION_LOCKED), "both reasons are reported");
+    check(state.hidden_time() == 1s, "hidden time includes the ongoing period");
+
+    source.reasons = utils::HIDDEN_SESSION_LOCKED;
+    check(state.update(source, 3s) == Transition::None, "restoring on a locked session doesn't show");
+    check(!state.visible(), "still hidden while locked");
+
+    source.reasons = 0;
+    check(state.update(source, 5s) == Transition::Shown, "unlocking shows");
+    check(state.visible() && state.times_hidden() == 1, "one hidden period so far");
+    check(state.hidden_time() == 4s, "hidden from minimizing to unlocking");
+
+    check(state.update(source, 6s) == Transition::None, "staying visible doesn't transition");
+    check(state.hidden_time() == 4s, "visible time isn't counted");
+
+    source.reasons = utils::HIDDEN_CLOAKED;
+    check(state.update(source, 7s) == Transition::Hidden, "cloaking hides");
+    check(state.update(source, 7500ms) == Transition::None, "staying cloaked doesn't transition");
+    check(state.hidden_time() == 4500ms, "the second period adds to the first");
+
+    source.reasons = 0;
+    check(state.update(source, 8s) == Transition::Shown, "uncloaking shows");
+    check(state.times_hidden() == 2 && state.hidden_time() == 5s, "two hidden periods");
+}
+
+// A 60 frame animation at 60 fps, presented on every frame for a while, then hidden for three seconds.
+void check_resync() {
+    constexpr nanoseconds FRAME  = 16'666'667ns;
+    constexpr nanoseconds HIDDEN = 3s;
+
+    for(const bool resync : {true, false}) {
+        utils::AnimationTimeline timeline{60.0, 1.0};
+        timeline.reset(0ns);
+
+        nanoseconds now{};
+        for(int i = 0; i < 10; ++i, now += FRAME)
+            timeline.advance(now);
+
+        now += HIDDEN;
+        if(resync)
+            timeline.resync(now);
+        for(int i = 0; i < 10; ++i, now += FRAME)
+            timeline.advance(now);
+
+        if(resync) {
+            check(timeline.stats().skipped_frames == 0, "resyncing doesn't count the hidden period as skipped");
+            check(timeline.stats().repeated_frames == 0, "resyncing doesn't repeat a frame");
+        } else {
+            check(timeline.stats().skipped_frames == 180, "without resyncing the hidden period is skipped frames");
+        }
+    }
+}
+}
+
+int main() {
+    check_transitions();
+    check_resync();
+    if(failures) {
+        std::fprintf(stderr, "%d checks failed\n", failures);
+        return EXIT_FAILURE;
+    }
+    std::printf("all checks passed\n");
+    return EXIT_SUCCESS;
+}